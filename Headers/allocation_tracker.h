@@ -0,0 +1,156 @@
+/**
+ * @file allocation_tracker.h
+ * @brief Header file containing user-defined types that related to allocation accounting. (Allocations per window message)
+ */
+
+#ifndef ALLOCATION_TRACKER_H
+#define ALLOCATION_TRACKER_H
+
+/*********************************
+ * Allocation tracker structures *
+ *********************************/
+
+/**
+ * @brief Allocation counters of a window message and control ID pair.
+ * @note Written lock-free by the allocating threads, the reported totals are only accessed by the report. (See `MyAllocationTracker::writeReport()`)
+ */
+struct MYALLOCATIONCOUNTER
+{
+    std::atomic<UINT64> key;              // Allocation context key, 0 if the counter is free.
+    std::atomic<UINT64> totalAllocations; // Number of allocations.
+    std::atomic<UINT64> totalBytes;       // Number of allocated bytes.
+    UINT64 reportedAllocations;           // Number of allocations at the last report.
+    UINT64 reportedBytes;                 // Number of allocated bytes at the last report.
+};
+
+/******************************
+ * Allocation tracker classes *
+ ******************************/
+
+/**
+ * @brief Global allocation tracker, attributes the allocations to the window message being dispatched.
+ * @note The global allocation functions are only replaced in the builds with `ALLOCATION_TRACKING_COMPILE_ENABLED`. (See marco.h)
+ * @note Disabled by default, the replaced `operator new` only checks an atomic flag until enabled.
+ *       The window procedures set the allocation context of their thread (See `MY_ALLOCATION_SCOPE()`),
+ *       the allocations made outside of any window procedure are counted as unattributed.
+ *       The counters live in a fixed lock-free table, so counting an allocation never allocates.
+ */
+class MyAllocationTracker
+{
+public:
+    // [ALLOCATION TRACKING FUNCTIONS]
+
+    /**
+     * @brief Check if the tracker counts allocations.
+     * @return Returns true if the tracker is enabled, false otherwise.
+     */
+    static bool isEnabled()
+    {
+        return MyAllocationTracker::isTracking.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enable or disable the tracker.
+     * @note Enabling the tracker starts a new report interval.
+     * @param isEnabled Specifies whether the tracker counts allocations.
+     */
+    static void setEnabled(bool isEnabled);
+
+    /**
+     * @brief Count an allocation in the allocation context of the calling thread.
+     * @param size Specifies the allocation size in bytes.
+     */
+    static void recordAllocation(size_t size);
+
+    /**
+     * @brief Set the allocation context of the calling thread.
+     * @note The context is left unchanged if the tracker is disabled.
+     * @param message Specifies the window message.
+     * @param controlId Specifies the control ID of the window, 0 for the application window.
+     * @return Returns the previous allocation context, restore it with `leaveContext()`.
+     */
+    static UINT64 enterContext(UINT message, UINT controlId);
+
+    /**
+     * @brief Restore the allocation context of the calling thread.
+     * @param previousContext Specifies the allocation context returned by `enterContext()`.
+     */
+    static void leaveContext(UINT64 previousContext)
+    {
+        MyAllocationTracker::currentContext = previousContext;
+    }
+
+    /**
+     * @brief Write the allocation rates since the previous report, most allocations first.
+     * @note The allocations made by the report itself are not counted.
+     * @param logger Specifies the logger.
+     * @param maximumRows Specifies the maximum number of reported counters. (optional)
+     * @return Returns the number of reported counters.
+     */
+    static size_t writeReport(MyLogger &logger, size_t maximumRows = 10);
+
+private:
+    /**
+     * @brief Find the counter of an allocation context, claimed on first use.
+     * @param key Specifies the allocation context key.
+     * @return Returns the pointer to the counter, nullptr if the table is full.
+     */
+    static MYALLOCATIONCOUNTER *findCounter(UINT64 key);
+
+    /**
+     * @brief Get the name of a window message.
+     * @param message Specifies the window message.
+     * @return Returns the message name, nullptr if the message is not named.
+     */
+    static const char *getMessageName(UINT message);
+
+public:
+    inline static const UINT64 ignoredContext = ~0ULL; // Allocation context of the allocations that are not counted.
+    inline static const UINT reportInterval = 1000;    // Report interval. (Milliseconds)
+
+private:
+    inline static std::atomic<bool> isTracking{false};                        // Indicate whether the tracker counts allocations.
+    inline static thread_local UINT64 currentContext = 0;                     // Allocation context of the thread, 0 if unattributed.
+    inline static thread_local MYALLOCATIONCOUNTER *pCachedCounter = nullptr; // Counter of the last counted allocation context of the thread.
+    inline static const UINT maximumCounters = 512;                           // Size of the counter table, a power of two.
+    inline static MYALLOCATIONCOUNTER counters[maximumCounters] = {};         // Counter table, indexed by the hashed allocation context key.
+    inline static std::atomic<UINT64> totalUnattributedAllocations{0};        // Number of allocations made outside of any allocation context.
+    inline static std::atomic<UINT64> totalUnattributedBytes{0};              // Number of bytes allocated outside of any allocation context.
+    inline static std::atomic<UINT64> totalDroppedAllocations{0};             // Number of allocations not counted because the table is full.
+    inline static UINT64 reportedUnattributedAllocations = 0;                 // Number of unattributed allocations at the last report.
+    inline static UINT64 reportedUnattributedBytes = 0;                       // Number of unattributed bytes at the last report.
+    inline static ULONGLONG lastReportTime = 0;                               // Time of the last report. (Milliseconds)
+};
+
+/**
+ * @brief Allocation context scope, attributes the allocations of the calling thread to a window message until destroyed.
+ * @note Use `MY_ALLOCATION_SCOPE()`, which is compiled out with the allocation tracker.
+ */
+class MyAllocationScope
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param message Specifies the window message.
+     * @param controlId Specifies the control ID of the window, 0 for the application window.
+     */
+    MyAllocationScope(UINT message, UINT controlId)
+        : previousContext(MyAllocationTracker::enterContext(message, controlId)) {}
+
+    /**
+     * @brief Destructor.
+     * @note The previous allocation context is restored.
+     */
+    ~MyAllocationScope()
+    {
+        MyAllocationTracker::leaveContext(this->previousContext);
+    }
+
+    MyAllocationScope(const MyAllocationScope &) = delete;
+    MyAllocationScope &operator=(const MyAllocationScope &) = delete;
+
+private:
+    UINT64 previousContext; // Allocation context to restore.
+};
+
+#endif // ALLOCATION_TRACKER_H
\ No newline at end of file
@@ -50,16 +50,44 @@ public:
 
     /**
      * @brief Load the application configuration file.
+     * @note The file is created with the default options if it doesn't exist.
+     * @note Command line options in the `--<Option name>=<Value>` form override the file options. (e.g. `--Theme=Dark --Debug=2`)
+     *       They are never written to the configuration file, and an option stops being overridden once it's updated from the UI.
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
     bool loadConfigurationFile();
 
     /**
      * @brief Update an option in the configuration file.
+     * @note The configuration file is written asynchronously, bursts of updates are coalesced into a single write.
+     * @note The option is no longer overridden by the command line.
+     * @param optionName Specifies the option name. (Case-insensitive)
+     * @param optionValue Specifies the option value string.
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
     bool updateConfigurationFile(std::string optionName, std::string optionValue);
 
+    /**
+     * @brief Reload the application configuration file.
+     * @note Called when the configuration file watcher reports a change. The command line options are re-applied on top of the file options.
+     * @note Changes caused by the configuration file writer's own writes are ignored. (See `MyConfigWriter::isOwnContent()`)
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool reloadConfigurationFile();
+
+    /**
+     * @brief Apply the file options and the command line options on top of them to the application options, as a single batch.
+     */
+    void mergeConfigurationOptions();
+
+    /**
+     * @brief Apply the changed configuration options to the application.
+     * @note Subscribed to every option, called once per batch of configuration changes. (File reloads, UI actions, command line)
+     * @param changedKeys Specifies the mask of the changed options.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool applyConfigurationChanges(const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &changedKeys);
+
     // [PROCEDURE FUNCTIONS]
     // Functions that invoked in the application window procedure.
 
@@ -96,12 +124,29 @@ public:
     // Functions that managing the application theme.
 
     /**
-     * @brief Update the application parameters and resources to match the specified theme.
+     * @brief Switch the application to the specified theme.
+     * @note The UI colors crossfade to the new theme over `themeTransitionDuration`, see `stepThemeTransition()`.
+     *       Switching again while a transition is in progress continues from the current colors.
      * @param theme Specifies the theme name.
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
     bool setAppTheme(MyTheme theme);
 
+    /**
+     * @brief Advance the current theme transition by one frame.
+     * @note Called by the theme transition timer. All the UI colors are blended in one pass and the affected windows are repainted once per frame.
+     *       The final frame applies the theme with `applyAppTheme()` and logs the transition frame times.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool stepThemeTransition();
+
+    /**
+     * @brief Update the application parameters and resources to match the specified theme immediately.
+     * @param theme Specifies the theme name.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool applyAppTheme(MyTheme theme);
+
     /**
      * @brief Update the application container windows resources to match the specified theme.
      * @param theme Specifies the theme name.
@@ -109,6 +154,23 @@ public:
      */
     bool updateContainers(MyTheme theme);
 
+    /**
+     * @brief Reload the theme file and update only the resources and windows that depend on the changed colors.
+     * @note Called when the theme file watcher reports a change. The reload-to-repaint latency is logged.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool reloadThemeFile();
+
+    /**
+     * @brief Refresh the resources and windows that depend on any of the specified theme colors.
+     * @note The refreshed windows are invalidated but not updated.
+     * @param colors Specifies the color mask.
+     * @param totalRefreshedWindows Reference to the variable that receives the number of refreshed windows. [OUT]
+     * @param isColorOnly Specifies whether to only recolor the existing resources instead of recreating them. (Used by the theme transition frames)
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool refreshColorDependents(const std::bitset<UI_THEME_COLOR_COUNT> &colors, UINT &totalRefreshedWindows, bool isColorOnly = false);
+
     // [UTILITY FUNCTIONS]
 
     /**
@@ -132,6 +194,43 @@ public:
      */
     std::shared_ptr<MyContainer> findContainer(INT containerWindowID);
 
+    /**
+     * @brief Show or hide the performance HUD. (See `MyPerformanceHud`)
+     * @note The HUD window is created when shown and destroyed when hidden, the HUD only records the statistics while shown.
+     * @param isShown Specifies whether to show the HUD.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool showPerformanceHud(bool isShown);
+
+    /**
+     * @brief Start or stop the input recording or replay to match the `InputRecording` option. (See `MyInputRecorder`)
+     * @note The recording in progress is written to the recording file when stopped.
+     *       The replay restores the recorded window placement first, the mouse wheel messages hold screen coordinates.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool updateInputRecording();
+
+    /**
+     * @brief Replay the next input replay frame.
+     * @note Called by the input replay timer. The finished replay logs its statistics, and closes the application in the `ReplayAndExit` mode.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool stepInputReplay();
+
+    /**
+     * @brief Send a replayed input record to its target window.
+     * @param record Specifies the record.
+     * @return Returns true if the record is sent, false if its target window is not found.
+     */
+    bool dispatchInputRecord(const MYINPUTRECORD &record);
+
+    /**
+     * @brief Finish the startup trace, log the startup timeline and write the startup trace file if the option is enabled.
+     * @note Called once the first frame is drawn, the later phases are not recorded. (See `MyStartupTracer`)
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool finishStartupTrace();
+
     // [APPLICATION WINDOW HELPER FUNCTIONS]
 
     /**
@@ -150,18 +249,61 @@ public:
      */
     void adjustMaximizedClientRect(HWND window, RECT &rect);
 
+    /**
+     * @brief Move the performance HUD window to the top-right corner of the client area, above the sibling windows.
+     */
+    void updatePerformanceHudPosition();
+
 public:
     // Application main variables.
 
     MyLogger logger;                                            // Instance of the application logger used for writing log records.
+    MyConfigStore config;                                       // Application configuration options. (File options merged with the command line options)
+    MyConfigStore fileConfig;                                   // Configuration file options, the only options written to the configuration file.
+    MyConfigWriter configWriter;                                // Application configuration file writer.
+    MyProfiler profiler;                                        // Frame timing profiler of the controls.
+    MyInputRecorder inputRecorder;                              // Input recorder and replayer of the window procedures.
+    MyStartupTracer startupTracer;                              // Startup phase tracer, records the phases until the first frame is drawn.
+    MyStartupSnapshot startupSnapshot;                          // Startup snapshot of the decoded images, mapped during the initialization if the option is enabled.
     HINSTANCE hInstance = nullptr;                              // Handle to the application instance.
     HWND hWnd = nullptr;                                        // Handle to the application window.
+    HWND hPerformanceHudWindow = nullptr;                       // Handle to the performance HUD window, only exists while the HUD is shown.
     std::unique_ptr<MyGraphicEngine> pGraphic;                  // Pointer to the graphic engine.
     std::unique_ptr<UIManager> pUIManager;                      // Pointer to the UI manager.
     std::vector<std::shared_ptr<MyWindow>> vNonClientWindows;   // Vector that holds pointers to the non-client windows.
     std::map<INT, std::shared_ptr<MyContainer>> mContainers;    // Map that holds pointers to the container windows.
     const LPCWSTR windowClassName = L"Win32GUISample";          // Application window class name.
     const std::wstring configurationFileName = L"settings.cfg"; // Configuration file name.
+    std::wstring configurationFilePath = L"";                   // Configuration file full path.
+    std::map<MyConfigKey, INT> commandLineOptions;              // Configuration options given on the command line, applied on top of the file options. (Never written, dropped once set from the UI)
+    MyFileWatcher configurationFileWatcher;                     // Configuration file watcher.
+    const std::wstring themePackFileName = L"themes.pack";      // Theme pack file name. (optional)
+    const std::wstring themeFileName = L"theme.cfg";            // Theme file name, the file is watched and reloaded on change. (optional)
+    std::wstring themeFilePath = L"";                           // Theme file full path.
+    MyFileWatcher themeFileWatcher;                             // Theme file watcher.
+    const std::wstring profileFileName = L"profile.json";       // Profiler trace file name, written on exit if the profiler is enabled. (Chrome trace event format)
+    const std::wstring inputRecordingFileName = L"input.rec";   // Input recording file name, written when the recording stops.
+    std::wstring inputRecordingFilePath = L"";                  // Input recording file full path.
+    const std::wstring snapshotFileName = L"startup.cache";     // Startup snapshot file name, written on exit if the snapshot misses an image decoded by the session.
+    std::wstring snapshotFilePath = L"";                        // Startup snapshot file full path.
+    const std::wstring startupTraceFileName = L"startup.json";  // Startup trace file name, written once the first frame is drawn if the option is enabled. (Chrome trace event format)
+    std::wstring startupTraceFilePath = L"";                    // Startup trace file full path.
+
+    inline static const UINT_PTR IDT_THEME_FILE_WATCHER = 1;         // Theme file watcher timer ID. (Application window)
+    inline static const UINT themeFileWatcherInterval = 100;         // Theme file watcher polling interval. (Milliseconds)
+    inline static const DOUBLE themeReloadLatencyBudget = 16.7;      // Theme reload-to-repaint latency budget, a warning is logged when exceeded. (Milliseconds)
+    inline static const UINT_PTR IDT_THEME_TRANSITION = 2;           // Theme transition timer ID. (Application window)
+    inline static const UINT themeTransitionDuration = 200;          // Theme transition duration. (Milliseconds)
+    inline static const UINT themeTransitionFrameInterval = 16;      // Theme transition frame interval. (Milliseconds)
+    inline static const DOUBLE themeTransitionFrameBudget = 16.7;    // Theme transition frame time budget, a warning is logged when the average exceeds it. (Milliseconds)
+    inline static const UINT_PTR IDT_CONFIGURATION_FILE_WATCHER = 3; // Configuration file watcher timer ID. (Application window)
+    inline static const UINT configurationFileWatcherInterval = 250; // Configuration file watcher polling interval. (Milliseconds)
+    inline static const UINT_PTR IDT_ALLOCATION_REPORT = 4;          // Allocation report timer ID. (Application window)
+    inline static const UINT_PTR IDT_PERFORMANCE_HUD = 5;            // Performance HUD sampling timer ID. (Application window)
+    inline static const UINT performanceHudInterval = 250;           // Performance HUD sampling interval. (Milliseconds)
+    inline static const UINT_PTR IDT_INPUT_REPLAY = 6;               // Input replay timer ID. (Application window)
+    inline static const UINT inputReplayInterval = 16;               // Input replay frame interval, one virtual clock step per tick. (Milliseconds, `INPUT_REPLAY_FRAME_TIME`)
+    inline static const DOUBLE startupTimeBudget = 500.0;            // Startup time budget, the timeline is logged as a warning when the first frame takes longer. (Milliseconds)
 
     // Application window parameters.
 
@@ -178,6 +320,14 @@ public:
     bool isWindowResizing = false;                    // Indicate whether the current window is resizing.
     bool isWindowMinimized = false;                   // Indicate whether the current window is minimized.
     bool isWindowMaximized = false;                   // Indicate whether the current window is maximized.
+    bool isThemeTransitionActive = false;             // Indicate whether a theme transition is in progress.
+
+    // Theme transition statistics.
+
+    LARGE_INTEGER themeTransitionStartTime = {}; // Performance counter value at the start of the current theme transition.
+    UINT themeTransitionFrameCount = 0;          // Number of frames drawn by the current theme transition.
+    DOUBLE themeTransitionTotalFrameTime = 0.0;  // Total frame time of the current theme transition. (Milliseconds)
+    DOUBLE themeTransitionMaxFrameTime = 0.0;    // Longest frame time of the current theme transition. (Milliseconds)
 
 private:
     inline static bool initialized = false;    // Indicate whether the application is initialized.
@@ -0,0 +1,286 @@
+/**
+ * @file config.h
+ * @brief Header file containing the portable configuration types. (Configuration schema, configuration store)
+ * @note Windows-free, only needs `portable_includes.h` and `text.h`. Shared by the application and the headless tools.
+ */
+
+#ifndef CONFIG_H
+#define CONFIG_H
+
+/***********************
+ * Configuration enums *
+ ***********************/
+
+/**
+ * @brief Keys of the application configuration options.
+ * @note The order matches the configuration schema. (See `MYCONFIGOPTION`)
+ */
+enum class MyConfigKey : UINT16
+{
+    Theme,
+    Debug,
+    LogFormat,
+    LogSegmentSize,
+    LogSegmentCount,
+    Profiler,
+    AllocationTracker,
+    PerformanceHud,
+    InputRecording,
+    StartupSnapshot,
+    StartupTrace,
+    Count,
+};
+
+enum class MyConfigValueType
+{
+    Integer,
+    Choice,
+};
+
+/****************************
+ * Configuration structures *
+ ****************************/
+
+/**
+ * @brief Schema of a configuration option.
+ * @note Every value is stored as an integer, choice options store the index of the choice.
+ */
+struct MYCONFIGOPTION
+{
+    /**
+     * @brief Check if the option schema is consistent.
+     * @return Returns true if the option schema is consistent, false otherwise.
+     */
+    constexpr bool isValid() const
+    {
+        if (!this->name || !this->name[0] || this->minimumValue > this->maximumValue)
+            return false;
+        if (this->defaultValue < this->minimumValue || this->defaultValue > this->maximumValue)
+            return false;
+        if (this->type == MyConfigValueType::Choice)
+        {
+            if (!this->pChoices || this->minimumValue != 0)
+                return false;
+            for (INT i = 0; i <= this->maximumValue; i++)
+            {
+                if (!this->pChoices[i] || !this->pChoices[i][0])
+                    return false;
+            }
+        }
+
+        return true;
+    }
+
+    const char *name;            // Option name, matched case-insensitively.
+    MyConfigValueType type;      // Option value type.
+    INT minimumValue;            // Minimum value. (Choice options: 0)
+    INT maximumValue;            // Maximum value. (Choice options: index of the last choice)
+    INT defaultValue;            // Default value. (Choice options: index of the default choice)
+    const char *const *pChoices; // Choice names, indexed by value. (Choice options only)
+};
+
+/**
+ * @brief A configuration change subscription.
+ * @note Exactly one of the callbacks is set.
+ */
+struct MYCONFIGSUBSCRIPTION
+{
+    UINT id;                                                                                         // Subscription ID.
+    std::bitset<static_cast<size_t>(MyConfigKey::Count)> keys;                                       // Mask of the watched options.
+    std::function<void(const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &)> batchCallback; // Called once per batch with the mask of the changed watched options.
+    std::function<void(INT)> valueCallback;                                                          // Called with the new value of the watched option. (Single option subscriptions)
+};
+
+/*************************
+ * Configuration classes *
+ *************************/
+
+/**
+ * @brief Typed configuration store validated against a compile-time schema.
+ * @note The configuration file is memory-mapped and parsed in place, keys and values are matched as spans without being copied.
+ *       The mapping is released once parsed, so the file can be replaced while the application is running.
+ * @note Values are looked up by `MyConfigKey` in constant time.
+ * @note Subscribers are notified of the changed options once per batch of changes, see `beginBatch()`.
+ * @note File format: `<Option name> = <Value>`, one option per line, lines starting with '#' are ignored.
+ * @note Portable, only `load()` uses the Windows API. (Implemented in config_file.cpp)
+ */
+class MyConfigStore
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR FUNCTIONS]
+
+    /**
+     * @brief Constructor.
+     * @note All the options are set to their default values.
+     * @param pSchema Pointer to the configuration schema, indexed by `MyConfigKey`. (See `validateSchema()`)
+     */
+    MyConfigStore(const MYCONFIGOPTION *pSchema);
+
+    // [UTILITY FUNCTIONS]
+
+    /**
+     * @brief Load the options from a configuration file.
+     * @note All the options are reset to their default values beforehand.
+     * @note Invalid lines and values are reported to the warning callback and skipped, the affected options keep their default values.
+     * @param filePath Specifies the configuration file path.
+     * @param isFileFound Reference to the variable that receives whether the configuration file exists. [OUT]
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @note A missing file is not an error.
+     */
+    bool load(const std::wstring &filePath, bool &isFileFound);
+
+    /**
+     * @brief Reset all the options to their default values.
+     * @note The options are no longer marked as defined. (See `isDefined()`)
+     */
+    void reset();
+
+    /**
+     * @brief Parse the options from a buffer in the configuration file format.
+     * @note The options not defined in the buffer are left unchanged.
+     * @note Invalid lines and values are reported to the warning callback and skipped. (See `setWarningCallback()`)
+     * @param pData Pointer to the buffer.
+     * @param size Specifies the buffer size in bytes.
+     * @return Returns the number of options successfully parsed.
+     */
+    UINT parse(const char *pData, size_t size);
+
+    /**
+     * @brief Serialize all the options in the configuration file format.
+     * @return Returns the configuration file content.
+     */
+    std::string serialize() const;
+
+    /**
+     * @brief Get the value of an option.
+     * @param key Specifies the option key.
+     * @return Returns the option value.
+     */
+    INT getValue(MyConfigKey key) const;
+
+    /**
+     * @brief Set the value of an option.
+     * @param key Specifies the option key.
+     * @param value Specifies the option value.
+     * @return Returns true if the value is valid for the option, false otherwise.
+     */
+    bool setValue(MyConfigKey key, INT value);
+
+    /**
+     * @brief Set the value of an option from its string representation.
+     * @param key Specifies the option key.
+     * @param value Specifies the option value string. (Integer options: decimal number, choice options: choice name)
+     * @return Returns true if the value is valid for the option, false otherwise.
+     */
+    bool setValue(MyConfigKey key, const std::string &value);
+
+    /**
+     * @brief Check if an option was defined by the last loaded configuration file.
+     * @param key Specifies the option key.
+     * @return Returns true if the option was defined, false if it holds its default value.
+     */
+    bool isDefined(MyConfigKey key) const;
+
+    /**
+     * @brief Find an option key by its name.
+     * @param name Specifies the option name. (Case-insensitive)
+     * @param key Reference to the variable that receives the option key. [OUT]
+     * @return Returns true if the option is found, false otherwise.
+     */
+    bool findKey(const std::string &name, MyConfigKey &key) const;
+
+    /**
+     * @brief Set the function called with the invalid lines and values skipped by `parse()`.
+     * @param callback Specifies the function called with the warning description and the line details.
+     */
+    void setWarningCallback(std::function<void(const std::string &, const std::string &)> callback);
+
+    // [SUBSCRIPTION FUNCTIONS]
+
+    /**
+     * @brief Subscribe to the changes of a set of options.
+     * @param keys Specifies the mask of the watched options.
+     * @param callback Specifies the function called once per batch with the mask of the changed watched options.
+     * @return Returns the subscription ID.
+     */
+    UINT subscribe(const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &keys, std::function<void(const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &)> callback);
+
+    /**
+     * @brief Subscribe to the changes of an option.
+     * @param key Specifies the watched option.
+     * @param callback Specifies the function called once per batch with the new value of the option.
+     * @return Returns the subscription ID.
+     */
+    UINT subscribe(MyConfigKey key, std::function<void(INT)> callback);
+
+    /**
+     * @brief Remove a subscription.
+     * @param subscriptionID Specifies the subscription ID.
+     * @return Returns true if the subscription is found and removed, false otherwise.
+     */
+    bool unsubscribe(UINT subscriptionID);
+
+    /**
+     * @brief Start a batch of changes.
+     * @note The subscribers are notified when the outermost batch ends, only the options whose values differ
+     *       from the start of the batch are reported. Batches can be nested.
+     * @note `load()`, `parse()` and `setValue()` are implicit batches.
+     */
+    void beginBatch();
+
+    /**
+     * @brief End a batch of changes and notify the subscribers of the changed options.
+     */
+    void endBatch();
+
+    /**
+     * @brief Validate a configuration schema at compile time.
+     * @param schema The configuration schema, indexed by `MyConfigKey`.
+     * @return Returns true if the schema defines every option key with a consistent option schema, false otherwise.
+     */
+    template <size_t N>
+    static constexpr bool validateSchema(const MYCONFIGOPTION (&schema)[N])
+    {
+        if (N != static_cast<size_t>(MyConfigKey::Count))
+            return false;
+        for (size_t i = 0; i < N; i++)
+        {
+            if (!schema[i].isValid())
+                return false;
+        }
+
+        return true;
+    }
+
+private:
+    /**
+     * @brief Find an option key by its name.
+     * @param pName Pointer to the option name. (Not null-terminated)
+     * @param size Specifies the option name size in bytes.
+     * @param key Reference to the variable that receives the option key. [OUT]
+     * @return Returns true if the option is found, false otherwise.
+     */
+    bool findKey(const char *pName, size_t size, MyConfigKey &key) const;
+
+    /**
+     * @brief Parse the value of an option.
+     * @param key Specifies the option key.
+     * @param pValue Pointer to the value string. (Not null-terminated)
+     * @param size Specifies the value string size in bytes.
+     * @param value Reference to the variable that receives the parsed value. [OUT]
+     * @return Returns true if the value is valid for the option, false otherwise.
+     */
+    bool parseValue(MyConfigKey key, const char *pValue, size_t size, INT &value) const;
+
+private:
+    const MYCONFIGOPTION *pSchema = nullptr;                                       // Pointer to the configuration schema.
+    INT values[static_cast<size_t>(MyConfigKey::Count)] = {};                      // Option values, indexed by `MyConfigKey`.
+    std::bitset<static_cast<size_t>(MyConfigKey::Count)> definedKeys;              // Mask of the options defined by the last loaded configuration file.
+    std::vector<MYCONFIGSUBSCRIPTION> subscriptions;                               // Configuration change subscriptions.
+    UINT nextSubscriptionID = 1;                                                   // ID of the next subscription.
+    UINT batchDepth = 0;                                                           // Nesting depth of the current batch.
+    INT batchValues[static_cast<size_t>(MyConfigKey::Count)] = {};                 // Option values at the start of the outermost batch.
+    std::function<void(const std::string &, const std::string &)> warningCallback; // Called with the invalid lines skipped by `parse()`. (Description, line details)
+};
+
+#endif // CONFIG_H
\ No newline at end of file
@@ -0,0 +1,112 @@
+/**
+ * @file config_file.h
+ * @brief Header file containing user-defined types that related to the configuration file. (Write-behind persistence)
+ * @note The portable configuration store is declared in config.h, its file mapping `MyConfigStore::load()` is implemented in config_file.cpp.
+ */
+
+#ifndef CONFIG_FILE_H
+#define CONFIG_FILE_H
+
+/******************************
+ * Configuration file classes *
+ ******************************/
+
+/**
+ * @brief Write-behind persistence for the configuration file.
+ * @note Submitted contents are written by a background thread, so the caller never blocks on disk I/O.
+ *       Bursts of submits are coalesced, only the latest content is written once no new content has been submitted
+ *       for `coalesceDelay`, or at the latest after `maximumWriteDelay`.
+ * @note The content is written to a temporary file which then atomically replaces the configuration file,
+ *       a crash during the write never leaves a truncated configuration file.
+ */
+class MyConfigWriter
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR FUNCTIONS]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyConfigWriter();
+
+    /**
+     * @brief Destructor.
+     * @note The pending content is written before the writer thread exits.
+     */
+    ~MyConfigWriter();
+
+    // [UTILITY FUNCTIONS]
+
+    /**
+     * @brief Start the writer thread.
+     * @param filePath Specifies the configuration file path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool start(const std::wstring &filePath);
+
+    /**
+     * @brief Write the pending content and stop the writer thread.
+     * @note Blocks until the pending content is written.
+     */
+    void stop();
+
+    /**
+     * @brief Submit the configuration file content to be written.
+     * @note Replaces any pending content that hasn't been written yet.
+     * @param content Specifies the configuration file content.
+     * @return Returns true if the content is submitted, false if the writer thread isn't running.
+     */
+    bool submit(std::string content);
+
+    /**
+     * @brief Get the number of submitted contents.
+     * @return Returns the number of submitted contents.
+     */
+    UINT getTotalSubmits();
+
+    /**
+     * @brief Get the number of configuration file writes.
+     * @return Returns the number of configuration file writes.
+     */
+    UINT getTotalWrites();
+
+    /**
+     * @brief Check if a configuration file content was produced by this writer.
+     * @note Used to ignore the configuration file change notifications caused by the writer's own writes.
+     * @param content Specifies the configuration file content.
+     * @return Returns true if the content matches the last submitted or the last written content, false otherwise.
+     */
+    bool isOwnContent(const std::string &content);
+
+private:
+    /**
+     * @brief The writer thread procedure.
+     * @param pParameter Pointer to the MyConfigWriter object.
+     * @return Returns 0.
+     */
+    static DWORD WINAPI writerThreadProcedure(LPVOID pParameter);
+
+    /**
+     * @brief Write the content to the temporary file and replace the configuration file with it.
+     * @param content Specifies the configuration file content.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool writeFile(const std::string &content);
+
+private:
+    std::wstring filePath = L"";                        // The configuration file path.
+    HANDLE hThread = nullptr;                           // Handle to the writer thread.
+    CRITICAL_SECTION lock;                              // Lock guarding the pending content and the writer state.
+    CONDITION_VARIABLE condition;                       // Signaled when content is submitted or the writer is stopping.
+    std::string pendingContent = "";                    // The pending content.
+    std::string lastSubmittedContent = "";              // The last submitted content.
+    std::string lastWrittenContent = "";                // The last content written to the configuration file.
+    bool isPending = false;                             // Indicate whether the pending content hasn't been written yet.
+    bool isStopping = false;                            // Indicate whether the writer thread is requested to stop.
+    UINT totalSubmits = 0;                              // Number of submitted contents.
+    UINT totalWrites = 0;                               // Number of configuration file writes.
+    inline static const DWORD coalesceDelay = 250;      // Quiet period before the pending content is written. (Milliseconds)
+    inline static const DWORD maximumWriteDelay = 1000; // Maximum delay between the first pending submit and the write. (Milliseconds)
+};
+
+#endif // CONFIG_FILE_H
\ No newline at end of file
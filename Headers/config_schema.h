@@ -0,0 +1,57 @@
+/**
+ * @file config_schema.h
+ * @brief Define the configuration file schema, shared by the application and the tools that load configuration files.
+ * @note Include after my_includes.h, or after the portable config.h and theme.h headers. (Headless tools)
+ */
+
+#ifndef CONFIG_SCHEMA_H
+#define CONFIG_SCHEMA_H
+
+/*****************************
+ * Configuration file schema *
+ *****************************/
+
+// Theme option choices, indexed by `MyTheme`.
+constexpr const char *APP_CONFIG_THEME_CHOICES[] = {"Light", "Dark", "Monokai"};
+
+// Log format option choices, indexed by `MyLogFormat`.
+constexpr const char *APP_CONFIG_LOG_FORMAT_CHOICES[] = {"Text", "Binary"};
+
+// Profiler option choices.
+constexpr const char *APP_CONFIG_PROFILER_CHOICES[] = {"Off", "On"};
+
+// Allocation tracker option choices.
+constexpr const char *APP_CONFIG_ALLOCATION_TRACKER_CHOICES[] = {"Off", "On"};
+
+// Performance HUD option choices.
+constexpr const char *APP_CONFIG_PERFORMANCE_HUD_CHOICES[] = {"Off", "On"};
+
+// Input recording option choices.
+constexpr const char *APP_CONFIG_INPUT_RECORDING_CHOICES[] = {"Off", "Record", "Replay", "ReplayAndExit"};
+
+// Startup snapshot option choices.
+constexpr const char *APP_CONFIG_STARTUP_SNAPSHOT_CHOICES[] = {"Off", "On"};
+
+// Startup trace option choices.
+constexpr const char *APP_CONFIG_STARTUP_TRACE_CHOICES[] = {"Off", "On"};
+
+// Configuration schema, indexed by `MyConfigKey`.
+constexpr MYCONFIGOPTION APP_CONFIG_SCHEMA[] =
+    {
+        {"Theme", MyConfigValueType::Choice, 0, 2, 2, APP_CONFIG_THEME_CHOICES},                          // Application theme. (Default: Monokai)
+        {"Debug", MyConfigValueType::Integer, 0, 2, 1, nullptr},                                          // Log level. (0: Disabled, 1: Info/Warn/Error, 2: Debug)
+        {"LogFormat", MyConfigValueType::Choice, 0, 1, 0, APP_CONFIG_LOG_FORMAT_CHOICES},                 // Log file format. (Default: Text)
+        {"LogSegmentSize", MyConfigValueType::Integer, 64, 262144, 1024, nullptr},                        // Log file segment size. (KiB)
+        {"LogSegmentCount", MyConfigValueType::Integer, 1, 32, 5, nullptr},                               // Maximum number of log file segments. (Disk usage: LogSegmentSize * LogSegmentCount)
+        {"Profiler", MyConfigValueType::Choice, 0, 1, 0, APP_CONFIG_PROFILER_CHOICES},                    // Frame timing profiler, the trace is written on exit. (Default: Off)
+        {"AllocationTracker", MyConfigValueType::Choice, 0, 1, 0, APP_CONFIG_ALLOCATION_TRACKER_CHOICES}, // Allocation tracker, the allocation rates per window message are logged every second, needs a build with ALLOCATION_TRACKING_COMPILE_ENABLED. (Default: Off)
+        {"PerformanceHud", MyConfigValueType::Choice, 0, 1, 0, APP_CONFIG_PERFORMANCE_HUD_CHOICES},       // Performance HUD overlay, toggled with F3. (Default: Off)
+        {"InputRecording", MyConfigValueType::Choice, 0, 3, 0, APP_CONFIG_INPUT_RECORDING_CHOICES},       // Input recording, the input messages are recorded to or replayed from the recording file. (Default: Off)
+        {"StartupSnapshot", MyConfigValueType::Choice, 0, 1, 0, APP_CONFIG_STARTUP_SNAPSHOT_CHOICES},     // Startup snapshot, the decoded images are cached on exit and restored on the next start. (Default: Off)
+        {"StartupTrace", MyConfigValueType::Choice, 0, 1, 0, APP_CONFIG_STARTUP_TRACE_CHOICES},           // Startup trace, the startup phase timeline is written to the startup trace file. (Default: Off)
+};
+
+static_assert(sizeof(APP_CONFIG_THEME_CHOICES) / sizeof(APP_CONFIG_THEME_CHOICES[0]) == static_cast<size_t>(MyTheme::Monokai) + 1, "The theme option must define a choice for every theme.");
+static_assert(MyConfigStore::validateSchema(APP_CONFIG_SCHEMA), "The configuration schema must define every option key with a consistent option schema.");
+
+#endif // CONFIG_SCHEMA_H
\ No newline at end of file
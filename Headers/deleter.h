@@ -0,0 +1,260 @@
+/**
+ * @file deleter.h
+ * @brief Header file containing the deleter structs of the smart pointers and their live resource counters.
+ */
+
+#ifndef DELETER_H
+#define DELETER_H
+
+/*****************
+ * Deleter enums *
+ *****************/
+
+/**
+ * @brief Resource types counted by the deleters. (See `Deleter::getResourceCounter()`)
+ */
+enum class MyResourceType
+{
+    Window,            // Window handles. (HWNDDeleter)
+    Brush,             // GDI brushes. (HBRUSHDeleter)
+    Font,              // GDI fonts. (HFONTDeleter)
+    Region,            // GDI regions. (HRGNDeleter)
+    Storyboard,        // Animation storyboards. (IUIAnimationStoryboardDeleter)
+    AnimationVariable, // Animation variables. (IUIAnimationVariableDeleter)
+    Transition,        // Animation transitions. (IUIAnimationTransitionDeleter)
+    WicBitmapSource,   // WIC bitmap sources. (IWICBitmapSourceDeleter)
+    TextFormat,        // DirectWrite text formats. (IDWriteTextFormatDeleter)
+    RenderTarget,      // Direct2D DC render targets. (ID2D1DCRenderTargetDeleter)
+    SolidColorBrush,   // Direct2D solid color brushes. (ID2D1SolidColorBrushDeleter)
+    Bitmap,            // Direct2D bitmaps. (ID2D1BitmapDeleter)
+    Count,
+};
+
+/*******************************
+ * Resource counter structures *
+ *******************************/
+
+/**
+ * @brief Live resource counters of a resource type. (See `MyResourceType`)
+ */
+struct MYRESOURCECOUNTER
+{
+    UINT64 liveResources;     // Number of resources not released yet.
+    UINT64 peakResources;     // Highest number of live resources.
+    UINT64 createdResources;  // Number of created resources.
+    UINT64 releasedResources; // Number of released resources.
+    UINT64 untrackedReleases; // Number of released resources that weren't counted as created. (Uncounted creation sites)
+};
+
+/****************************************
+ * Deleter structs (for smart pointers) *
+ ****************************************/
+
+// Deleter base struct:
+
+template <typename Type>
+class MyResourceOutput;
+
+/**
+ * @brief Deleter base struct, keeps the live resource counters of every resource type.
+ * @note The deleters count the released resources, the created resources are counted where they are created,
+ *       either by the engine factories or by passing the holder through `track()` to the creating function.
+ */
+struct Deleter
+{
+    /**
+     * @brief Set the logger of the deleter records.
+     * @note The deleters write to the application logger, a second logger of the same log file would overwrite its records.
+     * @param pLogger Specifies the logger, nullptr to drop the deleter records.
+     */
+    static void setLogger(MyLogger *pLogger);
+
+    /**
+     * @brief Stop writing the deleter records to a logger being destroyed.
+     * @note Called by the logger destructor, the deleter logger is only reset if it is the specified logger.
+     * @param pLogger Specifies the logger.
+     */
+    static void detachLogger(MyLogger *pLogger);
+
+    /**
+     * @brief Write a deleter record to the deleter logger, the record is dropped if no logger is set.
+     * @param description Specifies the log description.
+     * @param extraDescription Specifies the extra log description.
+     * @param logType Specifies the log type.
+     */
+    static void writeLog(std::string description, std::string extraDescription, MyLogType logType);
+
+    /**
+     * @brief Count a created resource.
+     * @param resourceType Specifies the resource type.
+     */
+    static void onResourceCreated(MyResourceType resourceType);
+
+    /**
+     * @brief Count a released resource.
+     * @note A release without a live resource is counted as an untracked release, its creation site doesn't count the resources.
+     * @param resourceType Specifies the resource type.
+     */
+    static void onResourceReleased(MyResourceType resourceType);
+
+    /**
+     * @brief Get the counters of a resource type.
+     * @param resourceType Specifies the resource type.
+     * @return Returns the counters of the resource type.
+     */
+    static MYRESOURCECOUNTER getResourceCounter(MyResourceType resourceType);
+
+    /**
+     * @brief Write the counters of the resource types that had resources, with the creation rates since the previous call.
+     * @note The resource types with untracked releases are reported as warnings.
+     * @param logger Specifies the logger.
+     * @return Returns the total number of live resources.
+     */
+    static UINT64 writeResourceCounters(MyLogger &logger);
+
+    /**
+     * @brief Count the resource a creating function writes to a holder.
+     * @note The resource is counted after the creating function returns, if the holder was empty and is no longer empty.
+     *       Example: hr = pRenderTarget->CreateSolidColorBrush(color, Deleter::track(p_brush));
+     * @param pHolder Specifies the holder.
+     * @return Returns the output argument of the creating function, converts to the pointer to the held pointer.
+     */
+    template <typename Type, typename TypeDeleter>
+    static MyResourceOutput<Type> track(std::unique_ptr<Type *, TypeDeleter> &pHolder)
+    {
+        return MyResourceOutput<Type>(*pHolder, TypeDeleter::resourceType);
+    }
+
+private:
+    inline static const size_t totalResourceTypes = static_cast<size_t>(MyResourceType::Count); // Number of resource types.
+    inline static std::atomic<UINT64> liveResources[totalResourceTypes] = {};                   // Number of live resources, indexed by resource type.
+    inline static std::atomic<UINT64> peakResources[totalResourceTypes] = {};                   // Highest number of live resources, indexed by resource type.
+    inline static std::atomic<UINT64> createdResources[totalResourceTypes] = {};                // Number of created resources, indexed by resource type.
+    inline static std::atomic<UINT64> releasedResources[totalResourceTypes] = {};               // Number of released resources, indexed by resource type.
+    inline static std::atomic<UINT64> untrackedReleases[totalResourceTypes] = {};               // Number of released resources that weren't counted as created, indexed by resource type.
+    inline static UINT64 reportedCreatedResources[totalResourceTypes] = {};                     // Number of created resources at the previous `writeResourceCounters()` call.
+    inline static ULONGLONG lastReportTime = GetTickCount64();                                  // Time of the previous `writeResourceCounters()` call or of the application start. (Milliseconds)
+    inline static std::atomic<MyLogger *> pLogger{nullptr};                                     // Logger of the deleter records. (See `setLogger()`)
+};
+
+/**
+ * @brief Output argument of a creating function, counts the created resource when destroyed. (See `Deleter::track()`)
+ */
+template <typename Type>
+class MyResourceOutput
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param variable Specifies the held pointer.
+     * @param resourceType Specifies the resource type.
+     */
+    MyResourceOutput(Type *&variable, MyResourceType resourceType)
+        : pVariable(&variable), resourceType(resourceType), isEmpty(!variable) {}
+
+    /**
+     * @brief Destructor.
+     * @note Destroyed at the end of the full expression, after the creating function returns.
+     */
+    ~MyResourceOutput()
+    {
+        if (this->isEmpty && *this->pVariable)
+            Deleter::onResourceCreated(this->resourceType);
+    }
+
+    MyResourceOutput(const MyResourceOutput &) = delete;
+    MyResourceOutput &operator=(const MyResourceOutput &) = delete;
+
+    operator Type **() const
+    {
+        return this->pVariable;
+    }
+
+private:
+    Type **pVariable;            // Held pointer.
+    MyResourceType resourceType; // Resource type.
+    bool isEmpty;                // Indicate whether the holder was empty.
+};
+
+// WinAPI deleters:
+
+struct HWNDDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::Window;
+    void operator()(HWND *variable) const;
+};
+struct HBRUSHDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::Brush;
+    void operator()(HBRUSH *variable) const;
+};
+struct HFONTDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::Font;
+    void operator()(HFONT *variable) const;
+};
+struct HRGNDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::Region;
+    void operator()(HRGN *variable) const;
+};
+
+// WAM deleters:
+
+struct IUIAnimationStoryboardDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::Storyboard;
+    void operator()(IUIAnimationStoryboard **variable) const;
+};
+struct IUIAnimationVariableDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::AnimationVariable;
+    void operator()(IUIAnimationVariable **variable) const;
+};
+struct IUIAnimationTransitionDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::Transition;
+    void operator()(IUIAnimationTransition **variable) const;
+};
+
+// Direct2D/DirectWrite deleters:
+
+struct IWICBitmapSourceDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::WicBitmapSource;
+    void operator()(IWICBitmapSource **variable) const;
+};
+struct IDWriteTextFormatDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::TextFormat;
+    void operator()(IDWriteTextFormat **variable) const;
+};
+struct ID2D1DCRenderTargetDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::RenderTarget;
+    void operator()(ID2D1DCRenderTarget **variable) const;
+};
+struct ID2D1SolidColorBrushDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::SolidColorBrush;
+    void operator()(ID2D1SolidColorBrush **variable) const;
+};
+struct ID2D1BitmapDeleter : public Deleter
+{
+    inline static bool debugMode = false;
+    inline static const MyResourceType resourceType = MyResourceType::Bitmap;
+    void operator()(ID2D1Bitmap **variable) const;
+};
+
+#endif // DELETER_H
\ No newline at end of file
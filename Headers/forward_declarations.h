@@ -36,5 +36,6 @@ class MyContainer;
 
 LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT msg, WPARAM wp, LPARAM lp);
 LRESULT CALLBACK DefaultContainerProcedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam, UINT_PTR idSubclass, DWORD_PTR refData);
+LRESULT CALLBACK PerformanceHudProcedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam, UINT_PTR idSubclass, DWORD_PTR refData);
 
 #endif // FORWARD_DECLARATIONS_H
\ No newline at end of file
@@ -56,12 +56,60 @@ public:
     UINT imageHeight;
 };
 
+/**
+ * @brief A solid brush of the solid brush pool. (See `MySolidBrushPool`)
+ */
+struct MYPOOLEDBRUSH
+{
+    std::unique_ptr<HBRUSH, HBRUSHDeleter> pBrush; // The brush.
+    UINT64 lastUse = 0;                            // Request number of the last request of the brush.
+};
+
 /***************************
  * Graphic-related classes *
  ***************************/
 
 /**
- * @brief Represents a color. (Wrapped COLORREF, HBRUSH, D2D1::ColorF)
+ * @brief Process-wide pool of GDI solid brushes, keyed by color value.
+ * @note Brushes are created on first request and shared by every color with the same RGB value.
+ * @note The pool holds at most `maximumBrushes` brushes, the least recently used brush is deleted to make room for a new one.
+ *       The intermediate colors of the theme transitions and the theme file edits are evicted this way.
+ * @note Must only be accessed from the UI thread.
+ */
+class MySolidBrushPool
+{
+public:
+    // [UTILITY FUNCTIONS]
+
+    /**
+     * @brief Get the solid brush of the specified color, creating it if it is not pooled yet.
+     * @param colorref Specifies the color of the brush.
+     * @return Returns the solid brush handle, or nullptr if the brush creation failed.
+     * @note The brush is owned by the pool, do not delete it. Use it right away, it may be evicted by a later request.
+     */
+    static HBRUSH getBrush(COLORREF colorref);
+
+    /**
+     * @brief Get the number of pooled brushes.
+     * @return Returns the number of pooled brushes.
+     */
+    static size_t getBrushCount();
+
+    /**
+     * @brief Release all the pooled brushes.
+     * @note Previously returned brush handles become invalid.
+     */
+    static void release();
+
+private:
+    inline static std::unordered_map<COLORREF, MYPOOLEDBRUSH> brushes; // Pooled solid brushes.
+    inline static UINT64 totalRequests = 0;                           // Number of brush requests, the use stamp of the brushes.
+    inline static const size_t maximumBrushes = 64;                   // Maximum number of pooled brushes.
+};
+
+/**
+ * @brief Represents a color. (Packed RGBA, convertible to COLORREF, HBRUSH, D2D1::ColorF)
+ * @note Only the packed RGBA value is stored, the native variants are produced on request.
  */
 class MyColor
 {
@@ -83,18 +131,6 @@ public:
      */
     MyColor(BYTE red, BYTE green, BYTE blue, BYTE alpha = 255);
 
-    /**
-     * @brief Copy constructor.
-     * @param other The object to be copied.
-     */
-    MyColor(const MyColor &other);
-
-    /**
-     * @brief Assignment operator.
-     * @param other The object to be assigned.
-     */
-    MyColor &operator=(const MyColor &other);
-
     // [UTILITY FUNCTIONS]
 
     /**
@@ -108,55 +144,66 @@ public:
      * @brief Get the red value of the color.
      * @return Returns the red value of the color.
      */
-    const BYTE &getRed();
+    BYTE getRed() const;
 
     /**
      * @brief Get the green value of the color.
      * @return Returns the green value of the color.
      */
-    const BYTE &getGreen();
+    BYTE getGreen() const;
 
     /**
      * @brief Get the blue value of the color.
      * @return Returns the blue value of the color.
      */
-    const BYTE &getBlue();
+    BYTE getBlue() const;
 
     /**
      * @brief Get the alpha value of the color.
      * @return Returns the alpha value of the color.
      */
-    const BYTE &getAlpha();
+    BYTE getAlpha() const;
+
+    /**
+     * @brief Get the packed RGBA value of the color.
+     * @return Returns the packed RGBA value of the color. (0xAABBGGRR)
+     */
+    UINT32 getPackedRGBA() const;
 
     /**
      * @brief Get the COLORREF variant of the color.
      * @return Returns the COLORREF variant of the color.
      */
-    const COLORREF &getCOLORREF();
+    COLORREF getCOLORREF() const;
 
     /**
      * @brief Get the HBRUSH variant of the color.
-     * @return Returns the HBRUSH variant of the color.
-     * @note Solid brush.
+     * @return Returns the HBRUSH variant of the color, or nullptr if the brush creation failed.
+     * @note Solid brush, owned by the MySolidBrushPool class.
      */
-    const HBRUSH &getSolidBrush();
+    HBRUSH getSolidBrush() const;
 
     /**
      * @brief Get the D2D1::ColorF variant of the color.
      * @return Returns the D2D1::ColorF variant of the color.
      */
-    const D2D1::ColorF &getD2D1Color();
+    D2D1::ColorF getD2D1Color() const;
+
+    /**
+     * @brief Pack the RGBA values into a single value.
+     * @param rgba The RGBA structure contains basic color information. (Reference)
+     * @return Returns the packed RGBA value. (0xAABBGGRR)
+     */
+    static UINT32 pack(const MYRGBA &rgba);
 
 private:
-    MYRGBA rgba;                                        // RGBA values of the color.
-    COLORREF colorref;                                  // COLORREF variant of the color.
-    std::unique_ptr<HBRUSH, HBRUSHDeleter> pSolidBrush; // HBRUSH (solid brush) variant of the color.
-    D2D1::ColorF d2d1Color = D2D1::ColorF(0, 0, 0, 0);  // D2D1::ColorF variant of the color.
+    UINT32 packedRGBA = 0; // Packed RGBA values of the color. (0xAABBGGRR, the low 24 bits match the COLORREF layout)
 };
 
 /**
  * @brief Wrapped IWICBitmapSource.
  * @note Used to create ID2D1Bitmap objects for Direct 2D drawing operations.
+ * @note The image is decoded on first use, or ahead of time by `decode()` on a worker thread. (See `UIImages::prefetchImages()`)
  */
 class MyWICBitmap
 {
@@ -194,11 +241,45 @@ public:
 
     /**
      * @brief Update the bitmap.
+     * @note The decoded image is released, the new image is decoded on first use.
      * @param imageInfo The MYIMAGEINFO structure contains image information. (Reference)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
     bool update(const MYIMAGEINFO &imageInfo);
 
+    /**
+     * @brief Decode the image if it is not decoded yet.
+     * @note Thread-safe, a concurrent call waits for the decode in progress.
+     * @note The pixels are restored from the startup snapshot if it holds the image.
+     * @return Returns true if the image is decoded, false otherwise.
+     */
+    bool decode();
+
+    /**
+     * @brief Check if the image is decoded.
+     * @return Returns true if the image is decoded, false otherwise.
+     */
+    bool isDecoded();
+
+    /**
+     * @brief Copy the decoded pixels. (32bpp PBGRA, top-down rows)
+     * @param pixels Reference to the string that receives the pixels. [OUT]
+     * @return Returns true if the image is decoded and its pixels are copied, false otherwise.
+     */
+    bool copyPixels(std::string &pixels);
+
+    /**
+     * @brief Get the startup snapshot key of the image. (See `MyStartupSnapshot`)
+     * @return Returns the key, derived from the resource ID and the image size.
+     */
+    UINT64 getSnapshotKey() const;
+
+    /**
+     * @brief Get the number of decoded images since the application start.
+     * @return Returns the number of decoded images.
+     */
+    static UINT getTotalDecodes();
+
     /**
      * @brief Get the bitmap information (width, height, resource type, etc).
      * @return Returns the MYIMAGEINFO struct contains the information.
@@ -207,13 +288,16 @@ public:
 
     /**
      * @brief Get the wic bitmap source (IWICBitmapSource *).
-     * @return Returns the wic bitmap source.
+     * @note Decodes the image if it is not decoded yet.
+     * @return Returns the wic bitmap source, or nullptr if the image failed to decode.
      */
     IWICBitmapSource *getBitmapSource();
 
 private:
     MYIMAGEINFO imageInfo;                                                // Image informations.
-    std::unique_ptr<IWICBitmapSource *, IWICBitmapSourceDeleter> pBitmap; // Wic bitmap source.
+    std::unique_ptr<IWICBitmapSource *, IWICBitmapSourceDeleter> pBitmap; // Wic bitmap source, null until the image is decoded.
+    SRWLOCK decodeLock = SRWLOCK_INIT;                                    // Guards the wic bitmap source.
+    inline static std::atomic<UINT> totalDecodes{0};                      // Number of decoded images since the application start.
 };
 
 /*******************
@@ -512,6 +596,16 @@ public:
      */
     bool drawText(ID2D1DCRenderTarget *&pRenderTarget, IDWriteTextFormat *&pTextFormat, D2D1_RECT_F rect, std::wstring text, ID2D1SolidColorBrush *&pBrushText, FLOAT posX = 0, FLOAT posY = 0, UINT centerMode = 0);
 
+    /**
+     * @brief Get the number of text layouts created by `drawText()`.
+     * @note The text layouts are not cached, every drawn text creates one. (See `MyPerformanceHud`)
+     * @return Returns the number of created text layouts.
+     */
+    UINT64 getTotalTextLayouts() const
+    {
+        return this->totalTextLayouts;
+    }
+
     /**
      * @brief Draw a image.
      * @param pRenderTarget Reference to the render target pointer.
@@ -533,6 +627,7 @@ private:
     ID2D1Factory *pD2D1Factory = nullptr;            // The Direct2D factory.
     IDWriteFactory *pDWriteFactory = nullptr;        // The DirectWrite factory.
     IWICImagingFactory2 *pWICImageFactory = nullptr; // The WIC Image factory.
+    UINT64 totalTextLayouts = 0;                     // Number of text layouts created by `drawText()`. (UI thread)
 };
 
 /**
@@ -0,0 +1,224 @@
+/**
+ * @file input_recorder.h
+ * @brief Header file containing user-defined types that related to input recording. (Deterministic input recording and replay)
+ */
+
+#ifndef INPUT_RECORDER_H
+#define INPUT_RECORDER_H
+
+/*****************************
+ * Input recorder structures *
+ *****************************/
+
+/**
+ * @brief Input recording file header. (See `INPUT_RECORDING_SIGNATURE`)
+ */
+struct MYINPUTRECORDINGHEADER
+{
+    UINT32 signature;    // File signature. (INPUT_RECORDING_SIGNATURE)
+    UINT32 version;      // File format version. (INPUT_RECORDING_VERSION)
+    INT32 windowX;       // Application window x-coordinate at the recording start.
+    INT32 windowY;       // Application window y-coordinate at the recording start.
+    UINT32 windowWidth;  // Application window width at the recording start.
+    UINT32 windowHeight; // Application window height at the recording start.
+};
+
+/**
+ * @brief A recorded input message. (See `MyInputRecorder`)
+ * @note The target window is identified by its control ID and the control ID of its parent window.
+ */
+struct MYINPUTRECORD
+{
+    UINT64 time;            // Time since the recording start. (Microseconds)
+    UINT32 controlId;       // Control ID of the target window.
+    UINT32 parentControlId; // Control ID of the target window parent, 0 for the application window.
+    UINT32 message;         // Window message.
+    UINT32 flags;           // Record flags. (INPUT_RECORD_*)
+    UINT64 wParam;          // The first message parameter.
+    INT64 lParam;           // The second message parameter.
+};
+
+/**************************
+ * Input recorder classes *
+ **************************/
+
+/**
+ * @brief Input recorder, records the input messages reaching the window procedures and replays them against a virtual clock.
+ * @note The window procedures report their input messages with `MyInputScope`. Only the outermost input message of a dispatch
+ *       is recorded, the messages sent while processing it (e.g. a mouse wheel message forwarded to the parent) are replayed by it.
+ * @note While a replay is in progress, the live input messages except WM_SIZE are dropped so they don't interfere with the replayed session.
+ *       Every replay frame advances the virtual clock by `INPUT_REPLAY_FRAME_TIME`, the same records are dispatched in the same frames on every run.
+ * @note Used on the UI thread only.
+ */
+class MyInputRecorder
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR/..]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyInputRecorder();
+
+    // [INPUT RECORDING FUNCTIONS]
+
+    /**
+     * @brief Check if the recorder records the input messages.
+     * @return Returns true if a recording is in progress, false otherwise.
+     */
+    bool isRecording() const
+    {
+        return this->isRecordingActive;
+    }
+
+    /**
+     * @brief Check if a replay is in progress.
+     * @return Returns true if a replay is in progress, false otherwise.
+     */
+    bool isReplaying() const
+    {
+        return this->isReplayActive;
+    }
+
+    /**
+     * @brief Check if a window message is recorded.
+     * @param message Specifies the window message.
+     * @return Returns true if the message is an input message, false otherwise.
+     */
+    static bool isInputMessage(UINT message);
+
+    /**
+     * @brief Start recording the input messages, the previous records are discarded.
+     * @param windowRect Specifies the application window rectangle, restored by the replay.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool startRecording(const RECT &windowRect);
+
+    /**
+     * @brief Stop recording and write the recording file.
+     * @param filePath Specifies the recording file path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool stopRecording(const std::wstring &filePath);
+
+    /**
+     * @brief Load a recording file and start replaying it.
+     * @param filePath Specifies the recording file path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool startReplay(const std::wstring &filePath);
+
+    /**
+     * @brief Stop the replay, the remaining records are discarded.
+     */
+    void stopReplay();
+
+    /**
+     * @brief Advance the replay virtual clock by one frame and dispatch the records due by then.
+     * @param dispatch Specifies the function that sends a record to its target window, returns false if the target is not found.
+     * @return Returns true if records remain, false if the replay is finished.
+     */
+    bool advanceReplay(const std::function<bool(const MYINPUTRECORD &)> &dispatch);
+
+    /**
+     * @brief Get the header of the recording being replayed.
+     * @return Returns the recording header.
+     */
+    const MYINPUTRECORDINGHEADER &getReplayHeader() const
+    {
+        return this->replayHeader;
+    }
+
+    /**
+     * @brief Get the replay statistics.
+     * @param totalRecords Reference to the variable that receives the number of records. [OUT]
+     * @param totalSkippedRecords Reference to the variable that receives the number of records whose target was not found. [OUT]
+     * @param totalFrames Reference to the variable that receives the number of replayed frames. [OUT]
+     */
+    void getReplayStatistics(size_t &totalRecords, size_t &totalSkippedRecords, UINT64 &totalFrames) const;
+
+    /**
+     * @brief Enter an input message. (See `MyInputScope`)
+     * @note The message is recorded if a recording is in progress and no other input message is being processed.
+     * @param hWnd Specifies the window handle.
+     * @param message Specifies the window message.
+     * @param wParam Specifies the first message parameter.
+     * @param lParam Specifies the second message parameter.
+     * @return Returns true if the message should be dropped, false otherwise.
+     */
+    bool enterInput(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam);
+
+    /**
+     * @brief Leave the input message entered last. (See `MyInputScope`)
+     */
+    void leaveInput()
+    {
+        this->inputDepth--;
+    }
+
+private:
+    bool isRecordingActive = false;              // Indicate whether a recording is in progress.
+    bool isReplayActive = false;                 // Indicate whether a replay is in progress.
+    bool isDispatching = false;                  // Indicate whether the replay is dispatching a record.
+    UINT inputDepth = 0;                         // Number of input messages being processed. (Nested dispatches)
+    LONGLONG counterFrequency = 1;               // Performance counter frequency.
+    LONGLONG recordingStartTime = 0;             // Performance counter value at the recording start.
+    MYINPUTRECORDINGHEADER recordingHeader = {}; // Header of the recording in progress.
+    MYINPUTRECORDINGHEADER replayHeader = {};    // Header of the recording being replayed.
+    std::vector<MYINPUTRECORD> records;          // Records of the recording in progress, or of the recording being replayed.
+    size_t replayPosition = 0;                   // Index of the next record to replay.
+    UINT64 replayTime = 0;                       // Replay virtual clock. (Microseconds)
+    size_t totalReplayRecords = 0;               // Number of records of the recording being replayed.
+    UINT64 totalReplayFrames = 0;                // Number of replayed frames.
+    size_t totalSkippedRecords = 0;              // Number of replayed records whose target was not found.
+};
+
+/**
+ * @brief Input message scope, reports a window message to the input recorder until destroyed.
+ * @note The non-input messages are ignored.
+ */
+class MyInputScope
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param recorder Specifies the input recorder.
+     * @param hWnd Specifies the window handle.
+     * @param message Specifies the window message.
+     * @param wParam Specifies the first message parameter.
+     * @param lParam Specifies the second message parameter.
+     */
+    MyInputScope(MyInputRecorder &recorder, HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
+        : pRecorder(MyInputRecorder::isInputMessage(message) ? &recorder : nullptr)
+    {
+        if (this->pRecorder)
+            this->isDroppedMessage = this->pRecorder->enterInput(hWnd, message, wParam, lParam);
+    }
+
+    /**
+     * @brief Destructor.
+     */
+    ~MyInputScope()
+    {
+        if (this->pRecorder)
+            this->pRecorder->leaveInput();
+    }
+
+    /**
+     * @brief Check if the window procedure should drop the message. (Live input during a replay)
+     * @return Returns true if the message should be dropped, false otherwise.
+     */
+    bool isDropped() const
+    {
+        return this->isDroppedMessage;
+    }
+
+    MyInputScope(const MyInputScope &) = delete;
+    MyInputScope &operator=(const MyInputScope &) = delete;
+
+private:
+    MyInputRecorder *pRecorder;    // The input recorder, null if the message is not an input message.
+    bool isDroppedMessage = false; // Indicate whether the message should be dropped.
+};
+
+#endif // INPUT_RECORDER_H
\ No newline at end of file
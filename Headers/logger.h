@@ -0,0 +1,663 @@
+/**
+ * @file logger.h
+ * @brief Header file containing user-defined types that related to logging. (Asynchronous logger, binary log format, log segment files)
+ */
+
+#ifndef LOGGER_H
+#define LOGGER_H
+
+/****************
+ * Logger enums *
+ ****************/
+
+enum class MyLogType
+{
+    Info,
+    Warn,
+    Error,
+    Debug,
+};
+
+/**
+ * @brief What the asynchronous logger does with a record when its ring buffer is full.
+ */
+enum class MyLogOverflowPolicy
+{
+    Drop,  // Drop the record immediately.
+    Block, // Wait for the flush thread to free a slot, drop the record if it takes too long.
+};
+
+/**
+ * @brief Log file formats.
+ */
+enum class MyLogFormat
+{
+    Text,   // Human-readable text records. (log.log)
+    Binary, // Binary structured records, formatted offline by the log decoder tool. (log.bin)
+};
+
+/*********************
+ * Logger structures *
+ *********************/
+
+/**
+ * @brief A slot of the asynchronous logger ring buffer.
+ */
+struct MYLOGRECORD
+{
+    std::atomic<size_t> sequence; // Slot sequence number, synchronizes the producers and the flush thread.
+    time_t time;                  // Record time.
+    MyLogType logType;            // Record log type.
+    bool isCustom;                // Indicate whether the record is a custom record. (No log type)
+    bool includeTime;             // Indicate whether to include the time string. (Custom records)
+    bool isBinary;                // Indicate whether the text holds an encoded binary event record.
+    std::string text;             // Record text.
+};
+
+/**
+ * @brief Rate limit state of a repeated log record. (See `MyLogger::writeLimitedLog()`)
+ */
+struct MYLOGRATELIMIT
+{
+    MyLogType logType;            // Record log type.
+    std::string text;             // Record text. (Description and extra description)
+    ULONGLONG lastRefillTime;     // Time of the last token bucket refill. (Milliseconds)
+    ULONGLONG credit;             // Token bucket credit, writing a record costs `rateLimitInterval`. (Milliseconds)
+    ULONGLONG lastSuppressedTime; // Time of the last suppressed record. (Milliseconds)
+    UINT totalSuppressedRecords;  // Number of records suppressed since the last written record.
+};
+
+/**
+ * @brief A structured log call site.
+ * @note The descriptions are static strings, each `{}` placeholder is replaced by the next record argument when the record is formatted.
+ */
+struct MYLOGCALLSITE
+{
+    MyLogType logType;            // Record log type.
+    bool isCustom;                // Indicate whether the records are custom records. (No log type)
+    bool includeTime;             // Indicate whether to include the time string. (Custom records)
+    const char *description;      // Record description.
+    const char *extraDescription; // Record extra description, appended after a space if not empty.
+};
+
+/******************
+ * Logger classes *
+ ******************/
+
+/**
+ * @brief Size-capped, rotating log file made of preallocated memory-mapped segments.
+ * @note The current segment is preallocated to the segment size and appended through a memory mapping, without a system call per write.
+ *       When it is full it is renamed to `<name>.1<extension>`, the older segments shift up and the oldest segment is deleted.
+ * @note The segment is truncated to its written size when it is closed. A segment left at its preallocated size (crash) is rotated
+ *       on the next open, its unwritten tail stays zero-filled.
+ * @note Not thread-safe.
+ */
+class MyLogSegmentFile
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR FUNCTIONS]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyLogSegmentFile();
+
+    /**
+     * @brief Destructor.
+     * @note The current segment is closed.
+     */
+    ~MyLogSegmentFile();
+
+    // [UTILITY FUNCTIONS]
+
+    /**
+     * @brief Open the current segment, the writes are appended after its existing content.
+     * @param filePath Specifies the current segment path.
+     * @param segmentSize Specifies the segment size. (Bytes)
+     * @param segmentCount Specifies the maximum number of segments, including the current segment.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool open(const std::wstring &filePath, size_t segmentSize, UINT segmentCount);
+
+    /**
+     * @brief Close the current segment, truncated to its written size.
+     */
+    void close();
+
+    /**
+     * @brief Close the current segment, shift the segments and open a new empty current segment.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool rotate();
+
+    /**
+     * @brief Append data to the current segment.
+     * @param pData Pointer to the data.
+     * @param size Specifies the data size. (Bytes)
+     * @return Returns true if the data is appended, false if the segment isn't open or the data doesn't fit. (See `getFreeSize()`)
+     */
+    bool write(const char *pData, size_t size);
+
+    /**
+     * @brief Check if the current segment is open.
+     * @return Returns true if the current segment is open, false otherwise.
+     */
+    bool isOpen();
+
+    /**
+     * @brief Get the written size of the current segment.
+     * @return Returns the written size. (Bytes)
+     */
+    size_t getWrittenSize();
+
+    /**
+     * @brief Get the free size of the current segment.
+     * @return Returns the free size. (Bytes)
+     */
+    size_t getFreeSize();
+
+    /**
+     * @brief Get the number of rotations.
+     * @return Returns the number of rotations.
+     */
+    UINT getTotalRotations();
+
+private:
+    /**
+     * @brief Get the path of a segment.
+     * @param index Specifies the segment index. (0: Current segment)
+     * @return Returns the segment path.
+     */
+    std::wstring getSegmentPath(UINT index);
+
+    /**
+     * @brief Shift the closed segments, deleting the oldest segment.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool shiftSegments();
+
+private:
+    std::wstring filePath = L""; // The current segment path.
+    size_t segmentSize = 0;      // Segment size. (Bytes)
+    UINT segmentCount = 0;       // Maximum number of segments, including the current segment.
+    HANDLE hFile = nullptr;      // Handle to the current segment file.
+    HANDLE hMapping = nullptr;   // Handle to the current segment file mapping.
+    char *pView = nullptr;       // Pointer to the current segment mapped view.
+    size_t writtenSize = 0;      // Written size of the current segment. (Bytes)
+    UINT totalRotations = 0;     // Number of rotations.
+};
+
+/**
+ * @brief Simple logging utility for handling application logs.
+ */
+class MyLogger
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR/..]
+
+    /**
+     * @brief Default constructor.
+     * @note Use command line path as logging path by default.
+     */
+    MyLogger();
+
+    /**
+     * @brief Constructor 1.
+     * @param path Specifies the custom logging path.
+     */
+    MyLogger(std::wstring path);
+
+    /**
+     * @brief Destructor.
+     * @note The asynchronous mode is stopped and the pending records are written.
+     */
+    ~MyLogger();
+
+    // [LOGGING FUNCTIONS]
+
+    /**
+     * @brief Get the current log level.
+     * @return Returns the current log level.
+     */
+    int getLogLevel();
+
+    /**
+     * @brief Set a new logging path.
+     * @note Set to empty string to use command line path.
+     * @param path Specifies the custom logging path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool setPath(std::wstring path = L"");
+
+    /**
+     * @brief Set a new log level.
+     * @param logLevel Specifies the log level.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool setLogLevel(int logLevel = 1);
+
+    /**
+     * @brief Set a new log file name.
+     * @param logFileName Specifies the log file name.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool setLogFileName(std::wstring logFileName = L"log.log");
+
+    /**
+     * @brief Get the log level required to write the records of a log type.
+     * @param logType Specifies the log type.
+     * @return Returns the required log level.
+     */
+    static constexpr int getLogTypeLevel(MyLogType logType)
+    {
+        return (logType == MyLogType::Debug ? 2 : 1);
+    }
+
+    /**
+     * @brief Check if the records of a log type pass the current log level.
+     * @note Defined inline, a constant log type compiles to a single comparison. (See `MY_LOG()`)
+     * @param logType Specifies the log type.
+     * @return Returns true if the records are written, false otherwise.
+     */
+    bool isLogTypeEnabled(MyLogType logType) const
+    {
+        return (this->logLevel.load(std::memory_order_relaxed) >= MyLogger::getLogTypeLevel(logType));
+    }
+
+    /**
+     * @brief Write a log record.
+     * @param description Specifies the log description.
+     * @param extraDescription Specifies the log extra description. (optional)
+     * @param logType Specifies the log type. (optional)
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool writeLog(std::string description, std::string extraDescription = "", MyLogType logType = MyLogType::Info);
+
+    /**
+     * @brief Write a custom log record.
+     * @note Log level is ignored.
+     * @param description Specifies the log description.
+     * @param includeTime Specifies whether to include the time string.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool writeLog(std::string description, bool includeTime);
+
+    /**
+     * @brief Write a log record through the rate limiter.
+     * @note For the hot message paths. (WM_PAINT, WM_TIMER, ..)
+     *       Identical records (same log type and descriptions) share a token bucket of `rateLimitBurst` records, refilled by one record
+     *       every `rateLimitInterval`. The suppressed records are counted and summarized as "(N repeated record(s) suppressed)",
+     *       on the next written record or, once the repeats stop, by the flush thread.
+     * @param description Specifies the log description.
+     * @param extraDescription Specifies the log extra description. (optional)
+     * @param logType Specifies the log type. (optional)
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool writeLimitedLog(std::string description, std::string extraDescription = "", MyLogType logType = MyLogType::Error);
+
+    /**
+     * @brief Get the number of records suppressed by the rate limiter.
+     * @return Returns the number of suppressed records.
+     */
+    ULONGLONG getTotalSuppressedRecords();
+
+    // [ASYNCHRONOUS LOGGING FUNCTIONS]
+
+    /**
+     * @brief Start the asynchronous mode.
+     * @note The records are pushed into a lock-free multi-producer ring buffer and written in batches by a background flush thread,
+     *       through a single file handle. Error records and a half-full ring buffer wake the flush thread early.
+     * @note The pending records are flushed on `stopAsync()` and, with a bounded wait, on unhandled exceptions.
+     * @param capacity Specifies the ring buffer capacity, rounded up to a power of two.
+     * @param overflowPolicy Specifies what to do with a record when the ring buffer is full.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool startAsync(UINT capacity = 4096, MyLogOverflowPolicy overflowPolicy = MyLogOverflowPolicy::Block);
+
+    /**
+     * @brief Stop the asynchronous mode, the logger writes synchronously afterward.
+     * @note If the flush thread doesn't exit in time, it is abandoned with the log segment it may still hold locked.
+     *       The log segment is no longer written and the asynchronous mode can't be restarted.
+     * @param timeout Specifies the maximum time to wait for the pending records to be written. (Milliseconds)
+     * @return Returns true if all the pending records are written, false otherwise.
+     */
+    bool stopAsync(DWORD timeout = 1000);
+
+    /**
+     * @brief Wait until the records pushed so far are written.
+     * @param timeout Specifies the maximum time to wait. (Milliseconds)
+     * @return Returns true if the records are written or the logger isn't in asynchronous mode, false if timed out.
+     */
+    bool flush(DWORD timeout = 1000);
+
+    /**
+     * @brief Check if the logger is in asynchronous mode.
+     * @return Returns true if the logger is in asynchronous mode, false otherwise.
+     */
+    bool isAsync();
+
+    /**
+     * @brief Get the number of records dropped because the ring buffer was full.
+     * @return Returns the number of dropped records.
+     */
+    ULONGLONG getTotalDroppedRecords();
+
+    /**
+     * @brief Get the number of records that had to wait for a free ring buffer slot. (Backpressure)
+     * @return Returns the number of blocked records.
+     */
+    ULONGLONG getTotalBlockedRecords();
+
+    /**
+     * @brief Get the number of records written by the flush thread.
+     * @return Returns the number of written records.
+     */
+    ULONGLONG getTotalWrittenRecords();
+
+    /**
+     * @brief Get the number of records waiting in the ring buffer to be written by the flush thread.
+     * @return Returns the number of queued records, 0 in synchronous mode.
+     */
+    size_t getQueueDepth();
+
+    /**
+     * @brief Set the log file rotation.
+     * @note The log file is made of preallocated memory-mapped segments, the disk usage is capped to `segmentSize * segmentCount`. (See `MyLogSegmentFile`)
+     * @note The current segment is closed, the new settings apply from the next write.
+     * @param segmentSize Specifies the segment size. (Bytes)
+     * @param segmentCount Specifies the maximum number of segments, including the current segment.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool setLogRotation(size_t segmentSize, UINT segmentCount);
+
+    /**
+     * @brief Get the number of log file rotations.
+     * @return Returns the number of log file rotations.
+     */
+    UINT getTotalRotations();
+
+    // [STRUCTURED LOGGING FUNCTIONS]
+
+    /**
+     * @brief Get the current log file format.
+     * @return Returns the current log file format.
+     */
+    MyLogFormat getLogFormat();
+
+    /**
+     * @brief Set the log file format.
+     * @note Switching to the binary format starts a new binary log session. (Session header and call site definitions)
+     * @note The asynchronous mode is restarted if it is active.
+     * @param logFormat Specifies the log file format.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool setLogFormat(MyLogFormat logFormat);
+
+    /**
+     * @brief Register a structured log call site.
+     * @note Use the `MY_LOG()` macro, which registers each call site once.
+     * @param callSite Specifies the call site, the description strings must outlive the process.
+     * @return Returns the call site ID.
+     */
+    static UINT registerCallSite(const MYLOGCALLSITE &callSite);
+
+    /**
+     * @brief Write a structured log record.
+     * @note The binary format only stores the call site ID, a monotonic timestamp and the raw argument values,
+     *       the text is formatted offline by the log decoder tool. The text format formats the record immediately.
+     * @param callSiteId Specifies the call site ID. (See `registerCallSite()`)
+     * @param args Specifies the record arguments. (Integers, enums, floating-point numbers and strings)
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    template <typename... Args>
+    bool writeStructuredLog(UINT callSiteId, const Args &...args)
+    {
+        static_assert(sizeof...(Args) <= UINT8_MAX, "Too many structured log record arguments.");
+        if (!this->isCallSiteEnabled(callSiteId))
+            return true;
+
+        std::string payload = "";
+        (MyLogger::encodeArgument(payload, args), ...);
+
+        return this->writeEncodedLog(callSiteId, static_cast<UINT8>(sizeof...(Args)), payload);
+    }
+
+private:
+    // [HELPER FUNCTIONS]
+
+    /**
+     * @brief Get the current date and time as a formatted string.
+     * @note Visit: http://en.cppreference.com/Width/cpp/chrono/c/strftime
+     * @note for more information about date/time format.
+     * @return Returns the current date and time string formatted as "%Y-%m-%d.%X", empty string otherwise.
+     */
+    std::string getCurrentDateTimeString();
+
+    /**
+     * @brief Get a date and time as a formatted string.
+     * @param time Specifies the date and time.
+     * @return Returns the date and time string formatted as "%Y-%m-%d.%X", empty string otherwise.
+     */
+    std::string getDateTimeString(time_t time);
+
+    /**
+     * @brief Format a log record line.
+     * @param dateTime Specifies the formatted record time.
+     * @param logType Specifies the record log type.
+     * @param isCustom Specifies whether the record is a custom record. (No log type)
+     * @param includeTime Specifies whether to include the time string. (Custom records)
+     * @param text Specifies the record text.
+     * @param line Reference to the string that the formatted line is appended to. [OUT]
+     */
+    void formatRecord(const std::string &dateTime, MyLogType logType, bool isCustom, bool includeTime, const std::string &text, std::string &line);
+
+    /**
+     * @brief Push a record into the ring buffer.
+     * @note The record is dropped and counted if no slot is available, according to the overflow policy.
+     * @param logType Specifies the record log type.
+     * @param isCustom Specifies whether the record is a custom record. (No log type)
+     * @param includeTime Specifies whether to include the time string. (Custom records)
+     * @param isBinary Specifies whether the text holds an encoded binary event record.
+     * @param text Specifies the record text, moved into the ring buffer.
+     * @return Returns true if the record is handled (pushed or dropped), false if the logger isn't in asynchronous mode.
+     */
+    bool pushRecord(MyLogType logType, bool isCustom, bool includeTime, bool isBinary, std::string &text);
+
+    /**
+     * @brief The flush thread procedure.
+     * @param pParameter Pointer to the MyLogger object.
+     * @return Returns 0.
+     */
+    static DWORD WINAPI flushThreadProcedure(LPVOID pParameter);
+
+    /**
+     * @brief Unhandled exception filter, flushes the asynchronous logger before the process terminates.
+     * @param pExceptionInfo Pointer to the exception information.
+     * @return Returns the result of the previous exception filter, EXCEPTION_CONTINUE_SEARCH if there is none.
+     */
+    static LONG WINAPI crashHandler(EXCEPTION_POINTERS *pExceptionInfo);
+
+    /**
+     * @brief Write the summaries of the suppressed records.
+     * @param isForced Specifies whether to write every pending summary, not only the records that stopped repeating.
+     */
+    void flushSuppressedRecords(bool isForced);
+
+    /**
+     * @brief Hash a log record. (FNV-1a)
+     * @param logType Specifies the record log type.
+     * @param description Specifies the record description.
+     * @param extraDescription Specifies the record extra description.
+     * @return Returns the record hash.
+     */
+    static UINT64 hashRecord(MyLogType logType, const std::string &description, const std::string &extraDescription);
+
+    /**
+     * @brief Append a formatted record to the current log segment, rotating the segments when it doesn't fit.
+     * @note The caller must hold `logSegmentLock`. In the binary format, every segment starts a new binary log session,
+     *       so the segments decode independently after the older segments are deleted.
+     * @param record Specifies the formatted record. (Text line or encoded binary record)
+     * @param isBinary Specifies whether the record is an encoded binary record.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool writeSegmentRecord(const std::string &record, bool isBinary);
+
+    /**
+     * @brief Append a formatted record to the current log segment from the synchronous path.
+     * @note Acquires `logSegmentLock`, the record is dropped if the segment is abandoned to a stuck flush thread. (See `stopAsync()`)
+     * @param record Specifies the formatted record. (Text line or encoded binary record)
+     * @param isBinary Specifies whether the record is an encoded binary record.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool writeSegmentRecordSync(const std::string &record, bool isBinary);
+
+    /**
+     * @brief Check if the records of a call site pass the log level.
+     * @param callSiteId Specifies the call site ID.
+     * @return Returns true if the records are written, false otherwise.
+     */
+    bool isCallSiteEnabled(UINT callSiteId);
+
+    /**
+     * @brief Write a structured log record from its encoded arguments.
+     * @param callSiteId Specifies the call site ID.
+     * @param totalArguments Specifies the number of encoded arguments.
+     * @param payload Specifies the encoded arguments.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool writeEncodedLog(UINT callSiteId, UINT8 totalArguments, std::string &payload);
+
+    /**
+     * @brief Append the pending binary log session header and call site definitions.
+     * @param buffer Reference to the buffer that the records are appended to. [OUT]
+     */
+    void appendBinarySessionRecords(std::string &buffer);
+
+    /**
+     * @brief Format a structured log record text.
+     * @param callSite Specifies the call site.
+     * @param totalArguments Specifies the number of encoded arguments.
+     * @param payload Specifies the encoded arguments.
+     * @param text Reference to the string that receives the text. [OUT]
+     * @return Returns true if the arguments are decoded successfully, false otherwise.
+     */
+    static bool formatStructuredRecord(const MYLOGCALLSITE &callSite, UINT8 totalArguments, const std::string &payload, std::string &text);
+
+    /**
+     * @brief Encode a structured log record argument.
+     * @param payload Reference to the string that the argument is appended to. [OUT]
+     * @param value Specifies the argument value.
+     */
+    template <typename T>
+    static void encodeArgument(std::string &payload, const T &value)
+    {
+        if constexpr (std::is_enum_v<T>)
+            MyLogger::encodeArgument(payload, static_cast<std::underlying_type_t<T>>(value));
+        else if constexpr (std::is_same_v<T, bool>)
+            MyLogger::encodeUnsignedArgument(payload, value ? 1 : 0);
+        else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+            MyLogger::encodeSignedArgument(payload, static_cast<INT64>(value));
+        else if constexpr (std::is_integral_v<T>)
+            MyLogger::encodeUnsignedArgument(payload, static_cast<UINT64>(value));
+        else if constexpr (std::is_floating_point_v<T>)
+            MyLogger::encodeFloatArgument(payload, static_cast<double>(value));
+        else
+            MyLogger::encodeStringArgument(payload, std::string_view(value));
+    }
+    static void encodeSignedArgument(std::string &payload, INT64 value);
+    static void encodeUnsignedArgument(std::string &payload, UINT64 value);
+    static void encodeFloatArgument(std::string &payload, double value);
+    static void encodeStringArgument(std::string &payload, std::string_view value);
+
+    /**
+     * @brief Decode a structured log record argument and append its text.
+     * @param payload Specifies the encoded arguments.
+     * @param offset Reference to the read offset, advanced past the argument. [OUT]
+     * @param text Reference to the string that the argument text is appended to. [OUT]
+     * @return Returns true if the argument is decoded successfully, false if the payload is malformed.
+     */
+    static bool decodeArgument(const std::string &payload, size_t &offset, std::string &text);
+
+    /**
+     * @brief Append an unsigned LEB128 variable-length integer.
+     * @param buffer Reference to the buffer that the integer is appended to. [OUT]
+     * @param value Specifies the integer.
+     */
+    static void appendVarint(std::string &buffer, UINT64 value);
+
+    /**
+     * @brief Read an unsigned LEB128 variable-length integer.
+     * @param buffer Specifies the buffer.
+     * @param offset Reference to the read offset, advanced past the integer. [OUT]
+     * @param value Reference to the variable that receives the integer. [OUT]
+     * @return Returns true if the integer is read successfully, false if the buffer is truncated.
+     */
+    static bool readVarint(const std::string &buffer, size_t &offset, UINT64 &value);
+
+private:
+    std::filesystem::path path;
+    std::wstring logFileName = L"log.log";
+    std::atomic<int> logLevel{1};
+
+    // Asynchronous mode.
+    std::unique_ptr<MYLOGRECORD[]> pRecords;                                       // Ring buffer slots.
+    size_t recordMask = 0;                                                         // Ring buffer index mask. (Capacity - 1)
+    std::atomic<size_t> enqueuePosition{0};                                        // Next ring buffer position claimed by a producer.
+    size_t dequeuePosition = 0;                                                    // Next ring buffer position read by the flush thread.
+    std::atomic<size_t> flushedPosition{0};                                        // Ring buffer position up to which the records are written.
+    std::atomic<bool> isAsyncMode{false};                                          // Indicate whether the logger is in asynchronous mode.
+    std::atomic<bool> isStopping{false};                                           // Indicate whether the flush thread is requested to stop.
+    std::atomic<UINT> totalActiveProducers{0};                                     // Number of producers currently pushing a record.
+    std::atomic<ULONGLONG> totalDroppedRecords{0};                                 // Number of dropped records.
+    std::atomic<ULONGLONG> totalBlockedRecords{0};                                 // Number of records that had to wait for a free slot.
+    std::atomic<ULONGLONG> totalWrittenRecords{0};                                 // Number of records written by the flush thread.
+    MyLogOverflowPolicy overflowPolicy = MyLogOverflowPolicy::Block;               // Ring buffer overflow policy.
+    HANDLE hFlushThread = nullptr;                                                 // Handle to the flush thread.
+    HANDLE hFlushEvent = nullptr;                                                  // Event that wakes the flush thread early.
+    std::atomic<bool> isSegmentAbandoned{false};                                   // Indicate whether the log segment is abandoned to a stuck flush thread.
+    inline static const DWORD flushInterval = 100;                                 // Flush thread wake-up interval. (Milliseconds)
+    inline static const DWORD maximumBlockTime = 50;                               // Maximum time a producer waits for a free slot. (Milliseconds)
+    inline static const DWORD crashFlushTimeout = 500;                             // Maximum time spent flushing on unhandled exceptions. (Milliseconds)
+    inline static MyLogger *pCrashFlushLogger = nullptr;                           // The logger flushed on unhandled exceptions.
+    inline static LPTOP_LEVEL_EXCEPTION_FILTER pPreviousExceptionFilter = nullptr; // The exception filter replaced by `crashHandler()`.
+
+    // Log file rotation.
+    MyLogSegmentFile logSegment;           // The log file segments.
+    SRWLOCK logSegmentLock = SRWLOCK_INIT; // Serializes the log segment writes. (Flush thread and synchronous writes)
+    size_t logSegmentSize = 1024 * 1024;   // Log segment size. (Bytes)
+    UINT logSegmentCount = 5;              // Maximum number of log segments.
+
+    // Rate limiting.
+    std::unordered_map<UINT64, MYLOGRATELIMIT> rateLimits;      // Rate limit states, indexed by record hash.
+    SRWLOCK rateLimitLock = SRWLOCK_INIT;                       // Guards the rate limit states.
+    std::atomic<UINT> totalPendingSummaries{0};                 // Number of rate limit states with suppressed records.
+    std::atomic<ULONGLONG> totalSuppressedRecords{0};           // Number of records suppressed by the rate limiter.
+    inline static const ULONGLONG rateLimitBurst = 5;           // Token bucket size. (Records)
+    inline static const ULONGLONG rateLimitInterval = 1000;     // Token bucket refill interval, per record. (Milliseconds)
+    inline static const ULONGLONG rateLimitSummaryDelay = 2000; // Quiet period before the summary of a suppressed record is written. (Milliseconds)
+    inline static const size_t maximumRateLimits = 256;         // Maximum number of rate limit states, new records beyond are not limited.
+
+    // Structured logging.
+    std::atomic<MyLogFormat> logFormat{MyLogFormat::Text}; // Log file format.
+    std::wstring binaryLogFileName = L"log.bin";           // Binary log file name.
+    bool isBinarySessionStarted = false;                   // Indicate whether the binary log session header is written.
+    UINT totalEmittedCallSites = 0;                        // Number of call site definitions written in the binary log session.
+    LONGLONG sessionCounterFrequency = 1;                  // Performance counter frequency of the binary log session.
+    LONGLONG sessionBaseCounter = 0;                       // Performance counter value at the binary log session start.
+    INT64 sessionBaseTime = 0;                             // Time at the binary log session start. (Unix time)
+    INT32 sessionTimeBias = 0;                             // Local time offset from UTC at the binary log session start. (Seconds)
+    inline static const UINT maximumCallSites = 1024;      // Maximum number of registered call sites.
+    inline static std::atomic<UINT> totalCallSites{6};     // Number of registered call sites, the registered entries are immutable.
+    inline static SRWLOCK callSiteLock = SRWLOCK_INIT;     // Serializes the call site registrations.
+    inline static MYLOGCALLSITE callSites[maximumCallSites] = // Registered call sites, indexed by call site ID.
+        {
+            {MyLogType::Info, false, false, "{}", ""},  // Unstructured info records. (`writeLog()`)
+            {MyLogType::Warn, false, false, "{}", ""},  // Unstructured warning records.
+            {MyLogType::Error, false, false, "{}", ""}, // Unstructured error records.
+            {MyLogType::Debug, false, false, "{}", ""}, // Unstructured debug records.
+            {MyLogType::Info, true, false, "{}", ""},   // Unstructured custom records.
+            {MyLogType::Info, true, true, "{}", ""},    // Unstructured custom records. (With time string)
+        };
+};
+
+#endif // LOGGER_H
\ No newline at end of file
@@ -83,4 +83,143 @@
                     WS_MAXIMIZEBOX | \
                     WS_CLIPCHILDREN)
 
+/****************
+ * UI constants *
+ ****************/
+
+#define UI_THEME_COUNT 3                  // Number of themes. (MyTheme)
+#define UI_THEME_COLOR_COUNT 57           // Number of themeable UI colors. (MyThemeColor)
+#define UI_THEMEPACK_SIGNATURE 0x50544757 // Theme pack file signature ('WGTP').
+#define UI_THEMEPACK_VERSION 1            // Theme pack file format version.
+
+/*****************
+ * Log constants *
+ *****************/
+
+// Binary log file format, every integer is little-endian, `varint` is an unsigned LEB128 variable-length integer.
+// - Session record:   [kind] [signature: 4 bytes] [version: 1 byte] [counter frequency: 8 bytes] [base time: 8 bytes] [time bias: 4 bytes]
+// - Call site record: [kind] [ID: varint] [log type: 1 byte] [flags: 1 byte] [description length: varint] [description] [extra description length: varint] [extra description]
+// - Event record:     [kind] [ID: varint] [ticks since the session start: varint] [argument count: 1 byte] [arguments: [type] [value]...]
+// Argument values: signed (zigzag varint), unsigned (varint), float (8 bytes IEEE-754 double), string (length varint + bytes).
+#define LOG_BINARY_SIGNATURE 0x474C4257      // Binary log file signature ('WBLG').
+#define LOG_BINARY_VERSION 1                 // Binary log file format version.
+#define LOG_BINARY_RECORD_SESSION 0x01       // Record kind: session header.
+#define LOG_BINARY_RECORD_CALLSITE 0x02      // Record kind: call site definition.
+#define LOG_BINARY_RECORD_EVENT 0x03         // Record kind: log event.
+#define LOG_BINARY_CALLSITE_CUSTOM 0x01      // Call site flag: custom records. (No log type)
+#define LOG_BINARY_CALLSITE_INCLUDETIME 0x02 // Call site flag: include the time string. (Custom records)
+#define LOG_BINARY_ARGUMENT_SIGNED 0x01      // Argument type: signed integer.
+#define LOG_BINARY_ARGUMENT_UNSIGNED 0x02    // Argument type: unsigned integer.
+#define LOG_BINARY_ARGUMENT_FLOAT 0x03       // Argument type: floating-point number.
+#define LOG_BINARY_ARGUMENT_STRING 0x04      // Argument type: string.
+
+// Compile-time log level, the `MY_LOG()` calls above it are compiled out. (0: Disabled, 1: Info/Warn/Error, 2: Debug)
+// Example: -DLOG_COMPILE_LEVEL=1 strips the debug records from the executable.
+#ifndef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 2
+#endif
+
+// Write a structured log record, the call site is registered once. (See `MyLogger::writeStructuredLog()`)
+// The arguments are only evaluated if the log type passes both the compile-time and the runtime log level.
+// Example: MY_LOG(g_pApp->logger, MyLogType::Debug, "Current desktop resolution:", "'{}x{}'", desktop_width, desktop_height);
+#define MY_LOG(logger, logType, description, extraDescription, ...)                                                                         \
+    do                                                                                                                                      \
+    {                                                                                                                                       \
+        if constexpr (LOG_COMPILE_LEVEL >= MyLogger::getLogTypeLevel(logType))                                                              \
+        {                                                                                                                                   \
+            if ((logger).isLogTypeEnabled(logType))                                                                                         \
+            {                                                                                                                               \
+                static const UINT my_log_call_site_id = MyLogger::registerCallSite({logType, false, false, description, extraDescription}); \
+                (logger).writeStructuredLog(my_log_call_site_id, ##__VA_ARGS__);                                                            \
+            }                                                                                                                               \
+        }                                                                                                                                   \
+    } while (0)
+
+/**********************
+ * Profiler constants *
+ **********************/
+
+// Compile-time profiler switch, the `MY_PROFILE_*()` calls are compiled out if disabled. (0: Disabled, 1: Enabled)
+// Example: -DPROFILE_COMPILE_ENABLED=0 strips the profiler scopes from the executable.
+#ifndef PROFILE_COMPILE_ENABLED
+#define PROFILE_COMPILE_ENABLED 1
+#endif
+
+// Paste two tokens after expanding them. (Unique `MY_PROFILE_SCOPE()` variable names)
+#define MY_PROFILE_CONCAT_IMPL(first, second) first##second
+#define MY_PROFILE_CONCAT(first, second) MY_PROFILE_CONCAT_IMPL(first, second)
+
+#if PROFILE_COMPILE_ENABLED
+// Record a profiler span covering the rest of the enclosing scope. (See `MyProfileScope`)
+// The control ID is only evaluated if the profiler is enabled.
+// Example: MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+#define MY_PROFILE_SCOPE(profiler, controlId, name) \
+    MyProfileScope MY_PROFILE_CONCAT(my_profile_scope_, __LINE__)((profiler), ((profiler).isEnabled() ? static_cast<UINT>(controlId) : 0), (name))
+
+// Record the time elapsed since the previous tick. (See `MyProfiler::recordInterval()`)
+// The control ID is only evaluated if the profiler is enabled.
+// Example: MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+#define MY_PROFILE_INTERVAL(profiler, controlId, name)                       \
+    do                                                                       \
+    {                                                                        \
+        if ((profiler).isEnabled())                                          \
+            (profiler).recordInterval(static_cast<UINT>(controlId), (name)); \
+    } while (0)
+#else
+#define MY_PROFILE_SCOPE(profiler, controlId, name) ((void)0)
+#define MY_PROFILE_INTERVAL(profiler, controlId, name) ((void)0)
+#endif
+
+// Record a startup phase covering the rest of the enclosing scope. (See `MyStartupTracer`)
+// Nothing is recorded once the first frame is drawn.
+// Example: MY_STARTUP_PHASE(g_pApp->startupTracer, "Graphic engine");
+#define MY_STARTUP_PHASE(tracer, name) \
+    MyStartupPhaseScope MY_PROFILE_CONCAT(my_startup_phase_, __LINE__)((tracer), (name))
+
+/********************************
+ * Allocation tracker constants *
+ ********************************/
+
+// Compile-time allocation tracker switch, the global `operator new` replacements and the `MY_ALLOCATION_SCOPE()` calls are compiled out if disabled. (0: Disabled, 1: Enabled)
+// Disabled by default, the 'mingw64-profile' build task enables it.
+// Example: -DALLOCATION_TRACKING_COMPILE_ENABLED=1 replaces the global allocation functions.
+#ifndef ALLOCATION_TRACKING_COMPILE_ENABLED
+#define ALLOCATION_TRACKING_COMPILE_ENABLED 0
+#endif
+
+#if ALLOCATION_TRACKING_COMPILE_ENABLED
+// Attribute the allocations made in the rest of the enclosing scope to a window message. (See `MyAllocationScope`)
+// The control ID is only evaluated if the allocation tracker is enabled.
+// Example: MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+#define MY_ALLOCATION_SCOPE(message, controlId) \
+    MyAllocationScope MY_PROFILE_CONCAT(my_allocation_scope_, __LINE__)((message), (MyAllocationTracker::isEnabled() ? static_cast<UINT>(controlId) : 0))
+#else
+#define MY_ALLOCATION_SCOPE(message, controlId) ((void)0)
+#endif
+
+/*****************************
+ * Input recording constants *
+ *****************************/
+
+// Input recording file format, every integer is little-endian. (See `MyInputRecorder`)
+// - Header: [signature: 4 bytes] [version: 4 bytes] [window x: 4 bytes] [window y: 4 bytes] [window width: 4 bytes] [window height: 4 bytes]
+// - Record: [time since the recording start: 8 bytes] [control ID: 4 bytes] [parent control ID: 4 bytes] [message: 4 bytes] [flags: 4 bytes] [wParam: 8 bytes] [lParam: 8 bytes]
+// The record times are in microseconds, the replay dispatches them against a virtual clock advanced by `INPUT_REPLAY_FRAME_TIME` per frame.
+#define INPUT_RECORDING_SIGNATURE 0x52494757 // Input recording file signature ('WGIR').
+#define INPUT_RECORDING_VERSION 1            // Input recording file format version.
+#define INPUT_RECORD_APPLICATION_WINDOW 0x01 // Record flag: the message targets the application window.
+#define INPUT_REPLAY_FRAME_TIME 16000        // Virtual clock step of a replay frame. (Microseconds)
+
+/******************************
+ * Startup snapshot constants *
+ ******************************/
+
+// Startup snapshot file format, every integer is little-endian. (See `MyStartupSnapshot`)
+// - Header: [signature: 4 bytes] [version: 4 bytes] [validation stamp: 8 bytes] [entry count: 4 bytes] [reserved: 4 bytes]
+// - Entry:  [key: 8 bytes] [data offset from the file start: 8 bytes] [data size: 8 bytes], sorted by key.
+// - Data:   The entry data blocks.
+// The snapshot is rejected if its validation stamp does not match the executable, the cached data is embedded in its resources.
+#define STARTUP_SNAPSHOT_SIGNATURE 0x53534757 // Startup snapshot file signature ('WGSS').
+#define STARTUP_SNAPSHOT_VERSION 1            // Startup snapshot file format version.
+
 #endif // MARCO_H
\ No newline at end of file
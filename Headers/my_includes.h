@@ -9,7 +9,18 @@
 #include "./resources.h"            // Global resource marcos.
 #include "./marco.h"                // Other global marcos.
 #include "./forward_declarations.h" // Forward declarations.
+#include "./text.h"                 // My portable text helpers.
+#include "./config.h"               // My portable configuration types.
+#include "./theme.h"                // My portable theme types.
+#include "./logger.h"               // My logger types.
+#include "./deleter.h"              // My deleter types.
 #include "./utility.h"              // My utility types.
+#include "./config_file.h"          // My configuration file types.
+#include "./profiler.h"             // My profiler types.
+#include "./startup_tracer.h"       // My startup tracer types.
+#include "./allocation_tracker.h"   // My allocation tracker types.
+#include "./input_recorder.h"       // My input recorder types.
+#include "./startup_snapshot.h"     // My startup snapshot types.
 #include "./window.h"               // My window types.
 #include "./graphic.h"              // My graphic types.
 #include "./ui.h"                   // My ui types.
@@ -0,0 +1,45 @@
+/**
+ * @file portable_includes.h
+ * @brief Include the standard library headers and the types used by the portable cores.
+ * @note Windows-free, the portable cores and the headless tools build on any platform with this header alone.
+ *       The typedefs are identical to the Windows API ones, redeclaring them after `<windows.h>` is harmless.
+ */
+
+#ifndef PORTABLE_INCLUDES_H
+#define PORTABLE_INCLUDES_H
+
+#include <bitset>      // Fixed-size bit sequences. (Configuration key masks)
+#include <cstddef>     // Standard type definitions.
+#include <cstdint>     // Fixed-width integer types.
+#include <cstring>     // C string and memory functions.
+#include <cwchar>      // Wide character limits. (WCHAR_MAX)
+#include <functional>  // Function objects. (Configuration change callbacks)
+#include <string>      // String handling.
+#include <type_traits> // Compile-time type information.
+#include <vector>      // Sequence containers.
+
+// Windows API integer and floating-point types.
+typedef char CHAR;
+typedef unsigned char BYTE;
+typedef short SHORT;
+typedef int INT;
+typedef unsigned int UINT;
+typedef unsigned short UINT16;
+typedef int INT32;
+typedef unsigned int UINT32;
+typedef long long INT64;
+typedef unsigned long long UINT64;
+typedef float FLOAT;
+typedef double DOUBLE;
+
+// SSE2 is the x64 baseline, and optional on x86 (MSVC: /arch:SSE2, GCC: -msse2).
+// NEON is the ARM64 baseline.
+#if defined(_M_X64) || defined(__SSE2__) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#define SIMD_SSE2      // Enable the SSE2 code paths.
+#include <emmintrin.h> // SSE2 intrinsics (String search, UTF transcoding).
+#elif defined(_M_ARM64) || defined(__aarch64__)
+#define SIMD_NEON      // Enable the NEON code paths.
+#include <arm_neon.h>  // NEON intrinsics (UTF transcoding).
+#endif
+
+#endif // PORTABLE_INCLUDES_H
\ No newline at end of file
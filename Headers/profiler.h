@@ -0,0 +1,206 @@
+/**
+ * @file profiler.h
+ * @brief Header file containing user-defined types that related to frame timing profiling. (Spans, latency histograms, Chrome trace export)
+ */
+
+#ifndef PROFILER_H
+#define PROFILER_H
+
+/***********************
+ * Profiler structures *
+ ***********************/
+
+/**
+ * @brief A profiler span, the time a control spent processing a message or a part of it. (See `MyProfiler`)
+ * @note Interval records hold the time between two successive ticks instead. (See `MyProfiler::recordInterval()`)
+ */
+struct MYPROFILESPAN
+{
+    const char *name;   // Span name, a static string. (e.g. "WM_PAINT/EndDraw")
+    UINT controlId;     // Control ID of the window, 0 for the application window.
+    bool isInterval;    // Indicate whether the record is an interval record.
+    LONGLONG startTime; // Performance counter value at the span start.
+    LONGLONG endTime;   // Performance counter value at the span end.
+};
+
+/**
+ * @brief A latency histogram of the spans sharing a name and a control ID.
+ * @note Bucket 0 counts the spans shorter than 1 microsecond, bucket N the spans of [2^(N-1), 2^N) microseconds.
+ */
+struct MYPROFILEHISTOGRAM
+{
+    const char *name;      // Span name.
+    UINT controlId;        // Control ID of the window.
+    bool isInterval;       // Indicate whether the histogram counts interval records.
+    ULONGLONG totalSpans;  // Number of spans.
+    LONGLONG totalTime;    // Total time of the spans. (Performance counter ticks)
+    LONGLONG maximumTime;  // Longest span. (Performance counter ticks)
+    ULONGLONG buckets[32]; // Span counts, per power of two microseconds.
+};
+
+/**
+ * @brief Profiler records of a thread, written by that thread only.
+ * @note The lock is only contended while the records are exported. (See `MyProfiler::exportChromeTrace()`)
+ */
+struct MYPROFILETHREAD
+{
+    DWORD threadId;                                                         // Thread ID.
+    SRWLOCK lock;                                                           // Guards the records.
+    std::unique_ptr<MYPROFILESPAN[]> pSpans;                                // Ring buffer of the latest spans.
+    ULONGLONG totalSpans;                                                   // Number of spans recorded, including the overwritten ones.
+    std::map<std::pair<UINT, const char *>, MYPROFILEHISTOGRAM> histograms; // Latency histograms, indexed by control ID and span name.
+    std::map<std::pair<UINT, const char *>, LONGLONG> lastTickTimes;        // Time of the last tick, indexed by control ID and interval name.
+};
+
+/********************
+ * Profiler classes *
+ ********************/
+
+/**
+ * @brief Frame timing profiler, records the time the controls spend processing their messages.
+ * @note Disabled by default, the scopes only check an atomic flag until enabled. (See `MY_PROFILE_SCOPE()`)
+ *       Each thread records into its own ring buffer and latency histograms, the export reads the latest
+ *       `spansPerThread` spans of every thread in the Chrome trace event format. (chrome://tracing, Perfetto)
+ */
+class MyProfiler
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR/..]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyProfiler();
+
+    // [PROFILING FUNCTIONS]
+
+    /**
+     * @brief Check if the profiler records spans.
+     * @return Returns true if the profiler is enabled, false otherwise.
+     */
+    bool isEnabled() const
+    {
+        return this->isRecording.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Enable or disable the profiler, the recorded spans are kept.
+     * @param isEnabled Specifies whether the profiler records spans.
+     */
+    void setEnabled(bool isEnabled);
+
+    /**
+     * @brief Get the current performance counter value.
+     * @return Returns the current performance counter value.
+     */
+    static LONGLONG getTime();
+
+    /**
+     * @brief Record a span on the calling thread.
+     * @param controlId Specifies the control ID of the window.
+     * @param name Specifies the span name, a static string.
+     * @param startTime Specifies the performance counter value at the span start.
+     * @param endTime Specifies the performance counter value at the span end.
+     */
+    void recordSpan(UINT controlId, const char *name, LONGLONG startTime, LONGLONG endTime);
+
+    /**
+     * @brief Record the time elapsed since the previous tick of the same control ID and name on the calling thread.
+     * @note For the timer jitter. (WM_TIMER)
+     *       Ticks further apart than `maximumTickInterval` start a new run, the timer was restarted.
+     * @param controlId Specifies the control ID of the window.
+     * @param name Specifies the interval name, a static string.
+     */
+    void recordInterval(UINT controlId, const char *name);
+
+    /**
+     * @brief Discard the recorded spans and histograms of every thread.
+     */
+    void reset();
+
+    /**
+     * @brief Export the recorded spans in the Chrome trace event format.
+     * @note Spans are exported as complete events, intervals as counter events, named after the span name and the control ID.
+     * @param filePath Specifies the trace file path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool exportChromeTrace(const std::wstring &filePath);
+
+    /**
+     * @brief Write the latency histogram summaries, slowest total time first.
+     * @param logger Specifies the logger.
+     * @param maximumRows Specifies the maximum number of summarized histograms. (optional)
+     * @return Returns the number of summarized histograms.
+     */
+    size_t writeSummary(MyLogger &logger, size_t maximumRows = 20);
+
+private:
+    /**
+     * @brief Get the records of the calling thread, registered on first use.
+     * @return Returns the pointer to the records of the calling thread.
+     */
+    MYPROFILETHREAD *getThreadRecords();
+
+    /**
+     * @brief Add a span to the ring buffer and the histograms of a thread.
+     * @param pThread Specifies the thread records, locked by the caller.
+     * @param span Specifies the span.
+     */
+    void addSpan(MYPROFILETHREAD *pThread, const MYPROFILESPAN &span);
+
+    /**
+     * @brief Convert performance counter ticks to microseconds.
+     * @param ticks Specifies the performance counter ticks.
+     * @return Returns the time in microseconds.
+     */
+    DOUBLE toMicroseconds(LONGLONG ticks) const;
+
+private:
+    std::atomic<bool> isRecording{false};                   // Indicate whether the profiler records spans.
+    UINT64 instanceId = 0;                                  // Profiler instance ID, tags the cached thread records.
+    LONGLONG counterFrequency = 1;                          // Performance counter frequency.
+    LONGLONG baseTime = 0;                                  // Performance counter value at the profiler creation, the trace time origin.
+    std::vector<std::unique_ptr<MYPROFILETHREAD>> threads;  // Records of every thread that recorded a span.
+    SRWLOCK threadLock = SRWLOCK_INIT;                      // Guards the thread list.
+    inline static std::atomic<UINT64> totalInstances{0};    // Number of created profiler instances.
+    inline static const size_t spansPerThread = 16384;      // Ring buffer capacity of each thread. (Power of two)
+    inline static const LONGLONG maximumTickInterval = 250; // Longest interval between two ticks of the same run. (Milliseconds)
+};
+
+/**
+ * @brief Records a profiler span covering its lifetime. (See `MY_PROFILE_SCOPE()`)
+ */
+class MyProfileScope
+{
+public:
+    /**
+     * @brief Constructor.
+     * @note Nothing is recorded if the profiler is disabled when the scope starts.
+     * @param profiler Specifies the profiler.
+     * @param controlId Specifies the control ID of the window.
+     * @param name Specifies the span name, a static string.
+     */
+    MyProfileScope(MyProfiler &profiler, UINT controlId, const char *name)
+        : pProfiler(profiler.isEnabled() ? &profiler : nullptr), controlId(controlId), name(name), startTime(this->pProfiler ? MyProfiler::getTime() : 0) {}
+
+    /**
+     * @brief Destructor.
+     * @note The span is recorded.
+     */
+    ~MyProfileScope()
+    {
+        if (this->pProfiler)
+            this->pProfiler->recordSpan(this->controlId, this->name, this->startTime, MyProfiler::getTime());
+    }
+
+    MyProfileScope(const MyProfileScope &) = delete;
+    MyProfileScope &operator=(const MyProfileScope &) = delete;
+
+private:
+    MyProfiler *pProfiler; // The profiler, null if the profiler was disabled.
+    UINT controlId;        // Control ID of the window.
+    const char *name;      // Span name.
+    LONGLONG startTime;    // Performance counter value at the span start.
+};
+
+#endif // PROFILER_H
\ No newline at end of file
@@ -18,18 +18,25 @@
 #include <sdkddkver.h>   // Prevent Windows API-incompatible functionality.
 #include <exception>     // Exception handling.
 #include <string>        // String handling.
+#include <string_view>   // Non-owning string references (Structured log arguments).
+#include <cstring>       // C string and memory functions (Configuration parsing).
 #include <cwctype>       // Character classification and conversion.
-#include <regex>         // Regular expressions (String conversions).
 #include <cmath>         // Mathematical functions and constants.
 #include <limits>        // Numeric limits.
+#include <type_traits>   // Compile-time type information (Structured log arguments).
 #include <locale>        // Localization.
 #include <exception>     // Exception handling.
 #include <memory>        // Memory management utilities.
+#include <atomic>        // Atomic operations (Asynchronous logger ring buffer).
 #include <fstream>       // File input/output.
 #include <filesystem>    // Filesystem operations (File paths).
 #include <map>           // Associative containers (Animations).
 #include <set>           // Unique element containers (Store temporary timers).
+#include <unordered_map> // Hashed associative containers (Brush pool).
+#include <bitset>        // Fixed-size bit sequences (Theme color masks).
 #include <vector>        // Sequence containers (C Style array alternative).
+#include <functional>    // Function objects (Configuration change callbacks).
+#include <algorithm>     // Sorting algorithms (Profiler summary).
 #include <windows.h>     // Windows API: Essentials.
 #include <windowsx.h>    // Windows API: Macro functions for handling window messages.
 #include <uxtheme.h>     // Windows API: Visual themes and styles.
@@ -45,4 +52,6 @@
 #include <richedit.h>    // Windows API: Rich Edit control classes.
 #include <shobjidl.h>    // Windows API: Working with shell objects.
 
+#include "./portable_includes.h" // Portable types and SIMD intrinsics. (Portable cores)
+
 #endif // STANDARD_INCLUDES_H
\ No newline at end of file
@@ -0,0 +1,154 @@
+/**
+ * @file startup_snapshot.h
+ * @brief Header file containing user-defined types that related to the startup snapshot. (Decoded image cache)
+ */
+
+#ifndef STARTUP_SNAPSHOT_H
+#define STARTUP_SNAPSHOT_H
+
+/*******************************
+ * Startup snapshot structures *
+ *******************************/
+
+/**
+ * @brief Startup snapshot file header. (See `STARTUP_SNAPSHOT_SIGNATURE`)
+ */
+struct MYSTARTUPSNAPSHOTHEADER
+{
+    UINT32 signature;       // File signature. (STARTUP_SNAPSHOT_SIGNATURE)
+    UINT32 version;         // File format version. (STARTUP_SNAPSHOT_VERSION)
+    UINT64 validationStamp; // Validation stamp of the executable that wrote the snapshot.
+    UINT32 totalEntries;    // Number of entries.
+    UINT32 reserved;        // Reserved, must be 0.
+};
+
+/**
+ * @brief Startup snapshot entry, locates a cached data block. (See `MyStartupSnapshot`)
+ */
+struct MYSTARTUPSNAPSHOTENTRY
+{
+    UINT64 key;    // Entry key.
+    UINT64 offset; // Data offset from the file start.
+    UINT64 size;   // Data size.
+};
+
+/****************************
+ * Startup snapshot classes *
+ ****************************/
+
+/**
+ * @brief Startup snapshot, a versioned cache file of data computed at startup. (See `STARTUP_SNAPSHOT_SIGNATURE`)
+ * @note The file is memory-mapped by `open()`, the entries are read in place.
+ *       The entries added by `addEntry()` are written to a new file by `write()`.
+ * @note `find()` is thread-safe while the snapshot is open.
+ */
+class MyStartupSnapshot
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR/..]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyStartupSnapshot();
+
+    /**
+     * @brief Destructor.
+     */
+    ~MyStartupSnapshot();
+
+    MyStartupSnapshot(const MyStartupSnapshot &) = delete;
+    MyStartupSnapshot &operator=(const MyStartupSnapshot &) = delete;
+
+    // [SNAPSHOT FUNCTIONS]
+
+    /**
+     * @brief Get the validation stamp of the running executable.
+     * @note Derived from the executable file size and last write time, a rebuilt executable invalidates the snapshots.
+     * @return Returns the validation stamp, or 0 if the executable file attributes could not be retrieved.
+     */
+    static UINT64 getValidationStamp();
+
+    /**
+     * @brief Map a snapshot file.
+     * @param filePath Specifies the snapshot file path.
+     * @param validationStamp Specifies the expected validation stamp.
+     * @return Returns true if the snapshot is mapped, false if the file does not exist, is invalid or is stale.
+     */
+    bool open(const std::wstring &filePath, UINT64 validationStamp);
+
+    /**
+     * @brief Unmap the snapshot file.
+     */
+    void close();
+
+    /**
+     * @brief Check if a snapshot file is mapped.
+     * @return Returns true if a snapshot file is mapped, false otherwise.
+     */
+    bool isOpen() const
+    {
+        return this->pView != nullptr;
+    }
+
+    /**
+     * @brief Find an entry of the mapped snapshot.
+     * @param key Specifies the entry key.
+     * @param pData Reference to the pointer that receives the entry data, valid until the snapshot is closed. [OUT]
+     * @param dataSize Reference to the variable that receives the entry data size. [OUT]
+     * @return Returns true if the entry is found, false otherwise.
+     */
+    bool find(UINT64 key, const BYTE *&pData, size_t &dataSize);
+
+    /**
+     * @brief Get the number of entries of the mapped snapshot.
+     * @return Returns the number of entries.
+     */
+    UINT getTotalEntries() const
+    {
+        return this->totalEntries;
+    }
+
+    /**
+     * @brief Get the number of entries found by `find()` since the snapshot is opened.
+     * @return Returns the number of found entries.
+     */
+    UINT getTotalHits() const
+    {
+        return this->totalHits.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Add an entry to the next written snapshot.
+     * @param key Specifies the entry key, replaces the added entry with the same key.
+     * @param data Specifies the entry data.
+     */
+    void addEntry(UINT64 key, std::string data);
+
+    /**
+     * @brief Add the mapped entries to the next written snapshot, except the entries with the key of an added entry.
+     * @note Keeps the entries the session didn't use, call it before the snapshot is closed.
+     * @return Returns the number of added entries.
+     */
+    UINT addMappedEntries();
+
+    /**
+     * @brief Write the added entries to a snapshot file, then clear them.
+     * @note The snapshot must be closed first if it maps the same file.
+     * @param filePath Specifies the snapshot file path.
+     * @param validationStamp Specifies the validation stamp.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool write(const std::wstring &filePath, UINT64 validationStamp);
+
+private:
+    HANDLE hFile = INVALID_HANDLE_VALUE;              // Handle to the snapshot file.
+    HANDLE hFileMapping = nullptr;                    // Handle to the snapshot file mapping.
+    const BYTE *pView = nullptr;                      // Pointer to the mapped snapshot file, null if no snapshot is mapped.
+    const MYSTARTUPSNAPSHOTENTRY *pEntries = nullptr; // Pointer to the mapped entries.
+    UINT totalEntries = 0;                            // Number of mapped entries.
+    std::atomic<UINT> totalHits{0};                   // Number of entries found since the snapshot is opened.
+    std::map<UINT64, std::string> addedEntries;       // Entries of the next written snapshot, sorted by key.
+};
+
+#endif // STARTUP_SNAPSHOT_H
\ No newline at end of file
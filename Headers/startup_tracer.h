@@ -0,0 +1,145 @@
+/**
+ * @file startup_tracer.h
+ * @brief Header file containing user-defined types that related to startup tracing. (Startup phase timeline)
+ */
+
+#ifndef STARTUP_TRACER_H
+#define STARTUP_TRACER_H
+
+/*****************************
+ * Startup tracer structures *
+ *****************************/
+
+/**
+ * @brief A startup phase. (See `MyStartupTracer`)
+ */
+struct MYSTARTUPPHASE
+{
+    const char *name;   // Phase name, a static string. (e.g. "Graphic engine")
+    UINT depth;         // Nesting depth in the thread that ran the phase, 0 for the outermost phases.
+    DWORD threadId;     // ID of the thread that ran the phase.
+    LONGLONG startTime; // Performance counter value at the phase start.
+    LONGLONG endTime;   // Performance counter value at the phase end, 0 while the phase is running.
+};
+
+/**************************
+ * Startup tracer classes *
+ **************************/
+
+/**
+ * @brief Startup tracer, records the timeline of the startup phases until the first frame is drawn.
+ * @note The phases are recorded by `MY_STARTUP_PHASE()` scopes from any thread, the phases of a thread nest by scope.
+ *       `finish()` stops the recording, the later phases are ignored.
+ * @note The timeline origin is the tracer construction, during the static initialization of the application.
+ */
+class MyStartupTracer
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR/..]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyStartupTracer();
+
+    MyStartupTracer(const MyStartupTracer &) = delete;
+    MyStartupTracer &operator=(const MyStartupTracer &) = delete;
+
+    // [TRACER FUNCTIONS]
+
+    /**
+     * @brief Check if the tracer records the phases.
+     * @return Returns true if the phases are recorded, false once the tracer is finished.
+     */
+    bool isTracing() const
+    {
+        return this->isActive.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Begin a phase on the calling thread.
+     * @param name Specifies the phase name, a static string.
+     * @return Returns the phase index to pass to `endPhase()`, or `invalidPhase` if the tracer is finished.
+     */
+    size_t beginPhase(const char *name);
+
+    /**
+     * @brief End a phase begun by `beginPhase()` on the calling thread.
+     * @param phaseIndex Specifies the phase index.
+     */
+    void endPhase(size_t phaseIndex);
+
+    /**
+     * @brief Stop recording the phases.
+     * @return Returns the time since the timeline origin. (Milliseconds)
+     */
+    DOUBLE finish();
+
+    /**
+     * @brief Format the compact timeline summary.
+     * @note The phases of the calling thread are listed in order, with their nested phases in parentheses.
+     *       The phases of the other threads are totaled by name.
+     * @return Returns the summary.
+     */
+    std::string formatSummary();
+
+    /**
+     * @brief Export the phases in the Chrome trace event format. (chrome://tracing, Perfetto)
+     * @param filePath Specifies the trace file path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool exportChromeTrace(const std::wstring &filePath);
+
+    inline static const size_t invalidPhase = static_cast<size_t>(-1); // Phase index returned when no phase is recorded.
+
+private:
+    /**
+     * @brief Convert performance counter ticks to milliseconds.
+     * @param ticks Specifies the ticks.
+     * @return Returns the milliseconds.
+     */
+    DOUBLE toMilliseconds(LONGLONG ticks) const;
+
+private:
+    SRWLOCK lock = SRWLOCK_INIT;                     // Guards the phases.
+    std::vector<MYSTARTUPPHASE> phases;              // Recorded phases, in begin order.
+    std::atomic<bool> isActive{true};                // Indicate whether the phases are recorded.
+    LONGLONG counterFrequency = 1;                   // Performance counter frequency.
+    LONGLONG baseTime = 0;                           // Performance counter value at the timeline origin.
+    LONGLONG finishTime = 0;                         // Performance counter value at the `finish()` call.
+    inline static thread_local UINT threadDepth = 0; // Number of running phases of the calling thread.
+};
+
+/**
+ * @brief Records a startup phase covering its lifetime. (See `MY_STARTUP_PHASE()`)
+ */
+class MyStartupPhaseScope
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param tracer Specifies the startup tracer.
+     * @param name Specifies the phase name, a static string.
+     */
+    MyStartupPhaseScope(MyStartupTracer &tracer, const char *name)
+        : tracer(tracer), phaseIndex(tracer.isTracing() ? tracer.beginPhase(name) : MyStartupTracer::invalidPhase) {}
+
+    /**
+     * @brief Destructor.
+     * @note The phase is ended.
+     */
+    ~MyStartupPhaseScope()
+    {
+        if (this->phaseIndex != MyStartupTracer::invalidPhase)
+            this->tracer.endPhase(this->phaseIndex);
+    }
+
+    MyStartupPhaseScope(const MyStartupPhaseScope &) = delete;
+    MyStartupPhaseScope &operator=(const MyStartupPhaseScope &) = delete;
+
+private:
+    MyStartupTracer &tracer; // The startup tracer.
+    size_t phaseIndex;       // Index of the recorded phase, `invalidPhase` if the tracer was finished.
+};
+
+#endif // STARTUP_TRACER_H
\ No newline at end of file
@@ -290,9 +290,10 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note Refresh the window to recreate its device resources and update its animation variable values.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
 
     // [DIRECT2D FUNCTIONS]
 
@@ -404,9 +405,10 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note Refresh the window to recreate its device resources and update its animation variable values.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
 
     // [DIRECT2D FUNCTIONS]
 
@@ -510,9 +512,9 @@ private:
     // Direct2D-related variables.
     // Shared resources: These are resources that are utilized by all instances of the class.
     // Non-shared resources: These are resources that are exclusive and associated with a specific instance.
-    std::unique_ptr<ID2D1Bitmap *, ID2D1BitmapDeleter> pD2D1BitmapDefaultImage; // Default state image bitmap. (Non-shared resource)
-    std::unique_ptr<ID2D1Bitmap *, ID2D1BitmapDeleter> pD2D1BitmapHoverImage;   // Hover state image bitmap.   (Non-shared resource)
-    std::unique_ptr<ID2D1Bitmap *, ID2D1BitmapDeleter> pD2D1BitmapActiveImage;  // Active state image bitmap.  (Non-shared resource)
+    std::unique_ptr<ID2D1Bitmap *, ID2D1BitmapDeleter> pD2D1BitmapDefaultImage; // Default state image bitmap.                   (Non-shared resource)
+    std::unique_ptr<ID2D1Bitmap *, ID2D1BitmapDeleter> pD2D1BitmapHoverImage;   // Hover state image bitmap, created on first draw.  (Non-shared resource)
+    std::unique_ptr<ID2D1Bitmap *, ID2D1BitmapDeleter> pD2D1BitmapActiveImage;  // Active state image bitmap, created on first draw. (Non-shared resource)
 };
 
 /**
@@ -535,9 +537,10 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note Refresh the window to recreate its device resources and update its animation variable values.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
 
     // [DIRECT2D FUNCTIONS]
 
@@ -722,9 +725,10 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note Refresh the window to recreate its device resources and update its animation variable values.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
 
     // [DIRECT2D FUNCTIONS]
 
@@ -733,6 +737,13 @@ public:
      */
     static void releaseSharedDeviceResources();
 
+    /**
+     * @brief Update the shared brush colors to the current UI colors.
+     * @note The shared brushes are kept, the brushes that don't exist yet are left to the next device resource creation.
+     * @param colors Reference to the UI colors.
+     */
+    static void recolorSharedDeviceResources(UIColors &colors);
+
     // [ANIMATION FUNCTIONS]
 
     /**
@@ -849,9 +860,10 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note Refresh the window to recreate its device resources and update its animation variable values.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
 
     /**
      * @brief Release the shared device resources of the class.
@@ -1035,9 +1047,10 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note Refresh the window to recreate its device resources and update its animation variable values.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
 
     // [DIRECT2D FUNCTIONS]
 
@@ -1166,9 +1179,10 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note Refresh the window to recreate its device resources and update its animation variable values.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
 
     // [DIRECT2D FUNCTIONS]
 
@@ -0,0 +1,298 @@
+/**
+ * @file text.h
+ * @brief Header file containing the portable text helpers. (Character classes, UTF transcoding)
+ * @note Windows-free, only needs `portable_includes.h`. Shared by the application and the headless tools.
+ */
+
+#ifndef TEXT_H
+#define TEXT_H
+
+/*******************
+ * Text structures *
+ *******************/
+
+/**
+ * @brief An ASCII character class, the union of up to 4 inclusive character ranges.
+ * @note Usable at compile time, and by the vectorized kernels. (See `MyUtility::FilterCharacters()`)
+ */
+struct MYCHARCLASS
+{
+    char32_t ranges[4][2]; // Inclusive character ranges. ([First, last], ASCII)
+    size_t totalRanges;    // Number of used ranges.
+
+    constexpr bool contains(char32_t character) const
+    {
+        for (size_t i = 0; i < this->totalRanges; i++)
+        {
+            if (character >= this->ranges[i][0] && character <= this->ranges[i][1])
+                return true;
+        }
+
+        return false;
+    }
+};
+
+/*********************
+ * Character classes *
+ *********************/
+
+namespace MyCharClass
+{
+    inline constexpr MYCHARCLASS Digit = {{{'0', '9'}}, 1};                            // Decimal digits.
+    inline constexpr MYCHARCLASS HexDigit = {{{'0', '9'}, {'A', 'F'}, {'a', 'f'}}, 3}; // Hexadecimal digits.
+    inline constexpr MYCHARCLASS Upper = {{{'A', 'Z'}}, 1};                            // Upper case letters.
+    inline constexpr MYCHARCLASS Lower = {{{'a', 'z'}}, 1};                            // Lower case letters.
+    inline constexpr MYCHARCLASS Alpha = {{{'A', 'Z'}, {'a', 'z'}}, 2};                // Letters.
+    inline constexpr MYCHARCLASS Alnum = {{{'0', '9'}, {'A', 'Z'}, {'a', 'z'}}, 3};    // Letters and decimal digits.
+    inline constexpr MYCHARCLASS Blank = {{{'\t', '\t'}, {' ', ' '}}, 2};              // Spaces and tabs.
+    inline constexpr MYCHARCLASS Space = {{{'\t', '\r'}, {' ', ' '}}, 2};              // White spaces. (" \t\n\v\f\r")
+
+    // The predicates match the "C" locale classification, characters outside of ASCII are never in a class.
+    // Pass the `char` values as-is, the negative values convert to code points outside of ASCII.
+    constexpr bool IsDigit(char32_t character) { return Digit.contains(character); }
+    constexpr bool IsHexDigit(char32_t character) { return HexDigit.contains(character); }
+    constexpr bool IsUpper(char32_t character) { return Upper.contains(character); }
+    constexpr bool IsLower(char32_t character) { return Lower.contains(character); }
+    constexpr bool IsAlpha(char32_t character) { return Alpha.contains(character); }
+    constexpr bool IsAlnum(char32_t character) { return Alnum.contains(character); }
+    constexpr bool IsBlank(char32_t character) { return Blank.contains(character); }
+    constexpr bool IsSpace(char32_t character) { return Space.contains(character); }
+}
+
+/***************************
+ * Portable text functions *
+ ***************************/
+
+namespace MyUtility
+{
+    /**
+     * @brief Check if a string contains at least one character of a character class.
+     * @param str The string to search within.
+     * @param charClass The character class. (See `MyCharClass`)
+     * @note Vectorized, 16 characters at a time. (SSE2/NEON)
+     * @note `<string>`
+     * @return Returns true if the string contains at least one character of the class, false otherwise.
+     */
+    bool ContainsCharacter(const std::string &str, const MYCHARCLASS &charClass);
+    bool ContainsCharacter(const std::wstring &str, const MYCHARCLASS &charClass);
+
+    /**
+     * @brief Count the characters of a character class in a string.
+     * @param str The string to count within.
+     * @param charClass The character class. (See `MyCharClass`)
+     * @note Vectorized, 16 characters at a time. (SSE2/NEON)
+     * @note `<string>`
+     * @return Returns the number of characters of the class.
+     */
+    size_t CountCharacters(const std::string &str, const MYCHARCLASS &charClass);
+    size_t CountCharacters(const std::wstring &str, const MYCHARCLASS &charClass);
+
+    /**
+     * @brief Keep only the characters of a character class in a string.
+     * @param str The string to filter.
+     * @param charClass The character class. (See `MyCharClass`)
+     * @note Vectorized, the blocks of 16 matching characters are copied whole. (SSE2/NEON)
+     * @note `<string>`
+     * @return Returns the filtered string.
+     */
+    std::string FilterCharacters(const std::string &str, const MYCHARCLASS &charClass);
+    std::wstring FilterCharacters(const std::wstring &str, const MYCHARCLASS &charClass);
+
+    /**
+     * @brief Transcode a UTF-8 string to UTF-16.
+     * @note Validating, every maximal invalid subsequence is replaced with U+FFFD. (Like `MultiByteToWideChar()` without `MB_ERR_INVALID_CHARS`)
+     * @note Portable, the ASCII runs are widened 16 bytes at a time. (SSE2/NEON)
+     *       Usable with `char16_t`, and `wchar_t` where it is 16-bit.
+     * @param pSource Pointer to the UTF-8 string.
+     * @param sourceLength Length of the UTF-8 string. (Bytes)
+     * @param pDestination Pointer to the destination buffer, of at least `sourceLength` code units. [OUT]
+     * @return Returns the number of code units written.
+     */
+    template <typename Char16>
+    inline size_t TranscodeUtf8ToUtf16(const char *pSource, size_t sourceLength, Char16 *pDestination)
+    {
+        static_assert(sizeof(Char16) == 2, "UTF-16 code units must be 16-bit.");
+
+        const unsigned char *p_source = reinterpret_cast<const unsigned char *>(pSource);
+        size_t source_index = 0, destination_index = 0;
+        while (source_index < sourceLength)
+        {
+            // Widen the ASCII blocks.
+#if defined(SIMD_SSE2)
+            for (; source_index + 16 <= sourceLength; source_index += 16, destination_index += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_source + source_index));
+                if (_mm_movemask_epi8(block))
+                    break;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(pDestination + destination_index), _mm_unpacklo_epi8(block, _mm_setzero_si128()));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(pDestination + destination_index + 8), _mm_unpackhi_epi8(block, _mm_setzero_si128()));
+            }
+#elif defined(SIMD_NEON)
+            for (; source_index + 16 <= sourceLength; source_index += 16, destination_index += 16)
+            {
+                uint8x16_t block = vld1q_u8(p_source + source_index);
+                if (vmaxvq_u8(block) >= 0x80)
+                    break;
+                vst1q_u16(reinterpret_cast<uint16_t *>(pDestination + destination_index), vmovl_u8(vget_low_u8(block)));
+                vst1q_u16(reinterpret_cast<uint16_t *>(pDestination + destination_index + 8), vmovl_high_u8(block));
+            }
+#endif
+
+            // Decode the sequences of the next block one by one.
+            size_t block_end = (sourceLength - source_index > 16 ? source_index + 16 : sourceLength);
+            while (source_index < block_end)
+            {
+                unsigned char lead_byte = p_source[source_index];
+                if (lead_byte < 0x80)
+                {
+                    pDestination[destination_index++] = static_cast<Char16>(lead_byte);
+                    source_index++;
+                    continue;
+                }
+
+                // The second byte range excludes the overlong forms, the surrogates and the code points above U+10FFFF.
+                size_t sequence_length = 0;
+                char32_t code_point = 0;
+                unsigned char minimum_byte = 0x80, maximum_byte = 0xBF;
+                if (lead_byte >= 0xC2 && lead_byte <= 0xDF)
+                {
+                    sequence_length = 2;
+                    code_point = lead_byte & 0x1F;
+                }
+                else if (lead_byte >= 0xE0 && lead_byte <= 0xEF)
+                {
+                    sequence_length = 3;
+                    code_point = lead_byte & 0x0F;
+                    if (lead_byte == 0xE0)
+                        minimum_byte = 0xA0;
+                    else if (lead_byte == 0xED)
+                        maximum_byte = 0x9F;
+                }
+                else if (lead_byte >= 0xF0 && lead_byte <= 0xF4)
+                {
+                    sequence_length = 4;
+                    code_point = lead_byte & 0x07;
+                    if (lead_byte == 0xF0)
+                        minimum_byte = 0x90;
+                    else if (lead_byte == 0xF4)
+                        maximum_byte = 0x8F;
+                }
+                else
+                {
+                    pDestination[destination_index++] = static_cast<Char16>(0xFFFD);
+                    source_index++;
+                    continue;
+                }
+
+                size_t total_valid_bytes = 1;
+                for (; total_valid_bytes < sequence_length && source_index + total_valid_bytes < sourceLength; total_valid_bytes++)
+                {
+                    unsigned char continuation_byte = p_source[source_index + total_valid_bytes];
+                    if (continuation_byte < minimum_byte || continuation_byte > maximum_byte)
+                        break;
+                    code_point = (code_point << 6) | (continuation_byte & 0x3F);
+                    minimum_byte = 0x80;
+                    maximum_byte = 0xBF;
+                }
+                source_index += total_valid_bytes;
+                if (total_valid_bytes < sequence_length)
+                    pDestination[destination_index++] = static_cast<Char16>(0xFFFD); // Truncated sequence, replaced as a whole.
+                else if (code_point >= 0x10000)
+                {
+                    code_point -= 0x10000;
+                    pDestination[destination_index++] = static_cast<Char16>(0xD800 + (code_point >> 10));
+                    pDestination[destination_index++] = static_cast<Char16>(0xDC00 + (code_point & 0x3FF));
+                }
+                else
+                    pDestination[destination_index++] = static_cast<Char16>(code_point);
+            }
+        }
+
+        return destination_index;
+    }
+
+    /**
+     * @brief Transcode a UTF-16 string to UTF-8.
+     * @note Validating, every unpaired surrogate is replaced with U+FFFD. (Like `WideCharToMultiByte()` on Windows Vista and later)
+     * @note Portable, the ASCII runs are narrowed 16 code units at a time. (SSE2/NEON)
+     *       Usable with `char16_t`, and `wchar_t` where it is 16-bit.
+     * @param pSource Pointer to the UTF-16 string.
+     * @param sourceLength Length of the UTF-16 string. (Code units)
+     * @param pDestination Pointer to the destination buffer, of at least `sourceLength * 3` bytes. [OUT]
+     * @return Returns the number of bytes written.
+     */
+    template <typename Char16>
+    inline size_t TranscodeUtf16ToUtf8(const Char16 *pSource, size_t sourceLength, char *pDestination)
+    {
+        static_assert(sizeof(Char16) == 2, "UTF-16 code units must be 16-bit.");
+
+        size_t source_index = 0, destination_index = 0;
+        while (source_index < sourceLength)
+        {
+            // Narrow the ASCII blocks.
+#if defined(SIMD_SSE2)
+            for (; source_index + 16 <= sourceLength; source_index += 16, destination_index += 16)
+            {
+                __m128i low_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSource + source_index));
+                __m128i high_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pSource + source_index + 8));
+                __m128i non_ascii_bits = _mm_and_si128(_mm_or_si128(low_block, high_block), _mm_set1_epi16(static_cast<SHORT>(0xFF80)));
+                if (_mm_movemask_epi8(_mm_cmpeq_epi16(non_ascii_bits, _mm_setzero_si128())) != 0xFFFF)
+                    break;
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(pDestination + destination_index), _mm_packus_epi16(low_block, high_block));
+            }
+#elif defined(SIMD_NEON)
+            for (; source_index + 16 <= sourceLength; source_index += 16, destination_index += 16)
+            {
+                uint16x8_t low_block = vld1q_u16(reinterpret_cast<const uint16_t *>(pSource + source_index));
+                uint16x8_t high_block = vld1q_u16(reinterpret_cast<const uint16_t *>(pSource + source_index + 8));
+                if (vmaxvq_u16(vorrq_u16(low_block, high_block)) >= 0x80)
+                    break;
+                vst1q_u8(reinterpret_cast<uint8_t *>(pDestination + destination_index), vcombine_u8(vmovn_u16(low_block), vmovn_u16(high_block)));
+            }
+#endif
+
+            // Encode the code points of the next block one by one.
+            size_t block_end = (sourceLength - source_index > 16 ? source_index + 16 : sourceLength);
+            while (source_index < block_end)
+            {
+                char32_t code_point = static_cast<char16_t>(pSource[source_index++]);
+                if (code_point >= 0xD800 && code_point <= 0xDFFF)
+                {
+                    char32_t trail_unit = (source_index < sourceLength ? static_cast<char16_t>(pSource[source_index]) : 0);
+                    if (code_point <= 0xDBFF && trail_unit >= 0xDC00 && trail_unit <= 0xDFFF)
+                    {
+                        code_point = 0x10000 + ((code_point - 0xD800) << 10) + (trail_unit - 0xDC00);
+                        source_index++;
+                    }
+                    else
+                        code_point = 0xFFFD; // Unpaired surrogate.
+                }
+
+                if (code_point < 0x80)
+                    pDestination[destination_index++] = static_cast<char>(code_point);
+                else if (code_point < 0x800)
+                {
+                    pDestination[destination_index++] = static_cast<char>(0xC0 | (code_point >> 6));
+                    pDestination[destination_index++] = static_cast<char>(0x80 | (code_point & 0x3F));
+                }
+                else if (code_point < 0x10000)
+                {
+                    pDestination[destination_index++] = static_cast<char>(0xE0 | (code_point >> 12));
+                    pDestination[destination_index++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                    pDestination[destination_index++] = static_cast<char>(0x80 | (code_point & 0x3F));
+                }
+                else
+                {
+                    pDestination[destination_index++] = static_cast<char>(0xF0 | (code_point >> 18));
+                    pDestination[destination_index++] = static_cast<char>(0x80 | ((code_point >> 12) & 0x3F));
+                    pDestination[destination_index++] = static_cast<char>(0x80 | ((code_point >> 6) & 0x3F));
+                    pDestination[destination_index++] = static_cast<char>(0x80 | (code_point & 0x3F));
+                }
+            }
+        }
+
+        return destination_index;
+    }
+}
+
+#endif // TEXT_H
\ No newline at end of file
@@ -0,0 +1,154 @@
+/**
+ * @file theme.h
+ * @brief Header file containing the portable theme types. (Theme colors, theme tables)
+ * @note Windows-free, only needs `portable_includes.h` and `marco.h`. Shared by the application and the headless tools.
+ */
+
+#ifndef THEME_H
+#define THEME_H
+
+struct MYRGBA; // RGBA color. (graphic.h)
+
+/***************
+ * Theme enums *
+ ***************/
+
+enum class MyTheme
+{
+    Light,
+    Dark,
+    Monokai,
+};
+
+/**
+ * @brief Indices of the themeable UI colors.
+ * @note The order matches the layout of the theme tables and the theme pack files.
+ * @note Bump `UI_THEMEPACK_VERSION` whenever the entries are added, removed or reordered.
+ */
+enum class MyThemeColor : UINT16
+{
+    Primary,
+    Secondary,
+    BorderActive,
+    BorderInactive,
+    TextActive,
+    TextInactive,
+    TextHighlight,
+    Focus,
+    Background,
+    CaptionBackground,
+    CaptionTextActive,
+    CaptionTextInactive,
+    CloseButtonBackgroundOnHover,
+    CloseButtonBackgroundOnActive,
+    MaximizeButtonBackgroundOnHover,
+    MaximizeButtonBackgroundOnActive,
+    MinimizeButtonBackgroundOnHover,
+    MinimizeButtonBackgroundOnActive,
+    StandardButtonDefault,
+    StandardButtonHover,
+    StandardButtonActive,
+    StandardButtonBorderDefault,
+    StandardButtonBorderHover,
+    StandardButtonBorderActive,
+    RadioButtonPrimaryDefault,
+    RadioButtonPrimaryHover,
+    RadioButtonPrimaryActive,
+    RadioButtonSecondaryDefault,
+    RadioButtonSecondaryHover,
+    RadioButtonSecondaryActive,
+    RadioButtonBorderDefault,
+    RadioButtonBorderHover,
+    RadioButtonBorderActive,
+    SelectedRadioButtonPrimaryDefault,
+    SelectedRadioButtonPrimaryHover,
+    SelectedRadioButtonPrimaryActive,
+    SelectedRadioButtonSecondaryDefault,
+    SelectedRadioButtonSecondaryHover,
+    SelectedRadioButtonSecondaryActive,
+    SelectedRadioButtonBorderDefault,
+    SelectedRadioButtonBorderHover,
+    SelectedRadioButtonBorderActive,
+    Editbox,
+    EditboxBorderDefault,
+    EditboxBorderSelected,
+    DDLComboboxDefault,
+    DDLComboboxActive,
+    DDLComboboxBorder,
+    DDLComboboxItemBackground,
+    DDLComboboxSelectedItemBackground,
+    DDLComboboxDropdownlistBorder,
+    DDLComboboxItemTextDefault,
+    DDLComboboxItemTextSelected,
+    ScrollbarBackground,
+    ScrollbarThumbDefault,
+    ScrollbarThumbHover,
+    ScrollbarThumbDragging,
+    Count
+};
+
+/********************
+ * Theme structures *
+ ********************/
+
+/**
+ * @brief Structure-of-arrays table holding the colors of a theme, indexed by `MyThemeColor`.
+ * @note The structure has no padding and is stored as-is in the theme pack files.
+ */
+struct MYTHEMETABLE
+{
+    /**
+     * @brief Build a theme table from a list of RGB triples (fully opaque).
+     * @param colors The RGB triples, ordered by `MyThemeColor`.
+     * @return Returns the theme table.
+     */
+    template <size_t N>
+    static constexpr MYTHEMETABLE fromRGB(const BYTE (&colors)[N][3])
+    {
+        static_assert(N == UI_THEME_COLOR_COUNT, "The theme table must define every themeable UI color.");
+
+        MYTHEMETABLE table = {};
+        for (size_t i = 0; i < N; i++)
+        {
+            table.red[i] = colors[i][0];
+            table.green[i] = colors[i][1];
+            table.blue[i] = colors[i][2];
+            table.alpha[i] = 255;
+        }
+
+        return table;
+    }
+
+    /**
+     * @brief Get a color from the table.
+     * @param color The color index.
+     * @note Implemented in ui.cpp, `MYRGBA` is a graphic type.
+     * @return Returns the RGBA structure of the color.
+     */
+    MYRGBA getColor(MyThemeColor color) const;
+
+    /**
+     * @brief Blend two theme tables.
+     * @note The channels are blended in a single pass over the channel arrays, with an 8-bit fixed-point weight.
+     * @param from The theme table at weight 0.
+     * @param to The theme table at weight 256.
+     * @param weight Specifies the blend weight. (0-256)
+     * @param result Reference to the theme table that receives the blended colors. [OUT]
+     */
+    static void blend(const MYTHEMETABLE &from, const MYTHEMETABLE &to, UINT weight, MYTHEMETABLE &result);
+
+    /**
+     * @brief Get the blend weight of a theme transition frame.
+     * @note The transition is smoothstep eased, it starts and ends slowly.
+     * @param progress Specifies the transition progress. (0.0-1.0, clamped)
+     * @return Returns the blend weight. (0-256, See `blend()`)
+     */
+    static UINT getTransitionWeight(DOUBLE progress);
+
+    BYTE red[UI_THEME_COLOR_COUNT];   // Red channel values.
+    BYTE green[UI_THEME_COLOR_COUNT]; // Green channel values.
+    BYTE blue[UI_THEME_COLOR_COUNT];  // Blue channel values.
+    BYTE alpha[UI_THEME_COLOR_COUNT]; // Alpha channel values.
+};
+
+#endif // THEME_H
\ No newline at end of file
@@ -6,15 +6,39 @@
 #ifndef UI_H
 #define UI_H
 
-/************
- * UI enums *
- ************/
+/*****************
+ * UI structures *
+ *****************/
 
-enum class MyTheme
+/**
+ * @brief Header of a theme pack file.
+ * @note Theme pack layout: `MYTHEMEPACKHEADER` followed by `themeCount` x `MYTHEMETABLE`, the tables are indexed by `MyTheme`.
+ */
+struct MYTHEMEPACKHEADER
+{
+    DWORD signature;  // Theme pack signature. (UI_THEMEPACK_SIGNATURE)
+    WORD version;     // Theme pack format version. (UI_THEMEPACK_VERSION)
+    WORD colorCount;  // Number of colors per theme table. (UI_THEME_COLOR_COUNT)
+    DWORD themeCount; // Number of theme tables following the header.
+};
+
+/**
+ * @brief Statistics of a performance HUD sample. (See `MyPerformanceHud::sample()`)
+ */
+struct MYPERFORMANCEHUDSAMPLE
 {
-    Light,
-    Dark,
-    Monokai,
+    DOUBLE paintsPerSecond;         // Number of painted frames per second. (WM_PAINT)
+    DOUBLE averagePaintTime;        // Average frame paint time. (Milliseconds)
+    DOUBLE maximumPaintTime;        // Longest frame paint time. (Milliseconds)
+    DOUBLE pixelsPerSecond;         // Number of repainted pixels per second.
+    DOUBLE animationTicksPerSecond; // Number of animation timer ticks per second.
+    DOUBLE textLayoutsPerSecond;    // Number of text layouts created per second.
+    DOUBLE hudTimePerSecond;        // Time spent sampling and drawing the HUD per second. (Microseconds)
+    size_t logQueueDepth;           // Number of log records waiting to be written.
+    UINT64 liveRenderTargets;       // Number of live Direct2D render targets.
+    UINT64 liveSolidColorBrushes;   // Number of live Direct2D solid color brushes.
+    UINT64 liveBitmaps;             // Number of live Direct2D bitmaps.
+    UINT64 liveTextFormats;         // Number of live DirectWrite text formats.
 };
 
 /**************
@@ -40,106 +64,55 @@ public:
      */
     ~UIColors();
 
-    // [HELPER FUNCTIONS]
+    // [THEME FUNCTIONS]
 
     /**
-     * @brief Update the main colors.
-     * @param primary Primary color.
-     * @param secondary Secondary color.
-     * @param borderActive Border active color.
-     * @param borderInactive Border inactive color.
-     * @param textActive Text active color.
-     * @param textInactive Text inactive color.
-     * @param textHighlight Text highlight color.
-     * @param focus Focus color.
-     * @param background Background color.
+     * @brief Update the UI colors from a theme table.
+     * @note Colors whose values are unchanged are skipped and keep their existing native resources.
+     * @note The theme table must outlive its use as the current theme table (built-in tables or a loaded theme pack).
+     * @param themeTable The theme table.
+     * @param pChangedColors Pointer to the mask that receives the colors whose values changed. (optional) [OUT]
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool updateMainColors(MYRGBA primary, MYRGBA secondary, MYRGBA borderActive, MYRGBA borderInactive, MYRGBA textActive, MYRGBA textInactive, MYRGBA textHighlight, MYRGBA focus, MYRGBA background);
+    bool updateColors(const MYTHEMETABLE &themeTable, std::bitset<UI_THEME_COLOR_COUNT> *pChangedColors = nullptr);
 
     /**
-     * @brief Update the caption colors.
-     * @param captionBackground Caption background color.
-     * @param captionTextActive Caption text active color.
-     * @param captionTextInactive Caption text inactive color.
-     * @param closeButtonBackgroundOnHover Caption close button hover state background color.
-     * @param closeButtonBackgroundOnActive Caption close button active state background color.
-     * @param maximizeButtonBackgroundOnHover Caption maximize button hover state background color.
-     * @param maximizeButtonBackgroundOnActive Caption maximize button active state background color.
-     * @param minimizeButtonBackgroundOnHover Caption minimize button hover state background color.
-     * @param minimizeButtonBackgroundOnActive Caption minimize button active state background color.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Get the theme table that the UI colors were last updated from.
+     * @return Returns a pointer to the current theme table, nullptr if the colors have not been updated yet.
      */
-    bool updateCaptionColors(MYRGBA captionBackground, MYRGBA captionTextActive, MYRGBA captionTextInactive, MYRGBA closeButtonBackgroundOnHover, MYRGBA closeButtonBackgroundOnActive, MYRGBA maximizeButtonBackgroundOnHover, MYRGBA maximizeButtonBackgroundOnActive, MYRGBA minimizeButtonBackgroundOnHover, MYRGBA minimizeButtonBackgroundOnActive);
+    const MYTHEMETABLE *getThemeTable();
 
     /**
-     * @brief Update the standard button colors.
-     * @param standardButtonDefault Button default state color.
-     * @param standardButtonHover Button hover state color.
-     * @param standardButtonActive Button active state color.
-     * @param standardButtonBorderDefault Button border default state color.
-     * @param standardButtonBorderHover Button border hover state color.
-     * @param standardButtonBorderActive Button border active state color.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
-     */
-    bool updateStandardButtonColors(MYRGBA standardButtonDefault, MYRGBA standardButtonHover, MYRGBA standardButtonActive, MYRGBA standardButtonBorderDefault, MYRGBA standardButtonBorderHover, MYRGBA standardButtonBorderActive);
-
-    /**
-     * @brief Update the radio button colors.
-     * @param radioButtonPrimaryDefault Radio button default state primary color.
-     * @param radioButtonPrimaryHover Radio button hover state primary color.
-     * @param radioButtonPrimaryActive Radio button active state primary color.
-     * @param radioButtonSecondaryDefault Radio button default state secondary color.
-     * @param radioButtonSecondaryHover Radio button hover state secondary color.
-     * @param radioButtonSecondaryActive Radio button active state secondary color.
-     * @param radioButtonBorderDefault Radio button border default state color.
-     * @param radioButtonBorderHover Radio button border hover state color.
-     * @param radioButtonBorderActive Radio button border active state color.
-     * @param selectedRadioButtonPrimaryDefault Radio button default state primary color. (Selected)
-     * @param selectedRadioButtonPrimaryHover Radio button hover state primary color. (Selected)
-     * @param selectedRadioButtonPrimaryActive Radio button active state primary color. (Selected)
-     * @param selectedRadioButtonSecondaryDefault Radio button default state secondary color. (Selected)
-     * @param selectedRadioButtonSecondaryHover Radio button hover state secondary color. (Selected)
-     * @param selectedRadioButtonSecondaryActive Radio button active state secondary color. (Selected)
-     * @param selectedRadioButtonBorderDefault Radio button border default state color. (Selected)
-     * @param selectedRadioButtonBorderHover Radio button border hover state color. (Selected)
-     * @param selectedRadioButtonBorderActive Radio button border active state color. (Selected)
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Get the built-in theme table of a theme.
+     * @param theme The theme name.
+     * @return Returns a pointer to the built-in theme table, nullptr if the theme is unknown.
      */
-    bool updateRadioButtonColors(MYRGBA radioButtonPrimaryDefault, MYRGBA radioButtonPrimaryHover, MYRGBA radioButtonPrimaryActive, MYRGBA radioButtonSecondaryDefault, MYRGBA radioButtonSecondaryHover, MYRGBA radioButtonSecondaryActive, MYRGBA radioButtonBorderDefault, MYRGBA radioButtonBorderHover, MYRGBA radioButtonBorderActive, MYRGBA selectedRadioButtonPrimaryDefault, MYRGBA selectedRadioButtonPrimaryHover, MYRGBA selectedRadioButtonPrimaryActive, MYRGBA selectedRadioButtonSecondaryDefault, MYRGBA selectedRadioButtonSecondaryHover, MYRGBA selectedRadioButtonSecondaryActive, MYRGBA selectedRadioButtonBorderDefault, MYRGBA selectedRadioButtonBorderHover, MYRGBA selectedRadioButtonBorderActive);
+    static const MYTHEMETABLE *getBuiltInThemeTable(MyTheme theme);
 
     /**
-     * @brief Update the editbox colors.
-     * @param editbox Editbox default state color.
-     * @param editboxBorderDefault Editbox border default state color.
-     * @param editboxBorderSelected Editbox border selected state color.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Find the theme color index of a color name.
+     * @note The names match the `MyThemeColor` entries, case-insensitive.
+     * @param colorName The color name.
+     * @param color Reference to the variable that receives the color index. [OUT]
+     * @return Returns true if the color name is found, false otherwise.
      */
-    bool updateEditboxColors(MYRGBA editbox, MYRGBA editboxBorderDefault, MYRGBA editboxBorderSelected);
+    static bool findThemeColor(const std::string &colorName, MyThemeColor &color);
 
     /**
-     * @brief Update the drop-down list combobox colors.
-     * @param ddlComboboxDefault Combobox default state color.
-     * @param ddlComboboxActive Combobox active state color.
-     * @param ddlComboboxBorder Combobox border color.
-     * @param ddlComboboxItemBackground Combobox item background color.
-     * @param ddlComboboxSelectedItemBackground Combobox selected item background color.
-     * @param ddlComboboxDropdownlistBorder Combobox drop-down list window border color.
-     * @param ddlComboboxItemTextDefault Combobox item text default state color.
-     * @param ddlComboboxItemTextSelected Combobox item text selected state color.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Find the theme color index of a color object.
+     * @param pColor Pointer to the color object.
+     * @param color Reference to the variable that receives the color index. [OUT]
+     * @return Returns true if the color object is one of the themeable colors of this instance, false otherwise.
      */
-    bool updateDDLComboboxColors(MYRGBA ddlComboboxDefault, MYRGBA ddlComboboxActive, MYRGBA t_ddlComboboxBorder, MYRGBA ddlComboboxItemBackground, MYRGBA ddlComboboxSelectedItemBackground, MYRGBA ddlComboboxDropdownlistBorder, MYRGBA ddlComboboxItemTextDefault, MYRGBA ddlComboboxItemTextSelected);
+    bool findThemeColor(const MyColor *pColor, MyThemeColor &color);
 
     /**
-     * @brief Update the scrollbar colors.
-     * @param scrollbarBackground Scrollbar background color.
-     * @param scrollbarThumbDefault Scrollbar thumb default state color.
-     * @param scrollbarThumbHover Scrollbar thumb hover state color.
-     * @param scrollbarThumbDragging Scrollbar thumb dragging state color.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Get the colors that a window type reads when creating its resources and animations.
+     * @note Colors referenced by the subclass configuration structures of a window are not included, see `MyWindow::isColorDependent()`.
+     * @param windowType The window type.
+     * @return Returns the color mask.
      */
-    bool updateScrollbarColors(MYRGBA scrollbarBackground, MYRGBA scrollbarThumbDefault, MYRGBA scrollbarThumbHover, MYRGBA scrollbarThumbDragging);
+    static std::bitset<UI_THEME_COLOR_COUNT> getDependentColors(MyWindowType windowType);
 
 public:
     // [APPLICATION UI COLORS]
@@ -228,7 +201,10 @@ public:
     HBRUSH nullBrush = reinterpret_cast<HBRUSH>(GetStockObject(NULL_BRUSH));
 
 private:
-    inline static bool instanceExists = false; // Indicate whether the instance already exists.
+    static MyColor UIColors::*const themeColorFields[UI_THEME_COLOR_COUNT]; // Pointers to the themeable color members, indexed by `MyThemeColor`.
+    static const char *const themeColorNames[UI_THEME_COLOR_COUNT];         // Names of the themeable colors, indexed by `MyThemeColor`.
+    const MYTHEMETABLE *pThemeTable = nullptr;                              // Pointer to the current theme table.
+    inline static bool instanceExists = false;                              // Indicate whether the instance already exists.
 };
 
 /**
@@ -293,6 +269,7 @@ private:
 /**
  * @brief Singleton class encapsulating and managing the UI image objects.
  * @note This class is part of the UIManager class.
+ * @note The images are decoded on first use, `prefetchImages()` decodes the images visible at startup ahead of time.
  */
 class UIImages
 {
@@ -318,6 +295,36 @@ public:
      */
     bool updateNonClientImages(MyTheme theme);
 
+    /**
+     * @brief Decode the images visible at startup in parallel on the thread pool.
+     * @note The non-client images of the specified theme, the drop-down list arrow and the default state of the image buttons.
+     *       The other image states are decoded on first use.
+     * @param theme The theme name.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool prefetchImages(MyTheme theme);
+
+    /**
+     * @brief Wait for the prefetch work in progress to complete.
+     */
+    void waitForPrefetch();
+
+    /**
+     * @brief Add the pixels of the decoded images to the startup snapshot. (See `MyStartupSnapshot::addEntry()`)
+     * @note The images that are not decoded are skipped, the next start decodes them on first use.
+     * @param snapshot Reference to the startup snapshot.
+     * @return Returns the number of added images.
+     */
+    UINT addToSnapshot(MyStartupSnapshot &snapshot);
+
+private:
+    /**
+     * @brief Thread pool callback, decodes a prefetched image.
+     * @param pInstance The callback instance.
+     * @param pContext Pointer to the image. (MyWICBitmap *)
+     */
+    static void CALLBACK prefetchCallback(PTP_CALLBACK_INSTANCE pInstance, PVOID pContext);
+
 public:
     // [APPLICATION UI IMAGES]
 
@@ -363,7 +370,11 @@ public:
     MyWICBitmap *pWicBitmapDDLComboboxArrow = nullptr;
 
 private:
-    inline static bool instanceExists = false; // Indicate whether the instance already exists.
+    inline static bool instanceExists = false;                 // Indicate whether the instance already exists.
+    TP_CALLBACK_ENVIRON prefetchEnvironment = {};              // Thread pool environment of the prefetch work.
+    PTP_CLEANUP_GROUP pPrefetchCleanupGroup = nullptr;         // Cleanup group of the prefetch work, null if no prefetch work is submitted.
+    inline static std::atomic<UINT> totalPendingPrefetches{0}; // Number of submitted images that are not decoded yet.
+    inline static LARGE_INTEGER prefetchStartTime = {};        // Time of the `prefetchImages()` call.
 };
 
 /**
@@ -406,6 +417,203 @@ private:
     inline static bool instanceExists = false; // Indicate whether the instance already exists.
 };
 
+/**
+ * @brief Class representing a memory-mapped theme pack file.
+ * @note The theme tables are read in place from the mapped view, the file stays mapped until the pack is unloaded.
+ */
+class MyThemePack
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR/..]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyThemePack();
+
+    /**
+     * @brief Destructor.
+     * @note The theme pack file will be unloaded.
+     */
+    ~MyThemePack();
+
+    // [UTILITY FUNCTIONS]
+
+    /**
+     * @brief Map a theme pack file into memory and validate it.
+     * @note Any previously loaded theme pack file will be unloaded beforehand.
+     * @param filePath Specifies the theme pack file path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool load(const std::wstring &filePath);
+
+    /**
+     * @brief Unmap the loaded theme pack file.
+     * @note Theme tables previously retrieved from the pack become invalid.
+     */
+    void unload();
+
+    /**
+     * @brief Check if a theme pack file is loaded.
+     * @return Returns true if a theme pack file is loaded, false otherwise.
+     */
+    bool isLoaded();
+
+    /**
+     * @brief Get the theme table of a theme from the loaded theme pack file.
+     * @param theme The theme name.
+     * @return Returns a pointer to the theme table, nullptr if no theme pack is loaded or the pack doesn't contain the theme.
+     */
+    const MYTHEMETABLE *getThemeTable(MyTheme theme);
+
+    /**
+     * @brief Write a theme pack file.
+     * @param filePath Specifies the theme pack file path.
+     * @param pThemeTables Pointer to the theme tables, indexed by `MyTheme`.
+     * @param themeCount Specifies the number of theme tables.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    static bool write(const std::wstring &filePath, const MYTHEMETABLE *pThemeTables, DWORD themeCount);
+
+private:
+    HANDLE hFile = INVALID_HANDLE_VALUE; // Handle to the theme pack file.
+    HANDLE hFileMapping = nullptr;       // Handle to the theme pack file mapping object.
+    const BYTE *pView = nullptr;         // Pointer to the mapped view of the theme pack file.
+    DWORD themeCount = 0;                // Number of theme tables in the loaded theme pack file.
+};
+
+/**
+ * @brief Performance HUD, an overlay showing the paint, animation and resource statistics of the application.
+ * @note The statistics are recorded on the UI thread while the HUD is enabled, the paint scopes and the animation timers only check a flag until then.
+ *       The HUD samples the statistics every `MyApp::performanceHudInterval` and draws the last sample with a sparkline of the average frame paint times.
+ * @note This class is part of the UIManager class.
+ */
+class MyPerformanceHud
+{
+public:
+    // [CONSTRUCTOR/DESTRUCTOR/..]
+
+    /**
+     * @brief Default constructor.
+     */
+    MyPerformanceHud();
+
+    // [PERFORMANCE HUD FUNCTIONS]
+
+    /**
+     * @brief Check if the HUD records the statistics.
+     * @return Returns true if the HUD is enabled, false otherwise.
+     */
+    bool isEnabled() const
+    {
+        return this->isRecording;
+    }
+
+    /**
+     * @brief Enable or disable the HUD.
+     * @note Enabling the HUD discards the previous statistics, disabling it releases the device resources.
+     * @param isEnabled Specifies whether the HUD records the statistics.
+     */
+    void setEnabled(bool isEnabled);
+
+    /**
+     * @brief Record a painted frame. (See `MyPerformanceHudPaintScope`)
+     * @param paintRect Specifies the repainted rectangle.
+     * @param startTime Specifies the performance counter value at the paint start.
+     */
+    void recordPaint(const RECT &paintRect, LONGLONG startTime);
+
+    /**
+     * @brief Record an animation timer tick.
+     */
+    void recordAnimationTick()
+    {
+        if (this->isRecording)
+            this->totalAnimationTicks++;
+    }
+
+    /**
+     * @brief Compute the statistics since the previous sample and start a new sample.
+     */
+    void sample();
+
+    /**
+     * @brief Draw the last sample.
+     * @param hdc Specifies the HUD window device context.
+     * @param rect Specifies the HUD window client rectangle.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool draw(HDC hdc, const RECT &rect);
+
+private:
+    /**
+     * @brief Create the HUD device resources.
+     * @note Any existing device resources will be automatically released beforehand.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool createDeviceResources();
+
+public:
+    inline static const INT hudWidth = 270;  // HUD window width. (Pixels)
+    inline static const INT hudHeight = 170; // HUD window height. (Pixels)
+
+private:
+    bool isRecording = false;                          // Indicate whether the HUD records the statistics.
+    LONGLONG counterFrequency = 1;                     // Performance counter frequency.
+    UINT64 totalPaints = 0;                            // Number of painted frames in the current sample.
+    UINT64 totalPaintedPixels = 0;                     // Number of repainted pixels in the current sample.
+    LONGLONG totalPaintTime = 0;                       // Total frame paint time in the current sample. (Performance counter ticks)
+    LONGLONG maximumPaintTime = 0;                     // Longest frame paint time in the current sample. (Performance counter ticks)
+    UINT64 totalAnimationTicks = 0;                    // Number of animation timer ticks in the current sample.
+    LONGLONG totalHudTime = 0;                         // Time spent sampling and drawing the HUD in the current sample. (Performance counter ticks)
+    LONGLONG lastSampleTime = 0;                       // Performance counter value at the current sample start.
+    UINT64 lastTotalTextLayouts = 0;                   // Number of text layouts created at the current sample start.
+    MYPERFORMANCEHUDSAMPLE lastSample = {};            // Statistics of the last sample.
+    inline static const size_t sparklineLength = 64;   // Number of samples shown by the sparkline.
+    FLOAT averagePaintTimes[sparklineLength] = {};     // Average frame paint time of the latest samples, indexed by sample number. (Milliseconds)
+    size_t totalSamples = 0;                           // Number of samples since the HUD was enabled.
+    inline static const FLOAT frameTimeBudget = 16.7f; // Frame paint time budget, marked on the sparkline. (Milliseconds)
+
+    // Device resources.
+    std::unique_ptr<ID2D1DCRenderTarget *, ID2D1DCRenderTargetDeleter> pRenderTarget;
+    std::unique_ptr<ID2D1SolidColorBrush *, ID2D1SolidColorBrushDeleter> pSolidColorBrush;
+    std::unique_ptr<IDWriteTextFormat *, IDWriteTextFormatDeleter> pTextFormat;
+};
+
+/**
+ * @brief Performance HUD paint scope, records the frame paint time of a WM_PAINT handler.
+ * @note Nothing is recorded if the HUD is disabled when the scope starts.
+ */
+class MyPerformanceHudPaintScope
+{
+public:
+    /**
+     * @brief Constructor.
+     * @param hud Specifies the HUD.
+     * @param paintRect Specifies the repainted rectangle. (PAINTSTRUCT::rcPaint)
+     */
+    MyPerformanceHudPaintScope(MyPerformanceHud &hud, const RECT &paintRect)
+        : pHud(hud.isEnabled() ? &hud : nullptr), paintRect(paintRect), startTime(this->pHud ? MyProfiler::getTime() : 0) {}
+
+    /**
+     * @brief Destructor.
+     * @note The frame is recorded.
+     */
+    ~MyPerformanceHudPaintScope()
+    {
+        if (this->pHud)
+            this->pHud->recordPaint(this->paintRect, this->startTime);
+    }
+
+    MyPerformanceHudPaintScope(const MyPerformanceHudPaintScope &) = delete;
+    MyPerformanceHudPaintScope &operator=(const MyPerformanceHudPaintScope &) = delete;
+
+private:
+    MyPerformanceHud *pHud; // The HUD, null if the HUD was disabled.
+    RECT paintRect;         // Repainted rectangle.
+    LONGLONG startTime;     // Performance counter value at the paint start.
+};
+
 /**
  * @brief Singleton class encapsulating and managing all the UI-related resources.
  * @note All graphic/UI-related resources or operations can be accessed via this interface.
@@ -431,10 +639,47 @@ public:
 
     /**
      * @brief Update the UI resources to match the specified theme.
+     * @note The theme colors are taken from the loaded theme pack if it contains the theme, from the built-in theme tables otherwise.
+     * @note The theme overrides (see `loadThemeOverrides()`) are applied on top of the theme colors.
+     * @param theme Specifies the theme name.
+     * @param pChangedColors Pointer to the mask that receives the colors whose values changed. (optional) [OUT]
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool updateUITheme(MyTheme theme, std::bitset<UI_THEME_COLOR_COUNT> *pChangedColors = nullptr);
+
+    /**
+     * @brief Start a color transition from the current UI colors to the colors of the specified theme.
+     * @note Only the UI colors are transitioned, call `updateUITheme()` once the transition completes to update the remaining resources.
      * @param theme Specifies the theme name.
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool updateUITheme(MyTheme theme);
+    bool beginThemeTransition(MyTheme theme);
+
+    /**
+     * @brief Update the UI colors to the specified point of the current color transition.
+     * @param weight Specifies the transition progress. (0-256)
+     * @param pChangedColors Pointer to the mask that receives the colors whose values changed. (optional) [OUT]
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool stepThemeTransition(UINT weight, std::bitset<UI_THEME_COLOR_COUNT> *pChangedColors = nullptr);
+
+    /**
+     * @brief Load the theme overrides from a theme file.
+     * @note Any previously loaded theme overrides are discarded, a missing file clears the overrides.
+     * @note Call `updateUITheme()` afterward to apply the overrides.
+     * @note File format: `<Color name> = <Red>, <Green>, <Blue>[, <Alpha>]`, one color per line, lines starting with '#' are ignored.
+     *       Colors defined before any `[Light]`, `[Dark]` or `[Monokai]` section header apply to all themes.
+     *       Section names match the whole theme name (case-insensitive), the colors of an unknown section are skipped.
+     * @param filePath Specifies the theme file path.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool loadThemeOverrides(const std::wstring &filePath);
+
+    /**
+     * @brief Get the colors used by the application window device resources.
+     * @return Returns the color mask.
+     */
+    std::bitset<UI_THEME_COLOR_COUNT> getDependentColors();
 
     // [DIRECT2D FUNCTIONS]
 
@@ -447,6 +692,13 @@ public:
      */
     bool createDeviceResources();
 
+    /**
+     * @brief Update the application window brush colors to the current UI colors.
+     * @note The device resources are kept, use this instead of `createDeviceResources()` when only the colors changed. (e.g. theme transition frames)
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool recolorDeviceResources();
+
 public:
     // Application window render target and device resources.
     std::unique_ptr<ID2D1DCRenderTarget *, ID2D1DCRenderTargetDeleter> pRenderTarget;
@@ -460,11 +712,30 @@ public:
     UIFonts fonts;
     UIImages images;
     UIMiscs miscs;
+    MyThemePack themePack;           // Optional theme pack, its theme tables take precedence over the built-in ones.
+    MyPerformanceHud performanceHud; // Performance HUD overlay.
 
 private:
-    MyGraphicEngine *pGraphic = nullptr;       // Pointer to the graphic engine.
-    HWND &hAppWindow;                          // Reference to the application window handle.
-    inline static bool instanceExists = false; // Indicate whether the instance already exists.
+    // [THEME FUNCTIONS]
+
+    /**
+     * @brief Get the theme table of the specified theme, with the theme overrides applied.
+     * @param theme Specifies the theme name.
+     * @return Returns the pointer to the theme table, nullptr if the theme is unknown.
+     * @note The returned table is only valid until the next call.
+     */
+    const MYTHEMETABLE *resolveThemeTable(MyTheme theme);
+
+private:
+    MyGraphicEngine *pGraphic = nullptr;                                  // Pointer to the graphic engine.
+    HWND &hAppWindow;                                                     // Reference to the application window handle.
+    MYTHEMETABLE themeOverrideTables[UI_THEME_COUNT] = {};                // Theme override colors, indexed by `MyTheme`.
+    std::bitset<UI_THEME_COLOR_COUNT> themeOverrideMasks[UI_THEME_COUNT]; // Masks of the overridden colors, indexed by `MyTheme`.
+    MYTHEMETABLE overriddenThemeTable = {};                               // The current theme table with the overrides applied.
+    MYTHEMETABLE transitionFromTable = {};                                // The UI colors at the start of the current color transition.
+    MYTHEMETABLE transitionToTable = {};                                  // The UI colors at the end of the current color transition.
+    MYTHEMETABLE transitionFrameTable = {};                               // The UI colors of the current color transition frame.
+    inline static bool instanceExists = false;                            // Indicate whether the instance already exists.
 };
 
 #endif // UI_H
\ No newline at end of file
@@ -6,18 +6,6 @@
 #ifndef UTILITY_H
 #define UTILITY_H
 
-/*****************
- * Utility enums *
- *****************/
-
-enum class MyLogType
-{
-    Info,
-    Warn,
-    Error,
-    Debug,
-};
-
 /***************************
  * Global helper functions *
  ***************************/
@@ -155,7 +143,8 @@ namespace MyUtility
      * @param checkBoundaries Specifies whether to check word boundaries.
      *                         If true, the word must be surrounded by word boundaries (space, punctuation, etc.) to be considered a match.
      *                         If false, the function will search for partial matches as well.
-     * @note `<string>`, `<cwctype>`
+     * @note Allocation-free, the case-insensitive search folds the ASCII letters. (SSE2 candidate search when available)
+     * @note `<string>`, `<emmintrin.h>`
      * @return Returns true if the string contains the whole word, false otherwise.
      */
     bool ContainsWord(const std::string &str, const std::string &word, bool caseSensitive = false, bool checkBoundaries = false);
@@ -168,7 +157,9 @@ namespace MyUtility
      * @param checkBoundaries Specifies whether to check word boundaries.
      *                         If true, the word must be surrounded by word boundaries (space, punctuation, etc.) to be considered a match.
      *                         If false, the function will search for partial matches as well.
-     * @note `<string>`, `<cwctype>`
+     * @note Allocation-free, the case-insensitive search folds the ASCII letters, and the other characters with the Unicode
+     *       ordinal case mapping. (SSE2 candidate search when available)
+     * @note `<windows.h>`, `<string>`, `<cwctype>`, `<emmintrin.h>`
      * @return Returns true if the string contains the whole word, false otherwise.
      */
     bool ContainsWord(const std::wstring &str, const std::wstring &word, bool caseSensitive = false, bool checkBoundaries = false);
@@ -190,17 +181,19 @@ namespace MyUtility
     bool ContainsDigit(const std::wstring &str);
 
     /**
-     * @brief Converts a string (std::string) to a wide string (std::wstring).
+     * @brief Converts a UTF-8 string (std::string) to a UTF-16 wide string (std::wstring).
      * @param str The string to convert.
-     * @note `<windows.h>`, `<string>`, `<memory>`
+     * @note The invalid sequences are replaced with U+FFFD. (See `TranscodeUtf8ToUtf16()`)
+     * @note `<string>`
      * @return Returns the converted string.
      */
     std::wstring ConvertStringToWideString(const std::string &str);
 
     /**
-     * @brief Converts a wide string (std::wstring) to a string (std::string).
+     * @brief Converts a UTF-16 wide string (std::wstring) to a UTF-8 string (std::string).
      * @param str The string to convert.
-     * @note `<windows.h>`, `<string>`, `<memory>`
+     * @note The unpaired surrogates are replaced with U+FFFD. (See `TranscodeUtf16ToUtf8()`)
+     * @note `<string>`
      * @return Returns the converted string.
      */
     std::string ConvertWideStringToString(const std::wstring &wstr);
@@ -208,7 +201,7 @@ namespace MyUtility
     /**
      * @brief Removes non-digit characters from a given string.
      * @param str The input string from which non-digit characters are to be removed.
-     * @note `<string>`, `<regex>`
+     * @note `<string>`
      * @return Returns the resulting string with non-digit characters removed.
      */
     std::string RemoveNonDigitFromString(const std::string &str);
@@ -216,7 +209,7 @@ namespace MyUtility
     /**
      * @brief Removes non-digit characters from a given string.
      * @param str The input string from which non-digit characters are to be removed.
-     * @note `<string>`, `<regex>`
+     * @note `<string>`
      * @return Returns the resulting string with non-digit characters removed.
      */
     std::wstring RemoveNonDigitFromString(const std::wstring &str);
@@ -291,169 +284,58 @@ private:
 };
 
 /**
- * @brief Simple logging utility for handling application logs.
+ * @brief Watches a single file for modifications without blocking.
+ * @note The parent directory is watched with a change notification object, the file last write time
+ *       is then compared so changes to other files in the same directory are ignored.
  */
-class MyLogger
+class MyFileWatcher
 {
 public:
-    // [CONSTRUCTOR/DESTRUCTOR/..]
+    // [CONSTRUCTOR/DESTRUCTOR FUNCTIONS]
 
     /**
      * @brief Default constructor.
-     * @note Use command line path as logging path by default.
-     */
-    MyLogger();
-
-    /**
-     * @brief Constructor 1.
-     * @param path Specifies the custom logging path.
-     */
-    MyLogger(std::wstring path);
-
-    // [LOGGING FUNCTIONS]
-
-    /**
-     * @brief Get the current log level.
-     * @return Returns the current log level.
      */
-    int getLogLevel();
+    MyFileWatcher();
 
     /**
-     * @brief Set a new logging path.
-     * @note Set to empty string to use command line path.
-     * @param path Specifies the custom logging path.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Destructor.
      */
-    bool setPath(std::wstring path = L"");
+    ~MyFileWatcher();
 
-    /**
-     * @brief Set a new log level.
-     * @param logLevel Specifies the log level.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
-     */
-    bool setLogLevel(int logLevel = 1);
+    // [UTILITY FUNCTIONS]
 
     /**
-     * @brief Set a new log file name.
-     * @param logFileName Specifies the log file name.
+     * @brief Start watching a file.
+     * @note The file doesn't need to exist yet, its creation is reported as a change.
+     * @param filePath Specifies the file path.
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool setLogFileName(std::wstring logFileName = L"log.log");
+    bool watch(const std::wstring &filePath);
 
     /**
-     * @brief Write a log record.
-     * @param description Specifies the log description.
-     * @param extraDescription Specifies the log extra description. (optional)
-     * @param logType Specifies the log type. (optional)
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Stop watching the file.
      */
-    bool writeLog(std::string description, std::string extraDescription = "", MyLogType logType = MyLogType::Info);
+    void unwatch();
 
     /**
-     * @brief Write a custom log record.
-     * @note Log level is ignored.
-     * @param description Specifies the log description.
-     * @param includeTime Specifies whether to include the time string.
-     * @return Returns true if all the operations are successfully performed, false otherwise.
+     * @brief Check if the watched file has been created, modified or deleted since the last check.
+     * @note This function never blocks and is cheap enough to be polled from a timer.
+     * @return Returns true if the file has changed, false otherwise.
      */
-    bool writeLog(std::string description, bool includeTime);
+    bool hasChanged();
 
 private:
-    // [HELPER FUNCTIONS]
-
     /**
-     * @brief Get the current date and time as a formatted string.
-     * @note Visit: http://en.cppreference.com/Width/cpp/chrono/c/strftime
-     * @note for more information about date/time format.
-     * @return Returns the current date and time string formatted as "%Y-%m-%d.%X", empty string otherwise.
+     * @brief Retrieve the last write time of the watched file.
+     * @param lastWriteTime Reference to the variable that receives the last write time, zero if the file doesn't exist. [OUT]
      */
-    std::string getCurrentDateTimeString();
+    void getLastWriteTime(ULONGLONG &lastWriteTime);
 
 private:
-    std::filesystem::path path;
-    std::wstring logFileName = L"log.log";
-    int logLevel = 1;
-};
-
-/****************************************
- * Deleter structs (for smart pointers) *
- ****************************************/
-
-// Deleter base struct:
-
-struct Deleter
-{
-    Deleter();
-    inline static MyLogger logger;
-};
-
-// WinAPI deleters:
-
-struct HWNDDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(HWND *variable) const;
-};
-struct HBRUSHDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(HBRUSH *variable) const;
-};
-struct HFONTDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(HFONT *variable) const;
-};
-struct HRGNDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(HRGN *variable) const;
-};
-
-// WAM deleters:
-
-struct IUIAnimationStoryboardDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(IUIAnimationStoryboard **variable) const;
-};
-struct IUIAnimationVariableDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(IUIAnimationVariable **variable) const;
-};
-struct IUIAnimationTransitionDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(IUIAnimationTransition **variable) const;
-};
-
-// Direct2D/DirectWrite deleters:
-
-struct IWICBitmapSourceDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(IWICBitmapSource **variable) const;
-};
-struct IDWriteTextFormatDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(IDWriteTextFormat **variable) const;
-};
-struct ID2D1DCRenderTargetDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(ID2D1DCRenderTarget **variable) const;
-};
-struct ID2D1SolidColorBrushDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(ID2D1SolidColorBrush **variable) const;
-};
-struct ID2D1BitmapDeleter : public Deleter
-{
-    inline static bool debugMode = false;
-    void operator()(ID2D1Bitmap **variable) const;
+    std::wstring filePath = L"";                       // The watched file path.
+    HANDLE hChangeNotification = INVALID_HANDLE_VALUE; // Handle to the parent directory change notification object.
+    ULONGLONG lastWriteTime = 0;                       // The last known write time of the file, zero if the file doesn't exist.
 };
 
 #endif // UTILITY_H
\ No newline at end of file
@@ -419,9 +419,19 @@ public:
     /**
      * @brief Refresh the window appearance.
      * @note This has no effect on custom windows `MyWindowType::Custom`.
+     * @param isColorOnly Specifies whether to only update the colors, the device resources are kept. (Used by the theme transition frames)
      * @return Returns true if all the operations are successfully performed, false otherwise.
      */
-    bool refresh();
+    bool refresh(bool isColorOnly = false);
+
+    /**
+     * @brief Check if the window appearance depends on any of the specified theme colors.
+     * @note Both the colors used by the window type and the colors referenced by its subclass configuration structures are checked.
+     * @note Custom windows `MyWindowType::Custom` never depend on theme colors.
+     * @param colors Specifies the color mask.
+     * @return Returns true if the window depends on any of the colors, false otherwise.
+     */
+    bool isColorDependent(const std::bitset<UI_THEME_COLOR_COUNT> &colors);
 
     // [WINDOW CREATION FUNCTIONS]
 
@@ -549,6 +559,16 @@ public:
      */
     bool refresh(bool redrawContainerWindow = false);
 
+    /**
+     * @brief Refresh and invalidate the container windows whose appearance depends on any of the specified theme colors.
+     * @note The windows are only invalidated, the caller decides when to update them.
+     * @param colors Specifies the color mask.
+     * @param totalRefreshedWindows Reference to the variable that receives the number of refreshed windows. [OUT]
+     * @param isColorOnly Specifies whether to only update the window colors, the device resources are kept.
+     * @return Returns true if all the operations are successfully performed, false otherwise.
+     */
+    bool refreshColorDependents(const std::bitset<UI_THEME_COLOR_COUNT> &colors, UINT &totalRefreshedWindows, bool isColorOnly = false);
+
     /**
      * @brief Update the container window dimensions.
      * @note Automatically update the container scrollbar windows dimensions if exists.
@@ -0,0 +1,335 @@
+/**
+ * @file allocation_tracker.cpp
+ * @brief Implementation of the user-defined types defined in allocation_tracker.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/**********************************************
+ * Allocation tracker classes implementations *
+ **********************************************/
+
+// [MyAllocationTracker] class implementations:
+
+void MyAllocationTracker::setEnabled(bool isEnabled)
+{
+    // Start a new report interval, the allocations counted before are not reported.
+    if (isEnabled && !MyAllocationTracker::isEnabled())
+    {
+        UINT64 previous_context = MyAllocationTracker::currentContext;
+        MyAllocationTracker::currentContext = MyAllocationTracker::ignoredContext;
+        for (MYALLOCATIONCOUNTER &counter : MyAllocationTracker::counters)
+        {
+            counter.reportedAllocations = counter.totalAllocations.load(std::memory_order_relaxed);
+            counter.reportedBytes = counter.totalBytes.load(std::memory_order_relaxed);
+        }
+        MyAllocationTracker::reportedUnattributedAllocations = MyAllocationTracker::totalUnattributedAllocations.load(std::memory_order_relaxed);
+        MyAllocationTracker::reportedUnattributedBytes = MyAllocationTracker::totalUnattributedBytes.load(std::memory_order_relaxed);
+        MyAllocationTracker::lastReportTime = GetTickCount64();
+        MyAllocationTracker::currentContext = previous_context;
+    }
+
+    MyAllocationTracker::isTracking.store(isEnabled, std::memory_order_relaxed);
+}
+void MyAllocationTracker::recordAllocation(size_t size)
+{
+    UINT64 key = MyAllocationTracker::currentContext;
+    if (key == MyAllocationTracker::ignoredContext)
+        return;
+    if (!key)
+    {
+        MyAllocationTracker::totalUnattributedAllocations.fetch_add(1, std::memory_order_relaxed);
+        MyAllocationTracker::totalUnattributedBytes.fetch_add(size, std::memory_order_relaxed);
+        return;
+    }
+
+    // The messages of a thread are mostly dispatched in bursts of the same message, skip the table lookup for repeated contexts.
+    MYALLOCATIONCOUNTER *p_counter = MyAllocationTracker::pCachedCounter;
+    if (!p_counter || p_counter->key.load(std::memory_order_relaxed) != key)
+    {
+        p_counter = MyAllocationTracker::findCounter(key);
+        if (!p_counter)
+        {
+            MyAllocationTracker::totalDroppedAllocations.fetch_add(1, std::memory_order_relaxed);
+            return;
+        }
+        MyAllocationTracker::pCachedCounter = p_counter;
+    }
+    p_counter->totalAllocations.fetch_add(1, std::memory_order_relaxed);
+    p_counter->totalBytes.fetch_add(size, std::memory_order_relaxed);
+}
+UINT64 MyAllocationTracker::enterContext(UINT message, UINT controlId)
+{
+    UINT64 previous_context = MyAllocationTracker::currentContext;
+    if (!MyAllocationTracker::isEnabled() || previous_context == MyAllocationTracker::ignoredContext)
+        return previous_context;
+
+    // The top bit keeps the key of WM_NULL on the application window from being 0 (unattributed).
+    MyAllocationTracker::currentContext = (1ULL << 63) | (static_cast<UINT64>(message & 0x7FFFFFFF) << 32) | controlId;
+    return previous_context;
+}
+size_t MyAllocationTracker::writeReport(MyLogger &logger, size_t maximumRows)
+{
+    UINT64 previous_context = MyAllocationTracker::currentContext;
+    MyAllocationTracker::currentContext = MyAllocationTracker::ignoredContext;
+
+    ULONGLONG current_time = GetTickCount64();
+    ULONGLONG elapsed_time = current_time - MyAllocationTracker::lastReportTime;
+    MyAllocationTracker::lastReportTime = current_time;
+    if (!elapsed_time)
+        elapsed_time = 1;
+
+    // Collect the counters that allocated since the previous report.
+    struct REPORTROW
+    {
+        UINT64 key;
+        UINT64 allocations;
+        UINT64 bytes;
+    };
+    std::vector<REPORTROW> rows;
+    UINT64 total_allocations = 0, total_bytes = 0;
+    for (MYALLOCATIONCOUNTER &counter : MyAllocationTracker::counters)
+    {
+        UINT64 key = counter.key.load(std::memory_order_acquire);
+        if (!key)
+            continue;
+
+        UINT64 allocations = counter.totalAllocations.load(std::memory_order_relaxed);
+        UINT64 bytes = counter.totalBytes.load(std::memory_order_relaxed);
+        REPORTROW row = {key, allocations - counter.reportedAllocations, bytes - counter.reportedBytes};
+        counter.reportedAllocations = allocations;
+        counter.reportedBytes = bytes;
+        if (!row.allocations)
+            continue;
+
+        total_allocations += row.allocations;
+        total_bytes += row.bytes;
+        rows.push_back(row);
+    }
+    UINT64 unattributed_allocations = MyAllocationTracker::totalUnattributedAllocations.load(std::memory_order_relaxed);
+    UINT64 unattributed_bytes = MyAllocationTracker::totalUnattributedBytes.load(std::memory_order_relaxed);
+    UINT64 new_unattributed_allocations = unattributed_allocations - MyAllocationTracker::reportedUnattributedAllocations;
+    UINT64 new_unattributed_bytes = unattributed_bytes - MyAllocationTracker::reportedUnattributedBytes;
+    MyAllocationTracker::reportedUnattributedAllocations = unattributed_allocations;
+    MyAllocationTracker::reportedUnattributedBytes = unattributed_bytes;
+
+    std::sort(rows.begin(), rows.end(), [](const REPORTROW &left, const REPORTROW &right)
+              { return (left.allocations != right.allocations ? left.allocations > right.allocations : left.bytes > right.bytes); });
+    if (rows.size() > maximumRows)
+        rows.resize(maximumRows);
+
+    if (total_allocations || new_unattributed_allocations)
+    {
+        MY_LOG(logger, MyLogType::Info, "Allocation report:", "'Attributed: {} allocation(s)/s, {} byte(s)/s, unattributed: {} allocation(s)/s, {} byte(s)/s, dropped: {}'",
+               total_allocations * 1000 / elapsed_time, total_bytes * 1000 / elapsed_time, new_unattributed_allocations * 1000 / elapsed_time,
+               new_unattributed_bytes * 1000 / elapsed_time, MyAllocationTracker::totalDroppedAllocations.load(std::memory_order_relaxed));
+    }
+    for (const REPORTROW &row : rows)
+    {
+        UINT message = static_cast<UINT>(row.key >> 32) & 0x7FFFFFFF;
+        UINT control_id = static_cast<UINT>(row.key);
+        const char *message_name = MyAllocationTracker::getMessageName(message);
+        char message_number[16] = "";
+        if (!message_name)
+        {
+            snprintf(message_number, sizeof(message_number), "0x%04X", message);
+            message_name = message_number;
+        }
+        MY_LOG(logger, MyLogType::Info, "Allocation report:", "'{} ({}): {} allocation(s)/s, {} byte(s)/s'",
+               message_name, control_id, row.allocations * 1000 / elapsed_time, row.bytes * 1000 / elapsed_time);
+    }
+
+    MyAllocationTracker::currentContext = previous_context;
+    return rows.size();
+}
+MYALLOCATIONCOUNTER *MyAllocationTracker::findCounter(UINT64 key)
+{
+    // Open addressing with linear probing, the counters are never released so a claimed slot keeps its key.
+    UINT index = static_cast<UINT>((key * 0x9E3779B97F4A7C15ULL) >> 32) & (MyAllocationTracker::maximumCounters - 1);
+    for (UINT i = 0; i < MyAllocationTracker::maximumCounters; i++)
+    {
+        MYALLOCATIONCOUNTER &counter = MyAllocationTracker::counters[(index + i) & (MyAllocationTracker::maximumCounters - 1)];
+        UINT64 counter_key = counter.key.load(std::memory_order_acquire);
+        if (counter_key == key)
+            return &counter;
+        if (!counter_key)
+        {
+            if (counter.key.compare_exchange_strong(counter_key, key, std::memory_order_acq_rel) || counter_key == key)
+                return &counter;
+        }
+    }
+
+    return nullptr;
+}
+const char *MyAllocationTracker::getMessageName(UINT message)
+{
+    switch (message)
+    {
+    case WM_CREATE:
+        return "WM_CREATE";
+    case WM_DESTROY:
+        return "WM_DESTROY";
+    case WM_MOVE:
+        return "WM_MOVE";
+    case WM_SIZE:
+        return "WM_SIZE";
+    case WM_SETFOCUS:
+        return "WM_SETFOCUS";
+    case WM_KILLFOCUS:
+        return "WM_KILLFOCUS";
+    case WM_ENABLE:
+        return "WM_ENABLE";
+    case WM_SETTEXT:
+        return "WM_SETTEXT";
+    case WM_GETTEXT:
+        return "WM_GETTEXT";
+    case WM_GETTEXTLENGTH:
+        return "WM_GETTEXTLENGTH";
+    case WM_PAINT:
+        return "WM_PAINT";
+    case WM_CLOSE:
+        return "WM_CLOSE";
+    case WM_ERASEBKGND:
+        return "WM_ERASEBKGND";
+    case WM_SHOWWINDOW:
+        return "WM_SHOWWINDOW";
+    case WM_SETCURSOR:
+        return "WM_SETCURSOR";
+    case WM_DRAWITEM:
+        return "WM_DRAWITEM";
+    case WM_SETFONT:
+        return "WM_SETFONT";
+    case WM_WINDOWPOSCHANGING:
+        return "WM_WINDOWPOSCHANGING";
+    case WM_WINDOWPOSCHANGED:
+        return "WM_WINDOWPOSCHANGED";
+    case WM_NOTIFY:
+        return "WM_NOTIFY";
+    case WM_GETMINMAXINFO:
+        return "WM_GETMINMAXINFO";
+    case WM_NCCREATE:
+        return "WM_NCCREATE";
+    case WM_NCDESTROY:
+        return "WM_NCDESTROY";
+    case WM_NCCALCSIZE:
+        return "WM_NCCALCSIZE";
+    case WM_NCHITTEST:
+        return "WM_NCHITTEST";
+    case WM_NCPAINT:
+        return "WM_NCPAINT";
+    case WM_NCACTIVATE:
+        return "WM_NCACTIVATE";
+    case WM_NCMOUSEMOVE:
+        return "WM_NCMOUSEMOVE";
+    case WM_NCLBUTTONDOWN:
+        return "WM_NCLBUTTONDOWN";
+    case WM_KEYDOWN:
+        return "WM_KEYDOWN";
+    case WM_KEYUP:
+        return "WM_KEYUP";
+    case WM_CHAR:
+        return "WM_CHAR";
+    case WM_COMMAND:
+        return "WM_COMMAND";
+    case WM_TIMER:
+        return "WM_TIMER";
+    case WM_HSCROLL:
+        return "WM_HSCROLL";
+    case WM_VSCROLL:
+        return "WM_VSCROLL";
+    case WM_CTLCOLOREDIT:
+        return "WM_CTLCOLOREDIT";
+    case WM_CTLCOLORLISTBOX:
+        return "WM_CTLCOLORLISTBOX";
+    case WM_CTLCOLORSTATIC:
+        return "WM_CTLCOLORSTATIC";
+    case WM_MOUSEMOVE:
+        return "WM_MOUSEMOVE";
+    case WM_LBUTTONDOWN:
+        return "WM_LBUTTONDOWN";
+    case WM_LBUTTONUP:
+        return "WM_LBUTTONUP";
+    case WM_LBUTTONDBLCLK:
+        return "WM_LBUTTONDBLCLK";
+    case WM_MOUSEWHEEL:
+        return "WM_MOUSEWHEEL";
+    case WM_MOUSEHOVER:
+        return "WM_MOUSEHOVER";
+    case WM_MOUSELEAVE:
+        return "WM_MOUSELEAVE";
+    case WM_CAPTURECHANGED:
+        return "WM_CAPTURECHANGED";
+    case WM_DPICHANGED:
+        return "WM_DPICHANGED";
+    }
+
+    return nullptr;
+}
+
+/*******************************************************
+ * Global allocation functions (`MyAllocationTracker`) *
+ ******************************************************/
+
+#if ALLOCATION_TRACKING_COMPILE_ENABLED
+// The replacements count the allocation and forward to the C runtime heap, the over-aligned variants are not replaced.
+void *operator new(size_t size)
+{
+    if (MyAllocationTracker::isEnabled())
+        MyAllocationTracker::recordAllocation(size);
+
+    // Call the new handler until the allocation succeeds, as the default allocation function does.
+    void *p_memory = nullptr;
+    while (!(p_memory = malloc(size ? size : 1)))
+    {
+        std::new_handler new_handler = std::get_new_handler();
+        if (!new_handler)
+            throw std::bad_alloc();
+        new_handler();
+    }
+    return p_memory;
+}
+void *operator new[](size_t size)
+{
+    return operator new(size);
+}
+void *operator new(size_t size, const std::nothrow_t &) noexcept
+{
+    try
+    {
+        return operator new(size);
+    }
+    catch (...)
+    {
+        return nullptr;
+    }
+}
+void *operator new[](size_t size, const std::nothrow_t &nothrow) noexcept
+{
+    return operator new(size, nothrow);
+}
+void operator delete(void *pMemory) noexcept
+{
+    free(pMemory);
+}
+void operator delete[](void *pMemory) noexcept
+{
+    free(pMemory);
+}
+void operator delete(void *pMemory, size_t) noexcept
+{
+    free(pMemory);
+}
+void operator delete[](void *pMemory, size_t) noexcept
+{
+    free(pMemory);
+}
+void operator delete(void *pMemory, const std::nothrow_t &) noexcept
+{
+    free(pMemory);
+}
+void operator delete[](void *pMemory, const std::nothrow_t &) noexcept
+{
+    free(pMemory);
+}
+#endif
@@ -5,10 +5,14 @@
 
 #include "../Headers/standard_includes.h" // Include standard libraries.
 #include "../Headers/my_includes.h"       // Include my user-defined type headers.
+#include "../Headers/config_schema.h"     // Include the configuration file schema.
+
+static_assert(sizeof(APP_CONFIG_LOG_FORMAT_CHOICES) / sizeof(APP_CONFIG_LOG_FORMAT_CHOICES[0]) == static_cast<size_t>(MyLogFormat::Binary) + 1, "The log format option must define a choice for every log format.");
 
 // [MyApp] class implementations:
 
 MyApp::MyApp()
+    : config(APP_CONFIG_SCHEMA), fileConfig(APP_CONFIG_SCHEMA)
 {
     if (!MyApp::instanceExists)
         MyApp::instanceExists = true;
@@ -17,6 +21,18 @@ MyApp::MyApp()
         this->logger.writeLog("The MyApp instance already exists.", "[CLASS: 'MyApp' | FUNC: 'Constructor']", MyLogType::Error);
         throw std::runtime_error("The MyApp instance already exists.");
     }
+
+    // The deleters write to the application logger, the log file has a single writer.
+    Deleter::setLogger(&this->logger);
+
+    // Log the invalid lines skipped by the configuration file parser.
+    this->fileConfig.setWarningCallback([this](const std::string &description, const std::string &details)
+                                        { this->logger.writeLog(description, details, MyLogType::Warn); });
+
+    // Apply the configuration changes once per batch. (Errors are logged by `applyConfigurationChanges()`)
+    std::bitset<static_cast<size_t>(MyConfigKey::Count)> all_keys;
+    this->config.subscribe(all_keys.set(), [this](const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &changedKeys)
+                           { this->applyConfigurationChanges(changedKeys); });
 }
 MyApp::~MyApp()
 {
@@ -28,6 +44,8 @@ bool MyApp::isInitialized() const
 }
 bool MyApp::initialize(HINSTANCE hInstance)
 {
+    MY_STARTUP_PHASE(this->startupTracer, "Initialize");
+
     bool are_all_operation_success = false;
     std::string error_message = "";
     while (!are_all_operation_success)
@@ -48,7 +66,7 @@ bool MyApp::initialize(HINSTANCE hInstance)
                 error_message = "Failed to initialize the common controls.";
                 break;
             }
-            this->logger.writeLog("Visual style enabled.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Visual style enabled.", "");
         }
 
         // Enable DPI Awareness.
@@ -57,7 +75,7 @@ bool MyApp::initialize(HINSTANCE hInstance)
             error_message = "Failed to set DPI awareness.";
             break;
         }
-        this->logger.writeLog("DPI awareness is set to system-aware.", "", MyLogType::Debug);
+        MY_LOG(this->logger, MyLogType::Debug, "DPI awareness is set to system-aware.", "");
 
         // Enable the DWM MCSS.
         {
@@ -67,7 +85,7 @@ bool MyApp::initialize(HINSTANCE hInstance)
                 error_message = "Failed to enable Multimedia Class Schedule Service (MMCSS).";
                 break;
             }
-            this->logger.writeLog("Multimedia Class Schedule Service (MMCSS) enabled.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Multimedia Class Schedule Service (MMCSS) enabled.", "");
         }
 
         // Set the minimum resolution for periodic timers to increase the precision of application timers (WM_TIMER).
@@ -77,7 +95,7 @@ bool MyApp::initialize(HINSTANCE hInstance)
                 error_message = "Failed to set minimum resolution for periodic timers.";
                 break;
             }
-            this->logger.writeLog("Minimum resolution for periodic timers sets (1).", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Minimum resolution for periodic timers sets (1).", "");
         }
 
         // Register my window class.
@@ -95,7 +113,7 @@ bool MyApp::initialize(HINSTANCE hInstance)
                 error_message = "Failed to register the window class.";
                 break;
             }
-            this->logger.writeLog("Registered window class:", ("'" + MyUtility::ConvertWideStringToString(this->windowClassName) + "'").c_str(), MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Registered window class:", "'{}'", MyUtility::ConvertWideStringToString(this->windowClassName));
         }
 
         // Retrieve the user Windows version to ensure compatibility.
@@ -111,7 +129,7 @@ bool MyApp::initialize(HINSTANCE hInstance)
             this->windowsBuildNumber &= ~0xF0000000;
             if (this->windowsBuildNumber >= 22000)
                 this->isWindows11BorderAttributeSupported = true;
-            this->logger.writeLog("Windows version:", ("'" + std::to_string(this->windowsMajorVersion) + "." + std::to_string(this->windowsMinorVersion) + "." + std::to_string(this->windowsBuildNumber) + " Build " + std::to_string(this->windowsBuildNumber) + "'").c_str(), MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Windows version:", "'{}.{}.{} Build {}'", this->windowsMajorVersion, this->windowsMinorVersion, this->windowsBuildNumber, this->windowsBuildNumber);
         }
 
         // Load WinAPI libraries.
@@ -122,7 +140,7 @@ bool MyApp::initialize(HINSTANCE hInstance)
                 error_message = "Failed to load WinAPI libraries.";
                 break;
             }
-            this->logger.writeLog("WinAPI libraries loaded successfully.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "WinAPI libraries loaded successfully.", "");
         }
 
         // Initialize the COM library.
@@ -133,34 +151,83 @@ bool MyApp::initialize(HINSTANCE hInstance)
                 error_message = "Failed to initialize the COM library.";
                 break;
             }
-            this->logger.writeLog("COM library initialized successfully.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "COM library initialized successfully.", "");
         }
 
         // Initialize graphic engine.
         {
+            MY_STARTUP_PHASE(this->startupTracer, "Graphic engine");
             this->pGraphic = std::make_unique<MyGraphicEngine>();
             if (!pGraphic->initialize())
             {
                 error_message = "Failed to initialize the graphic engine.";
                 break;
             }
-            this->logger.writeLog("Graphic engine initialized successfully.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Graphic engine initialized successfully.", "");
         }
 
         // Initialize UI manager.
         {
+            MY_STARTUP_PHASE(this->startupTracer, "UI manager");
             this->pUIManager = std::make_unique<UIManager>(this->pGraphic.get(), this->hWnd);
-            this->logger.writeLog("UI manager initialized successfully.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "UI manager initialized successfully.", "");
+        }
+
+        // Load the theme pack file and the theme file (optional).
+        // The theme pack tables take precedence over the built-in ones, the theme file colors override both.
+        {
+            MY_STARTUP_PHASE(this->startupTracer, "Theme files");
+            std::wstring command_line = GetCommandLineW();
+            if (command_line.size() <= 2)
+            {
+                error_message = "Unexpected command line string.";
+                break;
+            }
+            command_line.erase(0, 1);
+            command_line.pop_back();
+            std::filesystem::path path(command_line);
+
+            std::wstring theme_pack_path = path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->themePackFileName.c_str();
+            if (std::filesystem::exists(theme_pack_path))
+            {
+                if (this->pUIManager->themePack.load(theme_pack_path))
+                    MY_LOG(this->logger, MyLogType::Debug, "Theme pack loaded:", "'{}'", MyUtility::ConvertWideStringToString(this->themePackFileName));
+                else
+                    this->logger.writeLog("Failed to load the theme pack file, the built-in themes will be used.", "[CLASS: 'MyApp' | FUNC: 'initialize()']", MyLogType::Warn);
+            }
+
+            this->themeFilePath = path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->themeFileName.c_str();
+            this->inputRecordingFilePath = path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->inputRecordingFileName.c_str();
+            this->snapshotFilePath = path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->snapshotFileName.c_str();
+            this->startupTraceFilePath = path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->startupTraceFileName.c_str();
+            if (!this->pUIManager->loadThemeOverrides(this->themeFilePath))
+                this->logger.writeLog("Failed to load the theme file, the theme overrides will be ignored.", "[CLASS: 'MyApp' | FUNC: 'initialize()']", MyLogType::Warn);
+            // The theme file is optional, the application runs without the hot-reload if it can't be watched.
+            if (this->themeFileWatcher.watch(this->themeFilePath))
+                MY_LOG(this->logger, MyLogType::Debug, "Watching theme file:", "'{}'", MyUtility::ConvertWideStringToString(this->themeFileName));
+            else
+                this->logger.writeLog("Failed to watch the theme file, the theme overrides will not be reloaded.", "[CLASS: 'MyApp' | FUNC: 'initialize()']", MyLogType::Warn);
+        }
+
+        // Map the startup snapshot (optional), then decode the images visible at startup on the thread pool while the windows are created.
+        // The images held by the snapshot are restored from it, the images that are not prefetched are decoded on first use.
+        {
+            MY_STARTUP_PHASE(this->startupTracer, "Image prefetch");
+            if (this->config.getValue(MyConfigKey::StartupSnapshot) != 0 && this->startupSnapshot.open(this->snapshotFilePath, MyStartupSnapshot::getValidationStamp()))
+                MY_LOG(this->logger, MyLogType::Debug, "Startup snapshot mapped:", "'{} entries'", this->startupSnapshot.getTotalEntries());
+            if (!this->pUIManager->images.prefetchImages(this->windowTheme))
+                this->logger.writeLog("Failed to prefetch the images, the images will be decoded on first use.", "[CLASS: 'MyApp' | FUNC: 'initialize()']", MyLogType::Warn);
         }
 
         // Initialize my subclass classes.
         {
+            MY_STARTUP_PHASE(this->startupTracer, "Subclass classes");
             if (!InitializeSubclassClasses(&this->pGraphic, &this->pUIManager, this->hWnd))
             {
                 error_message = "Failed to initialize subclass classes.";
                 break;
             }
-            this->logger.writeLog("Subclass classes initialized successfully.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Subclass classes initialized successfully.", "");
         }
 
         this->initialized = true;
@@ -193,18 +260,25 @@ bool MyApp::uninitialize()
             MyEditboxSubclass::releaseSharedDeviceResources();
             MyDDLComboboxSubclass::releaseSharedDeviceResources();
             MyVerticalScrollbarSubclass::releaseSharedDeviceResources();
-            this->logger.writeLog("Subclass classes resources released.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Subclass classes resources released.", "");
             if (!UninitializeSubclassClasses())
             {
                 error_message = "Failed to uninitialize subclass classes.";
                 break;
             }
-            this->logger.writeLog("Subclass classes uninitialized.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Subclass classes uninitialized.", "");
         }
 
         // Uninitialize UI manager.
         this->pUIManager.reset();
-        this->logger.writeLog("UI manager uninitialized.", "", MyLogType::Debug);
+        MY_LOG(this->logger, MyLogType::Debug, "UI manager uninitialized.", "");
+
+        // Unmap the startup snapshot, the images no longer read it.
+        this->startupSnapshot.close();
+
+        // Release the pooled solid brushes.
+        MySolidBrushPool::release();
+        MY_LOG(this->logger, MyLogType::Debug, "Solid brush pool released.", "");
 
         // Uninitialize the graphic engine.
         if (!this->pGraphic->uninitialize())
@@ -213,11 +287,11 @@ bool MyApp::uninitialize()
             break;
         }
         this->pGraphic.reset();
-        this->logger.writeLog("Graphic engine uninitialized.", "", MyLogType::Debug);
+        MY_LOG(this->logger, MyLogType::Debug, "Graphic engine uninitialized.", "");
 
         // Uninitialize the COM library.
         CoUninitialize();
-        this->logger.writeLog("COM library uninitialized.", "", MyLogType::Debug);
+        MY_LOG(this->logger, MyLogType::Debug, "COM library uninitialized.", "");
 
         // Unregister my window class.
         if (!UnregisterClassW(this->windowClassName, this->hInstance))
@@ -225,7 +299,7 @@ bool MyApp::uninitialize()
             error_message = "Failed to unregister the window class.";
             break;
         }
-        this->logger.writeLog("Window class unregistered.", "", MyLogType::Debug);
+        MY_LOG(this->logger, MyLogType::Debug, "Window class unregistered.", "");
 
         // Clears previously set minimum timer resolution.
         {
@@ -234,9 +308,13 @@ bool MyApp::uninitialize()
                 error_message = "Failed to clear previously set minimum timer resolution.";
                 break;
             }
-            this->logger.writeLog("Previously set minimum timer resolution cleared.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Previously set minimum timer resolution cleared.", "");
         }
 
+        // Write the pending configuration file content and stop the writer.
+        this->configWriter.stop();
+        MY_LOG(this->logger, MyLogType::Debug, "Configuration file writer stopped:", "'{} update(s), {} write(s)'", this->configWriter.getTotalSubmits(), this->configWriter.getTotalWrites());
+
         this->initialized = false;
         are_all_operation_success = true;
     }
@@ -248,6 +326,8 @@ bool MyApp::uninitialize()
 }
 bool MyApp::loadConfigurationFile()
 {
+    MY_STARTUP_PHASE(this->startupTracer, "Configuration");
+
     bool are_all_operation_success = false;
     std::string error_message = "";
     while (!are_all_operation_success)
@@ -262,142 +342,416 @@ bool MyApp::loadConfigurationFile()
         command_line.erase(0, 1);
         command_line.pop_back();
         std::filesystem::path path(command_line);
+        this->configurationFilePath = path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->configurationFileName.c_str();
 
-        std::ifstream config_file((path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->configurationFileName.c_str()).c_str()); // Create file reading stream.
-        if (config_file.is_open())
+        // Collect the command line options. (e.g. `--Theme=Dark --Debug=2`)
+        std::string command_line_options = "";
+        INT argument_count = 0;
+        LPWSTR *p_arguments = CommandLineToArgvW(GetCommandLineW(), &argument_count);
+        if (p_arguments)
         {
-            std::string line;
-            while (std::getline(config_file, line))
+            for (INT i = 1; i < argument_count; i++)
             {
-                // line.erase(std::remove_if(line.begin(), line.end(), isspace), line.end()); // Remove all whitespaces from the line.
-                if (line[0] == '#' || line.empty())
-                    continue; // Ignore lines starting with '#' or empty lines.
+                std::wstring argument = p_arguments[i];
+                if (argument.size() > 2 && argument[0] == L'-' && argument[1] == L'-')
+                    command_line_options += MyUtility::ConvertWideStringToString(argument.substr(2)) + "\n";
+            }
+            LocalFree(p_arguments);
+        }
+        this->commandLineOptions.clear();
+        if (!command_line_options.empty())
+        {
+            MyConfigStore command_line_config(APP_CONFIG_SCHEMA);
+            command_line_config.setWarningCallback([this](const std::string &description, const std::string &details)
+                                                   { this->logger.writeLog(description, details, MyLogType::Warn); });
+            command_line_config.parse(command_line_options.c_str(), command_line_options.size());
+            for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+            {
+                MyConfigKey key = static_cast<MyConfigKey>(i);
+                if (command_line_config.isDefined(key))
+                    this->commandLineOptions[key] = command_line_config.getValue(key);
+            }
+        }
 
-                auto delimiter_pos = line.find("=");
-                auto name = line.substr(0, delimiter_pos);
-                auto value = line.substr(delimiter_pos + 1);
-                if (value[0] == ' ')
-                    value = line.substr(delimiter_pos + 2);
+        // Load the file options and apply the command line options on top of them.
+        bool is_file_found = false;
+        if (!this->fileConfig.load(this->configurationFilePath, is_file_found))
+        {
+            error_message = "Failed to load the configuration file.";
+            break;
+        }
+        this->mergeConfigurationOptions();
 
-                if (MyUtility::ContainsWord(name, "Debug")) // Debug level.
-                {
-                    // Perform additional check on the value string to avoid crashes from stoi() function.
-                    std::string converted_value = MyUtility::RemoveNonDigitFromString(value);
-                    if (!converted_value.empty() && MyUtility::ContainsDigit(converted_value))
-                    {
-                        int int_value = std::stoi(converted_value);
-                        this->logger.setLogLevel(int_value);
-                    }
-                    else
-                        this->logger.setLogLevel(1);
-                }
-                else if (MyUtility::ContainsWord(name, "Theme")) // Theme.
+        // Start the configuration file writer, then create the configuration file with the default options if it doesn't exist.
+        if (!this->configWriter.start(this->configurationFilePath))
+        {
+            error_message = "Failed to start the configuration file writer.";
+            break;
+        }
+        if (!is_file_found && !this->configWriter.submit(this->fileConfig.serialize()))
+        {
+            error_message = "Failed to create the configuration file.";
+            break;
+        }
+
+        this->logger.setLogLevel(this->config.getValue(MyConfigKey::Debug));
+        this->windowTheme = static_cast<MyTheme>(this->config.getValue(MyConfigKey::Theme));
+
+        // Start watching the configuration file for external edits.
+        if (!this->configurationFileWatcher.watch(this->configurationFilePath))
+        {
+            error_message = "Failed to watch the configuration file.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'loadConfigurationFile()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyApp::updateConfigurationFile(std::string optionName, std::string optionValue)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        MyConfigKey key;
+        if (!this->config.findKey(optionName, key))
+        {
+            error_message = "Invalid option name.";
+            break;
+        }
+        if (!this->fileConfig.setValue(key, optionValue))
+        {
+            error_message = "Invalid option value.";
+            break;
+        }
+
+        // The option is set from the UI, it's no longer overridden by the command line.
+        this->commandLineOptions.erase(key);
+        this->config.setValue(key, this->fileConfig.getValue(key));
+
+        // Only the file options are written, the file is written in the background. (See `MyConfigWriter`)
+        if (!this->configWriter.submit(this->fileConfig.serialize()))
+        {
+            error_message = "Failed to submit the configuration file content.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'updateConfigurationFile()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyApp::reloadConfigurationFile()
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        // Read the configuration file. (A missing file resets the options to their default values)
+        std::string file_content = "";
+        std::ifstream configuration_file(this->configurationFilePath.c_str(), std::ios::binary);
+        std::error_code error_code;
+        if (!configuration_file && std::filesystem::exists(this->configurationFilePath, error_code))
+        {
+            error_message = "Failed to open the configuration file.";
+            break;
+        }
+        if (configuration_file)
+            file_content.assign(std::istreambuf_iterator<char>(configuration_file), std::istreambuf_iterator<char>());
+
+        // Ignore the changes caused by the configuration file writer, the file may hold an older content than the options.
+        if (this->configWriter.isOwnContent(file_content))
+        {
+            are_all_operation_success = true;
+            break;
+        }
+
+        // Reload the file options and apply the command line options on top of them.
+        this->fileConfig.reset();
+        this->fileConfig.parse(file_content.data(), file_content.size());
+        this->mergeConfigurationOptions();
+        MY_LOG(this->logger, MyLogType::Debug, "Configuration file reloaded.", "");
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'reloadConfigurationFile()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+void MyApp::mergeConfigurationOptions()
+{
+    this->config.beginBatch();
+    for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+        this->config.setValue(static_cast<MyConfigKey>(i), this->fileConfig.getValue(static_cast<MyConfigKey>(i)));
+    for (const auto &[key, value] : this->commandLineOptions)
+        this->config.setValue(key, value);
+    this->config.endBatch();
+}
+bool MyApp::applyConfigurationChanges(const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &changedKeys)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::Debug)))
+        {
+            this->logger.setLogLevel(this->config.getValue(MyConfigKey::Debug));
+            MY_LOG(this->logger, MyLogType::Info, "Log level changed:", "'{}'", this->config.getValue(MyConfigKey::Debug));
+        }
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::LogFormat)))
+        {
+            if (!this->logger.setLogFormat(static_cast<MyLogFormat>(this->config.getValue(MyConfigKey::LogFormat))))
+            {
+                error_message = "Failed to change the log format.";
+                break;
+            }
+            MY_LOG(this->logger, MyLogType::Info, "Log format changed:", "'{}'", APP_CONFIG_LOG_FORMAT_CHOICES[this->config.getValue(MyConfigKey::LogFormat)]);
+        }
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::LogSegmentSize)) || changedKeys.test(static_cast<size_t>(MyConfigKey::LogSegmentCount)))
+        {
+            size_t segment_size = static_cast<size_t>(this->config.getValue(MyConfigKey::LogSegmentSize)) * 1024;
+            UINT segment_count = static_cast<UINT>(this->config.getValue(MyConfigKey::LogSegmentCount));
+            if (!this->logger.setLogRotation(segment_size, segment_count))
+            {
+                error_message = "Failed to change the log file rotation.";
+                break;
+            }
+            MY_LOG(this->logger, MyLogType::Info, "Log file rotation changed:", "'{} segment(s) of {} KiB'", segment_count, this->config.getValue(MyConfigKey::LogSegmentSize));
+        }
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::Profiler)))
+        {
+            this->profiler.setEnabled(this->config.getValue(MyConfigKey::Profiler) != 0);
+            MY_LOG(this->logger, MyLogType::Info, "Profiler changed:", "'{}'", APP_CONFIG_PROFILER_CHOICES[this->config.getValue(MyConfigKey::Profiler)]);
+        }
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::AllocationTracker)))
+        {
+            // The report timer is started by `onReady()` if the window is not ready yet.
+            // Without the replaced allocation functions, the tracker would only report empty intervals.
+            bool is_tracker_enabled = (ALLOCATION_TRACKING_COMPILE_ENABLED && this->config.getValue(MyConfigKey::AllocationTracker) != 0);
+            if (!is_tracker_enabled && this->config.getValue(MyConfigKey::AllocationTracker) != 0)
+                MY_LOG(this->logger, MyLogType::Warn, "Allocation tracker unavailable:", "'The allocation functions are not replaced in this build. (ALLOCATION_TRACKING_COMPILE_ENABLED)'");
+            MyAllocationTracker::setEnabled(is_tracker_enabled);
+            if (this->isWindowReady)
+            {
+                if (!is_tracker_enabled)
+                    KillTimer(this->hWnd, MyApp::IDT_ALLOCATION_REPORT);
+                else if (!SetTimer(this->hWnd, MyApp::IDT_ALLOCATION_REPORT, MyAllocationTracker::reportInterval, NULL))
                 {
-                    if (MyUtility::ContainsWord(value, "Light"))
-                        this->windowTheme = MyTheme::Light;
-                    else if (MyUtility::ContainsWord(value, "Dark"))
-                        this->windowTheme = MyTheme::Dark;
-                    else if (MyUtility::ContainsWord(value, "Monokai"))
-                        this->windowTheme = MyTheme::Monokai;
-                    else
-                        this->windowTheme = MyTheme::Monokai;
+                    error_message = "Failed to start the allocation report timer.";
+                    break;
                 }
             }
-            config_file.close();
+            MY_LOG(this->logger, MyLogType::Info, "Allocation tracker changed:", "'{}'", APP_CONFIG_ALLOCATION_TRACKER_CHOICES[this->config.getValue(MyConfigKey::AllocationTracker)]);
         }
-        else
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::PerformanceHud)))
         {
-            std::ofstream new_config_file((path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->configurationFileName.c_str()).c_str());
-            if (!new_config_file.is_open())
+            // The HUD is shown by `onReady()` if the window is not ready yet.
+            if (this->isWindowReady && !this->showPerformanceHud(this->config.getValue(MyConfigKey::PerformanceHud) != 0))
             {
-                error_message = "Failed to create the configuration file.";
+                error_message = "Failed to change the performance HUD visibility.";
                 break;
             }
+            MY_LOG(this->logger, MyLogType::Info, "Performance HUD changed:", "'{}'", APP_CONFIG_PERFORMANCE_HUD_CHOICES[this->config.getValue(MyConfigKey::PerformanceHud)]);
+        }
 
-            new_config_file << "# Available themes: Light, Dark, Monokai.\n# Available settings: Debug\n\nTheme = Monokai\nDebug = 1";
-            new_config_file.close();
-            continue;
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::InputRecording)))
+        {
+            // The recording or the replay is started by `onReady()` if the window is not ready yet.
+            if (this->isWindowReady && !this->updateInputRecording())
+            {
+                error_message = "Failed to change the input recording mode.";
+                break;
+            }
+            MY_LOG(this->logger, MyLogType::Info, "Input recording changed:", "'{}'", APP_CONFIG_INPUT_RECORDING_CHOICES[this->config.getValue(MyConfigKey::InputRecording)]);
+        }
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::StartupSnapshot)))
+        {
+            // The snapshot is mapped during the initialization, the change applies to the snapshot written on exit and the next start.
+            MY_LOG(this->logger, MyLogType::Info, "Startup snapshot changed:", "'{}'", APP_CONFIG_STARTUP_SNAPSHOT_CHOICES[this->config.getValue(MyConfigKey::StartupSnapshot)]);
+        }
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::StartupTrace)))
+        {
+            // The trace is written once the first frame is drawn, the change applies to the next start.
+            MY_LOG(this->logger, MyLogType::Info, "Startup trace changed:", "'{}'", APP_CONFIG_STARTUP_TRACE_CHOICES[this->config.getValue(MyConfigKey::StartupTrace)]);
+        }
+
+        if (changedKeys.test(static_cast<size_t>(MyConfigKey::Theme)))
+        {
+            // UI actions switch the theme themselves before updating the option.
+            MyTheme theme = static_cast<MyTheme>(this->config.getValue(MyConfigKey::Theme));
+            if (theme != this->windowTheme)
+            {
+                if (!this->isWindowReady)
+                    this->windowTheme = theme;
+                else
+                {
+                    if (!this->setAppTheme(theme))
+                    {
+                        error_message = "Failed to update application theme.";
+                        break;
+                    }
+
+                    auto p_container = this->findContainer(IDC_DC_CONTAINER);
+                    if (p_container)
+                    {
+                        auto p_combobox_window = p_container->findWindow(IDC_DC_COMBOBOXSELECTTHEME);
+                        if (p_combobox_window)
+                            ComboBox_SetCurSel(p_combobox_window->hWnd(), static_cast<INT>(theme));
+                    }
+                }
+            }
         }
 
         are_all_operation_success = true;
     }
 
     if (!are_all_operation_success)
-        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'loadConfigurationFile()']", MyLogType::Error);
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'applyConfigurationChanges()']", MyLogType::Error);
 
     return are_all_operation_success;
 }
-bool MyApp::updateConfigurationFile(std::string optionName, std::string optionValue)
+bool MyApp::setAppTheme(MyTheme theme)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
     while (!are_all_operation_success)
     {
-        std::wstring command_line = GetCommandLineW();
-        if (command_line.size() <= 2)
+        if (!this->isWindowReady)
         {
-            error_message = "Unexpected command line string.";
-            throw std::runtime_error("Unexpected command line string.");
+            error_message = "The application window isn't ready yet.";
             break;
         }
-        command_line.erase(0, 1);
-        command_line.pop_back();
-        std::filesystem::path path(command_line);
-
-        std::string current_app_debug_level_string = "";
-        std::string current_app_theme_string = "";
-        std::string final_string = "";
 
-        std::ofstream config_file((path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->configurationFileName.c_str()).c_str());
-        if (!config_file.is_open())
+        // Start the color transition from the current UI colors, the theme is applied when the transition completes.
+        this->windowTheme = theme;
+        if (!this->pUIManager->beginThemeTransition(this->windowTheme))
         {
-            error_message = "Failed to create the configuration file.";
+            error_message = "Failed to start the theme transition.";
             break;
         }
+        QueryPerformanceCounter(&this->themeTransitionStartTime);
+        this->themeTransitionFrameCount = 0;
+        this->themeTransitionTotalFrameTime = 0.0;
+        this->themeTransitionMaxFrameTime = 0.0;
 
-        if (MyUtility::ContainsWord(optionName, "debug"))
+        if (!this->isThemeTransitionActive)
         {
-            switch (this->windowTheme)
+            if (!SetTimer(this->hWnd, MyApp::IDT_THEME_TRANSITION, MyApp::themeTransitionFrameInterval, NULL))
             {
-            case MyTheme::Light:
-                current_app_theme_string = "Light";
-                break;
-            case MyTheme::Dark:
-                current_app_theme_string = "Dark";
+                error_message = "Failed to start the theme transition timer.";
                 break;
-            case MyTheme::Monokai:
-                current_app_theme_string = "Monokai";
+            }
+            this->isThemeTransitionActive = true;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'setAppTheme()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyApp::stepThemeTransition()
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (!this->isThemeTransitionActive)
+        {
+            are_all_operation_success = true;
+            break;
+        }
+
+        LARGE_INTEGER frequency, frame_start, frame_end;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&frame_start);
+        DOUBLE elapsed_time = static_cast<DOUBLE>(frame_start.QuadPart - this->themeTransitionStartTime.QuadPart) * 1000.0 / static_cast<DOUBLE>(frequency.QuadPart);
+
+        // Apply the theme on the final frame.
+        if (elapsed_time >= static_cast<DOUBLE>(MyApp::themeTransitionDuration))
+        {
+            KillTimer(this->hWnd, MyApp::IDT_THEME_TRANSITION);
+            this->isThemeTransitionActive = false;
+            if (!this->applyAppTheme(this->windowTheme))
+            {
+                error_message = "Failed to apply the application theme.";
                 break;
             }
-            current_app_debug_level_string += optionValue;
+
+            if (this->themeTransitionFrameCount)
+            {
+                DOUBLE average_frame_time = this->themeTransitionTotalFrameTime / static_cast<DOUBLE>(this->themeTransitionFrameCount);
+                if (average_frame_time > MyApp::themeTransitionFrameBudget)
+                    MY_LOG(this->logger, MyLogType::Warn, "Theme transition completed:", "'{} frame(s), average frame time: {} ms, longest frame time: {} ms'",
+                           this->themeTransitionFrameCount, average_frame_time, this->themeTransitionMaxFrameTime);
+                else
+                    MY_LOG(this->logger, MyLogType::Debug, "Theme transition completed:", "'{} frame(s), average frame time: {} ms, longest frame time: {} ms'",
+                           this->themeTransitionFrameCount, average_frame_time, this->themeTransitionMaxFrameTime);
+            }
+
+            are_all_operation_success = true;
+            break;
         }
-        else if (MyUtility::ContainsWord(optionName, "theme"))
+
+        // Blend every UI color in one pass (smoothstep eased) and recolor only the dependents of the changed colors,
+        // their device resources are kept until the final frame applies the theme.
+        UINT weight = MYTHEMETABLE::getTransitionWeight(elapsed_time / static_cast<DOUBLE>(MyApp::themeTransitionDuration));
+        std::bitset<UI_THEME_COLOR_COUNT> changed_colors;
+        if (!this->pUIManager->stepThemeTransition(weight, &changed_colors))
         {
-            current_app_theme_string += optionValue;
-            current_app_debug_level_string += std::to_string(this->logger.getLogLevel());
+            error_message = "Failed to update the UI colors.";
+            break;
         }
-        else
+        if (changed_colors.none())
         {
-            error_message = "Invalid option name.";
+            are_all_operation_success = true;
             break;
         }
+        UINT total_refreshed_windows = 0;
+        if (!this->refreshColorDependents(changed_colors, total_refreshed_windows, true))
+        {
+            error_message = "Failed to refresh the color dependents.";
+            break;
+        }
+
+        // Repaint all the invalidated windows at once.
+        RedrawWindow(this->hWnd, NULL, NULL, RDW_UPDATENOW | RDW_ALLCHILDREN);
 
-        final_string += "# Available themes: Light, Dark, Monokai.\n# Available settings: Debug\n\nTheme = ";
-        final_string += current_app_theme_string;
-        final_string += "\nDebug = ";
-        final_string += current_app_debug_level_string;
-        config_file << final_string;
-        config_file.close();
+        QueryPerformanceCounter(&frame_end);
+        DOUBLE frame_time = static_cast<DOUBLE>(frame_end.QuadPart - frame_start.QuadPart) * 1000.0 / static_cast<DOUBLE>(frequency.QuadPart);
+        this->themeTransitionFrameCount++;
+        this->themeTransitionTotalFrameTime += frame_time;
+        if (frame_time > this->themeTransitionMaxFrameTime)
+            this->themeTransitionMaxFrameTime = frame_time;
 
         are_all_operation_success = true;
     }
 
     if (!are_all_operation_success)
-        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'updateConfigurationFile()']", MyLogType::Error);
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'stepThemeTransition()']", MyLogType::Error);
 
     return are_all_operation_success;
 }
-bool MyApp::setAppTheme(MyTheme theme)
+bool MyApp::applyAppTheme(MyTheme theme)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -512,7 +866,7 @@ bool MyApp::setAppTheme(MyTheme theme)
     }
 
     if (!are_all_operation_success)
-        this->logger.writeLog(error_message, "[NAMESPACE: 'nApp::Theme' | FUNC: 'SetAppTheme()']", MyLogType::Error);
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'applyAppTheme()']", MyLogType::Error);
 
     return are_all_operation_success;
 }
@@ -570,6 +924,187 @@ bool MyApp::updateContainers(MyTheme theme)
 
     return are_all_operation_success;
 }
+bool MyApp::reloadThemeFile()
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (!this->isWindowReady)
+        {
+            error_message = "The application window isn't ready yet.";
+            break;
+        }
+
+        LARGE_INTEGER frequency, reload_start, reload_end;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&reload_start);
+
+        // Reload the theme overrides and diff the UI colors.
+        if (!this->pUIManager->loadThemeOverrides(this->themeFilePath))
+        {
+            error_message = "Failed to load the theme file.";
+            break;
+        }
+
+        // Retarget the in-progress theme transition instead of jumping to the new colors.
+        if (this->isThemeTransitionActive)
+        {
+            if (!this->setAppTheme(this->windowTheme))
+            {
+                error_message = "Failed to restart the theme transition.";
+                break;
+            }
+
+            are_all_operation_success = true;
+            break;
+        }
+
+        std::bitset<UI_THEME_COLOR_COUNT> changed_colors;
+        if (!this->pUIManager->updateUITheme(this->windowTheme, &changed_colors))
+        {
+            error_message = "Failed to update the UI resources.";
+            break;
+        }
+        if (changed_colors.none())
+        {
+            MY_LOG(this->logger, MyLogType::Debug, "Theme file reloaded, no color changes.", "");
+            are_all_operation_success = true;
+            break;
+        }
+
+        // Refresh the dependents of the changed colors and repaint them.
+        UINT total_refreshed_windows = 0;
+        if (!this->refreshColorDependents(changed_colors, total_refreshed_windows))
+        {
+            error_message = "Failed to refresh the color dependents.";
+            break;
+        }
+        RedrawWindow(this->hWnd, NULL, NULL, RDW_UPDATENOW | RDW_ALLCHILDREN);
+
+        QueryPerformanceCounter(&reload_end);
+        DOUBLE latency = static_cast<DOUBLE>(reload_end.QuadPart - reload_start.QuadPart) * 1000.0 / static_cast<DOUBLE>(frequency.QuadPart);
+        if (latency > MyApp::themeReloadLatencyBudget)
+            MY_LOG(this->logger, MyLogType::Warn, "Theme file reloaded:", "'{} color(s) changed, {} window(s) refreshed, reload-to-repaint latency: {} ms'",
+                   changed_colors.count(), total_refreshed_windows, latency);
+        else
+            MY_LOG(this->logger, MyLogType::Info, "Theme file reloaded:", "'{} color(s) changed, {} window(s) refreshed, reload-to-repaint latency: {} ms'",
+                   changed_colors.count(), total_refreshed_windows, latency);
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'reloadThemeFile()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyApp::refreshColorDependents(const std::bitset<UI_THEME_COLOR_COUNT> &colors, UINT &totalRefreshedWindows, bool isColorOnly)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        totalRefreshedWindows = 0;
+
+        if (isColorOnly)
+        {
+            // Recolor the shared Direct2D resources of the affected subclass classes in place.
+            if ((UIColors::getDependentColors(MyWindowType::Editbox) & colors).any())
+                MyEditboxSubclass::recolorSharedDeviceResources(this->pUIManager->colors);
+        }
+        else
+        {
+            // Release the shared Direct2D resources of the affected subclass classes so they can be recreated on next refresh calls.
+            if ((UIColors::getDependentColors(MyWindowType::StandardButton) & colors).any())
+                MyStandardButtonSubclass::releaseSharedDeviceResources();
+            if ((UIColors::getDependentColors(MyWindowType::ImageButton) & colors).any())
+                MyImageButtonSubclass::releaseSharedDeviceResources();
+            if ((UIColors::getDependentColors(MyWindowType::RadioButton) & colors).any())
+                MyRadioButtonSubclass::releaseSharedDeviceResources();
+            if ((UIColors::getDependentColors(MyWindowType::Editbox) & colors).any())
+                MyEditboxSubclass::releaseSharedDeviceResources();
+            if ((UIColors::getDependentColors(MyWindowType::DDLCombobox) & colors).any())
+                MyDDLComboboxSubclass::releaseSharedDeviceResources();
+            if ((UIColors::getDependentColors(MyWindowType::VerticalScrollbar) & colors).any())
+                MyVerticalScrollbarSubclass::releaseSharedDeviceResources();
+        }
+
+        // Recreate (or recolor) the application window Direct2D resources and update its border.
+        if ((this->pUIManager->getDependentColors() & colors).any())
+        {
+            if (!(isColorOnly ? this->pUIManager->recolorDeviceResources() : this->pUIManager->createDeviceResources()))
+            {
+                error_message = "Failed to create application window device-dependent resources.";
+                break;
+            }
+
+            if (this->isWindows11BorderAttributeSupported)
+            {
+                COLORREF border_color = (this->isWindowActive ? this->pUIManager->colors.borderActive.getCOLORREF() : this->pUIManager->colors.borderInactive.getCOLORREF());
+                HRESULT hr = DwmSetWindowAttribute(this->hWnd, DWMWA_BORDER_COLOR, &border_color, sizeof(border_color));
+                if (FAILED(hr))
+                {
+                    error_message = "Failed to set the window border attribute.";
+                    break;
+                }
+            }
+
+            // The background is visible through every window, invalidate everything.
+            RedrawWindow(this->hWnd, NULL, NULL, RDW_INVALIDATE | RDW_ALLCHILDREN);
+        }
+
+        // Refresh the affected non-client windows.
+        {
+            bool is_for_loop_failed = false;
+            for (auto &p_window : this->vNonClientWindows)
+            {
+                if (!p_window->isColorDependent(colors))
+                    continue;
+
+                if (!p_window->refresh(isColorOnly))
+                {
+                    is_for_loop_failed = true;
+                    break;
+                }
+                InvalidateRect(p_window->hWnd(), NULL, FALSE);
+                totalRefreshedWindows++;
+            }
+            if (is_for_loop_failed)
+            {
+                error_message = "Failed to refresh the non-client windows.";
+                break;
+            }
+        }
+
+        // Refresh the affected container windows.
+        {
+            bool is_for_loop_failed = false;
+            for (auto &[id, p_container] : this->mContainers)
+            {
+                UINT total_container_refreshed_windows = 0;
+                if (!p_container->refreshColorDependents(colors, total_container_refreshed_windows, isColorOnly))
+                {
+                    is_for_loop_failed = true;
+                    break;
+                }
+                totalRefreshedWindows += total_container_refreshed_windows;
+            }
+            if (is_for_loop_failed)
+            {
+                error_message = "Failed to refresh the container windows.";
+                break;
+            }
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        this->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'refreshColorDependents()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
 bool MyApp::addContainer(std::shared_ptr<MyContainer> pContainerWindow)
 {
     bool are_all_operation_success = false;
@@ -630,8 +1165,211 @@ std::shared_ptr<MyContainer> MyApp::findContainer(INT containerWindowID)
 
     return nullptr;
 }
+bool MyApp::showPerformanceHud(bool isShown)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (isShown == (this->hPerformanceHudWindow != nullptr))
+        {
+            are_all_operation_success = true;
+            break;
+        }
+
+        if (!isShown)
+        {
+            KillTimer(this->hWnd, MyApp::IDT_PERFORMANCE_HUD);
+            DestroyWindow(this->hPerformanceHudWindow);
+            this->hPerformanceHudWindow = nullptr;
+            this->pUIManager->performanceHud.setEnabled(false);
+            are_all_operation_success = true;
+            break;
+        }
+
+        // The HUD window doesn't have the SS_NOTIFY style, the mouse input passes through to the windows below.
+        this->pUIManager->performanceHud.setEnabled(true);
+        HWND window = CreateWindowExW(0, WC_STATIC, L"", WS_CHILD | WS_VISIBLE | WS_CLIPSIBLINGS,
+                                      0, 0, MyPerformanceHud::hudWidth, MyPerformanceHud::hudHeight, this->hWnd, NULL, this->hInstance, NULL);
+        if (!window)
+        {
+            this->pUIManager->performanceHud.setEnabled(false);
+            error_message = "Failed to create the performance HUD window.";
+            break;
+        }
+        if (!SetWindowSubclass(window, &PerformanceHudProcedure, 0, 0))
+        {
+            DestroyWindow(window);
+            this->pUIManager->performanceHud.setEnabled(false);
+            error_message = "Failed to install the performance HUD window subclass callback.";
+            break;
+        }
+        this->hPerformanceHudWindow = window;
+        this->updatePerformanceHudPosition();
+
+        // Start sampling the statistics.
+        if (!SetTimer(this->hWnd, MyApp::IDT_PERFORMANCE_HUD, MyApp::performanceHudInterval, NULL))
+        {
+            error_message = "Failed to start the performance HUD timer.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'showPerformanceHud()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyApp::updateInputRecording()
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        // Stop the recording or the replay in progress.
+        if (this->inputRecorder.isRecording())
+        {
+            if (!this->inputRecorder.stopRecording(this->inputRecordingFilePath))
+            {
+                error_message = "Failed to write the input recording file.";
+                break;
+            }
+            MY_LOG(this->logger, MyLogType::Info, "Input recording written:", "'{}'", MyUtility::ConvertWideStringToString(this->inputRecordingFileName));
+        }
+        KillTimer(this->hWnd, MyApp::IDT_INPUT_REPLAY);
+        this->inputRecorder.stopReplay();
+
+        // Start the recording. (Record)
+        INT mode = this->config.getValue(MyConfigKey::InputRecording);
+        if (mode == 1)
+        {
+            RECT rect_window;
+            if (!GetWindowRect(this->hWnd, &rect_window))
+            {
+                error_message = "Failed to retrieve the window rect.";
+                break;
+            }
+            if (!this->inputRecorder.startRecording(rect_window))
+            {
+                error_message = "Failed to start the input recording.";
+                break;
+            }
+        }
+
+        // Start the replay. (Replay, ReplayAndExit)
+        else if (mode >= 2)
+        {
+            if (!this->inputRecorder.startReplay(this->inputRecordingFilePath))
+            {
+                error_message = "Failed to load the input recording file.";
+                break;
+            }
+
+            const MYINPUTRECORDINGHEADER &header = this->inputRecorder.getReplayHeader();
+            if (IsIconic(this->hWnd) || IsZoomed(this->hWnd))
+                ShowWindow(this->hWnd, SW_RESTORE);
+            if (!SetWindowPos(this->hWnd, NULL, header.windowX, header.windowY, static_cast<INT>(header.windowWidth), static_cast<INT>(header.windowHeight), SWP_NOZORDER | SWP_NOACTIVATE))
+            {
+                this->inputRecorder.stopReplay();
+                error_message = "Failed to restore the recorded window placement.";
+                break;
+            }
+            if (!SetTimer(this->hWnd, MyApp::IDT_INPUT_REPLAY, MyApp::inputReplayInterval, NULL))
+            {
+                this->inputRecorder.stopReplay();
+                error_message = "Failed to start the input replay timer.";
+                break;
+            }
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyApp' | FUNC: 'updateInputRecording()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyApp::dispatchInputRecord(const MYINPUTRECORD &record)
+{
+    // The target window is identified by the control IDs.
+    HWND target = this->hWnd;
+    if (!(record.flags & INPUT_RECORD_APPLICATION_WINDOW))
+    {
+        HWND parent = (record.parentControlId ? GetDlgItem(this->hWnd, static_cast<INT>(record.parentControlId)) : this->hWnd);
+        target = (parent ? GetDlgItem(parent, static_cast<INT>(record.controlId)) : nullptr);
+        if (!target)
+            return false;
+    }
+
+    // The application window is resized instead, the resize sends the message.
+    if (target == this->hWnd && record.message == WM_SIZE)
+    {
+        if (record.wParam == SIZE_MINIMIZED || record.wParam == SIZE_MAXIMIZED)
+            ShowWindow(this->hWnd, (record.wParam == SIZE_MINIMIZED ? SW_MINIMIZE : SW_MAXIMIZE));
+        else
+        {
+            if (IsIconic(this->hWnd) || IsZoomed(this->hWnd))
+                ShowWindow(this->hWnd, SW_RESTORE);
+            SetWindowPos(this->hWnd, NULL, 0, 0, LOWORD(record.lParam), HIWORD(record.lParam), SWP_NOMOVE | SWP_NOZORDER | SWP_NOACTIVATE);
+        }
+        return true;
+    }
+
+    SendMessageW(target, record.message, static_cast<WPARAM>(record.wParam), static_cast<LPARAM>(record.lParam));
+    return true;
+}
+bool MyApp::finishStartupTrace()
+{
+    DOUBLE startup_time = this->startupTracer.finish();
+    std::string summary = this->startupTracer.formatSummary();
+    if (startup_time > MyApp::startupTimeBudget)
+        MY_LOG(this->logger, MyLogType::Warn, "Startup timeline (over budget):", "'{}, total {} ms'", summary, startup_time);
+    else
+        MY_LOG(this->logger, MyLogType::Info, "Startup timeline:", "'{}, total {} ms'", summary, startup_time);
+
+    if (this->config.getValue(MyConfigKey::StartupTrace) == 1)
+    {
+        if (!this->startupTracer.exportChromeTrace(this->startupTraceFilePath))
+        {
+            this->logger.writeLog("Failed to write the startup trace file.", "[CLASS: 'MyApp' | FUNC: 'finishStartupTrace()']", MyLogType::Error);
+            return false;
+        }
+        MY_LOG(this->logger, MyLogType::Debug, "Startup trace written:", "'{}'", MyUtility::ConvertWideStringToString(this->startupTraceFileName));
+    }
+
+    return true;
+}
+bool MyApp::stepInputReplay()
+{
+    bool is_replaying = this->inputRecorder.advanceReplay([this](const MYINPUTRECORD &record)
+                                                          { return this->dispatchInputRecord(record); });
+    if (is_replaying)
+        return true;
+
+    // The replay is finished, or was stopped by a replayed message.
+    KillTimer(this->hWnd, MyApp::IDT_INPUT_REPLAY);
+    size_t total_records = 0, total_skipped_records = 0;
+    UINT64 total_frames = 0;
+    this->inputRecorder.getReplayStatistics(total_records, total_skipped_records, total_frames);
+    this->inputRecorder.stopReplay();
+    MY_LOG(this->logger, MyLogType::Info, "Input replay finished:", "'{} record(s) in {} frame(s), {} skipped'", total_records, total_frames, total_skipped_records);
+
+    // The application window may already be destroyed by a replayed message.
+    if (this->config.getValue(MyConfigKey::InputRecording) == 3 && IsWindow(this->hWnd) && !PostMessageW(this->hWnd, WM_CLOSE, 0, 0))
+    {
+        this->logger.writeLog("Failed to close the application after the input replay.", "[CLASS: 'MyApp' | FUNC: 'stepInputReplay()']", MyLogType::Error);
+        return false;
+    }
+
+    return true;
+}
 bool MyApp::onCreate(HWND hWnd)
 {
+    MY_STARTUP_PHASE(this->startupTracer, "Window creation");
+
     bool are_all_operation_success = false;
     std::string error_message = "";
     while (!are_all_operation_success)
@@ -648,6 +1386,7 @@ bool MyApp::onCreate(HWND hWnd)
         // By default, all the UI resources are null.
         // Update the application parameters and create UI resources for the first time.
         {
+            MY_STARTUP_PHASE(this->startupTracer, "UI resources");
             if (!this->pUIManager->updateUITheme(this->windowTheme))
             {
                 error_message = "Failed to update the UI resources.";
@@ -687,6 +1426,8 @@ bool MyApp::onCreate(HWND hWnd)
 
         // Create non-client window controls.
         {
+            MY_STARTUP_PHASE(this->startupTracer, "Non-client windows");
+
             // Window title.
             std::wstring text_title = MyUtility::GetWindowTextWideString(hWnd);
             MyStandardTextSubclassConfig subclass_config;
@@ -769,6 +1510,9 @@ bool MyApp::onCreate(HWND hWnd)
         }
 
         // Create client window controls.
+        // The phase covers the rest of the window creation.
+        MY_STARTUP_PHASE(this->startupTracer, "Client windows");
+
         // Container window.
         error_message = "Failed to create and add the container window to application window.";
         MyContainerWindowConfig container_config(hWnd,
@@ -1305,6 +2049,8 @@ bool MyApp::onCreate(HWND hWnd)
 }
 bool MyApp::onReady()
 {
+    MY_STARTUP_PHASE(this->startupTracer, "Ready");
+
     bool are_all_operation_success = false;
     std::string error_message = "";
     while (!are_all_operation_success)
@@ -1332,10 +2078,64 @@ bool MyApp::onReady()
         // Show the client windows.
         ShowWindow(g_pApp->findContainer(IDC_DC_CONTAINER)->container()->hWnd(), SW_SHOW);
 
+        // Start polling the theme file for changes.
+        if (!SetTimer(this->hWnd, MyApp::IDT_THEME_FILE_WATCHER, MyApp::themeFileWatcherInterval, NULL))
+        {
+            error_message = "Failed to start the theme file watcher timer.";
+            break;
+        }
+
+        // Start polling the configuration file for changes.
+        if (!SetTimer(this->hWnd, MyApp::IDT_CONFIGURATION_FILE_WATCHER, MyApp::configurationFileWatcherInterval, NULL))
+        {
+            error_message = "Failed to start the configuration file watcher timer.";
+            break;
+        }
+
+        // Start reporting the allocation rates.
+        if (MyAllocationTracker::isEnabled() && !SetTimer(this->hWnd, MyApp::IDT_ALLOCATION_REPORT, MyAllocationTracker::reportInterval, NULL))
+        {
+            error_message = "Failed to start the allocation report timer.";
+            break;
+        }
+
+        // Show the performance HUD.
+        if (this->config.getValue(MyConfigKey::PerformanceHud) != 0 && !this->showPerformanceHud(true))
+        {
+            error_message = "Failed to show the performance HUD.";
+            break;
+        }
+
+        // Start the input recording or replay.
+        if (this->config.getValue(MyConfigKey::InputRecording) != 0 && !this->updateInputRecording())
+        {
+            error_message = "Failed to start the input recording or replay.";
+            break;
+        }
+
         // Indicate that the application is ready.
         this->isWindowReady = true;
         this->logger.writeLog("Application is ready.", "", MyLogType::Info);
 
+        // Draw the first frame now and log the time since the process creation.
+        {
+            MY_STARTUP_PHASE(this->startupTracer, "First frame");
+            RedrawWindow(this->hWnd, NULL, NULL, RDW_UPDATENOW | RDW_ALLCHILDREN);
+
+            FILETIME creation_time, exit_time, kernel_time, user_time, current_time;
+            if (GetProcessTimes(GetCurrentProcess(), &creation_time, &exit_time, &kernel_time, &user_time))
+            {
+                GetSystemTimePreciseAsFileTime(&current_time);
+                ULARGE_INTEGER creation, current;
+                creation.LowPart = creation_time.dwLowDateTime;
+                creation.HighPart = creation_time.dwHighDateTime;
+                current.LowPart = current_time.dwLowDateTime;
+                current.HighPart = current_time.dwHighDateTime;
+                DOUBLE time_to_first_frame = static_cast<DOUBLE>(current.QuadPart - creation.QuadPart) / 10000.0;
+                MY_LOG(this->logger, MyLogType::Info, "Time to first frame:", "'{} ms, {} image(s) restored from the startup snapshot'", time_to_first_frame, this->startupSnapshot.getTotalHits());
+            }
+        }
+
         are_all_operation_success = true;
     }
 
@@ -1346,7 +2146,7 @@ bool MyApp::onReady()
 }
 bool MyApp::onExit()
 {
-    this->logger.writeLog("Exiting the application ...", "", MyLogType::Debug);
+    MY_LOG(this->logger, MyLogType::Debug, "Exiting the application ...", "");
 
     // Reverse the extended window frames. (Disabling the window drop-shadow effect)
     MARGINS borders = {0, 0, 0, 0};
@@ -1357,6 +2157,41 @@ bool MyApp::onExit()
         return false;
     }
 
+    // Stop watching the theme file.
+    KillTimer(this->hWnd, MyApp::IDT_THEME_FILE_WATCHER);
+    this->themeFileWatcher.unwatch();
+
+    // Stop watching the configuration file.
+    KillTimer(this->hWnd, MyApp::IDT_CONFIGURATION_FILE_WATCHER);
+    this->configurationFileWatcher.unwatch();
+
+    // Stop reporting the allocation rates.
+    KillTimer(this->hWnd, MyApp::IDT_ALLOCATION_REPORT);
+
+    // Hide the performance HUD.
+    this->showPerformanceHud(false);
+
+    // Write the input recording and stop the replay.
+    KillTimer(this->hWnd, MyApp::IDT_INPUT_REPLAY);
+    if (this->inputRecorder.isRecording() && this->inputRecorder.stopRecording(this->inputRecordingFilePath))
+        MY_LOG(this->logger, MyLogType::Info, "Input recording written:", "'{}'", MyUtility::ConvertWideStringToString(this->inputRecordingFileName));
+    this->inputRecorder.stopReplay();
+
+    // Stop the in-progress theme transition.
+    KillTimer(this->hWnd, MyApp::IDT_THEME_TRANSITION);
+    this->isThemeTransitionActive = false;
+
+    // Write the startup snapshot if an image was decoded rather than restored from the snapshot.
+    if (this->config.getValue(MyConfigKey::StartupSnapshot) != 0 && MyWICBitmap::getTotalDecodes() > this->startupSnapshot.getTotalHits())
+    {
+        // The entries this session didn't use are carried over from the mapped snapshot.
+        UINT total_images = this->pUIManager->images.addToSnapshot(this->startupSnapshot);
+        UINT total_kept_entries = this->startupSnapshot.addMappedEntries();
+        this->startupSnapshot.close();
+        if (this->startupSnapshot.write(this->snapshotFilePath, MyStartupSnapshot::getValidationStamp()))
+            MY_LOG(this->logger, MyLogType::Info, "Startup snapshot written:", "'{} image(s), {} entries kept from the previous snapshot'", total_images, total_kept_entries);
+    }
+
     // <Stop all the in-progress application activities here if needed.>
 
     return true;
@@ -1371,14 +2206,14 @@ bool MyApp::onDestroy()
         {
             if (!this->vNonClientWindows.empty())
                 this->vNonClientWindows.clear();
-            this->logger.writeLog("Non-client window(s) destroyed.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Non-client window(s) destroyed.", "");
         }
 
         // Destroy client windows.
         {
             if (!this->mContainers.empty())
                 this->mContainers.clear();
-            this->logger.writeLog("Client window(s) destroyed.", "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "Client window(s) destroyed.", "");
         }
 
         if (MyContainer::totalInstances || MyWindow::totalInstances || MySubclass::totalInstances)
@@ -1392,9 +2227,9 @@ bool MyApp::onDestroy()
         }
         if (this->logger.getLogLevel() > 1)
         {
-            this->logger.writeLog("'MyContainer' instances: " + std::to_string(MyContainer::totalInstances), "", MyLogType::Debug);
-            this->logger.writeLog("'MyWindow' instances: " + std::to_string(MyWindow::totalInstances), "", MyLogType::Debug);
-            this->logger.writeLog("'MySubclass' instances: " + std::to_string(MySubclass::totalInstances), "", MyLogType::Debug);
+            MY_LOG(this->logger, MyLogType::Debug, "'MyContainer' instances: {}", "", MyContainer::totalInstances);
+            MY_LOG(this->logger, MyLogType::Debug, "'MyWindow' instances: {}", "", MyWindow::totalInstances);
+            MY_LOG(this->logger, MyLogType::Debug, "'MySubclass' instances: {}", "", MySubclass::totalInstances);
         }
 
         are_all_operation_success = true;
@@ -1439,4 +2274,13 @@ void MyApp::adjustMaximizedClientRect(HWND window, RECT &rect)
     }
 
     rect = monitor_info.rcWork;
+}
+void MyApp::updatePerformanceHudPosition()
+{
+    if (!this->hPerformanceHudWindow)
+        return;
+
+    INT x = this->windowWidth - WINDOW_BORDER_DEFAULTWIDTH - MyPerformanceHud::hudWidth - 8;
+    INT y = this->pUIManager->miscs.rectCaption.bottom + 8;
+    SetWindowPos(this->hPerformanceHudWindow, HWND_TOP, std::max(x, 0), y, 0, 0, SWP_NOSIZE | SWP_NOACTIVATE);
 }
\ No newline at end of file
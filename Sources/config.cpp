@@ -0,0 +1,335 @@
+/**
+ * @file config.cpp
+ * @brief Implementation of the portable configuration store defined in config.h.
+ * @note Windows-free, only includes the portable headers. Built into the application and the headless tools.
+ *       `MyConfigStore::load()` maps the configuration file with the Windows API, it is implemented in config_file.cpp.
+ */
+
+#include "../Headers/portable_includes.h" // Include the portable types.
+#include "../Headers/text.h"              // Include the portable text helpers.
+#include "../Headers/config.h"            // Include the portable configuration types.
+
+/*************************
+ * Configuration helpers *
+ *************************/
+
+/**
+ * @brief Compare two ASCII spans case-insensitively.
+ * @note Folds the ASCII letters, like `_strnicmp()` in the "C" locale.
+ */
+static bool IsEqualIgnoreCase(const char *pFirst, const char *pSecond, size_t size)
+{
+    for (size_t i = 0; i < size; i++)
+    {
+        char first = (MyCharClass::IsUpper(pFirst[i]) ? static_cast<char>(pFirst[i] + ('a' - 'A')) : pFirst[i]);
+        char second = (MyCharClass::IsUpper(pSecond[i]) ? static_cast<char>(pSecond[i] + ('a' - 'A')) : pSecond[i]);
+        if (first != second)
+            return false;
+    }
+
+    return true;
+}
+
+/*****************************************
+ * Configuration classes implementations *
+ *****************************************/
+
+// [MyConfigStore] class implementations:
+
+MyConfigStore::MyConfigStore(const MYCONFIGOPTION *pSchema)
+    : pSchema(pSchema)
+{
+    for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+        this->values[i] = this->pSchema[i].defaultValue;
+}
+void MyConfigStore::reset()
+{
+    this->beginBatch();
+    for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+        this->values[i] = this->pSchema[i].defaultValue;
+    this->definedKeys.reset();
+    this->endBatch();
+}
+UINT MyConfigStore::parse(const char *pData, size_t size)
+{
+    UINT total_parsed_options = 0;
+    const char *p_cursor = pData;
+    const char *p_end = pData + size;
+
+    // Skip the UTF-8 byte order mark.
+    if (size >= 3 && static_cast<BYTE>(p_cursor[0]) == 0xEF && static_cast<BYTE>(p_cursor[1]) == 0xBB && static_cast<BYTE>(p_cursor[2]) == 0xBF)
+        p_cursor += 3;
+
+    this->beginBatch();
+    UINT line_number = 0;
+    while (p_cursor < p_end)
+    {
+        // Slice the next line.
+        const char *p_line_begin = p_cursor;
+        const char *p_line_end = static_cast<const char *>(std::memchr(p_cursor, '\n', static_cast<size_t>(p_end - p_cursor)));
+        if (!p_line_end)
+            p_line_end = p_end;
+        p_cursor = (p_line_end < p_end ? p_line_end + 1 : p_end);
+        line_number++;
+
+        while (p_line_begin < p_line_end && MyCharClass::IsBlank(*p_line_begin))
+            p_line_begin++;
+        while (p_line_end > p_line_begin && (MyCharClass::IsBlank(p_line_end[-1]) || p_line_end[-1] == '\r'))
+            p_line_end--;
+        if (p_line_begin == p_line_end || *p_line_begin == '#')
+            continue; // Ignore lines starting with '#' or empty lines.
+
+        // Split the line into the name and value spans.
+        const char *p_delimiter = static_cast<const char *>(std::memchr(p_line_begin, '=', static_cast<size_t>(p_line_end - p_line_begin)));
+        if (!p_delimiter)
+        {
+            if (this->warningCallback)
+                this->warningCallback("Invalid configuration line, expected '<Option name> = <Value>':", "'Line " + std::to_string(line_number) + "'");
+            continue;
+        }
+        const char *p_name_end = p_delimiter;
+        while (p_name_end > p_line_begin && MyCharClass::IsBlank(p_name_end[-1]))
+            p_name_end--;
+        const char *p_value_begin = p_delimiter + 1;
+        while (p_value_begin < p_line_end && MyCharClass::IsBlank(*p_value_begin))
+            p_value_begin++;
+
+        MyConfigKey key;
+        if (!this->findKey(p_line_begin, static_cast<size_t>(p_name_end - p_line_begin), key))
+        {
+            if (this->warningCallback)
+                this->warningCallback("Unknown configuration option:", "'" + std::string(p_line_begin, p_name_end) + "' (Line " + std::to_string(line_number) + ")");
+            continue;
+        }
+        INT value = 0;
+        if (!this->parseValue(key, p_value_begin, static_cast<size_t>(p_line_end - p_value_begin), value))
+        {
+            if (this->warningCallback)
+                this->warningCallback("Invalid configuration value:", "'" + std::string(p_line_begin, p_line_end) + "' (Line " + std::to_string(line_number) + ")");
+            continue;
+        }
+
+        size_t index = static_cast<size_t>(key);
+        this->values[index] = value;
+        this->definedKeys.set(index);
+        total_parsed_options++;
+    }
+    this->endBatch();
+
+    return total_parsed_options;
+}
+std::string MyConfigStore::serialize() const
+{
+    // Header: list the available options and their values.
+    std::string content = "# Available options:\n";
+    for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+    {
+        const MYCONFIGOPTION &option = this->pSchema[i];
+        content += "# - ";
+        content += option.name;
+        content += ": ";
+        if (option.type == MyConfigValueType::Choice)
+        {
+            for (INT j = 0; j <= option.maximumValue; j++)
+            {
+                if (j)
+                    content += ", ";
+                content += option.pChoices[j];
+            }
+        }
+        else
+            content += std::to_string(option.minimumValue) + " - " + std::to_string(option.maximumValue);
+        content += ".\n";
+    }
+    content += "\n";
+
+    for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+    {
+        const MYCONFIGOPTION &option = this->pSchema[i];
+        content += option.name;
+        content += " = ";
+        content += (option.type == MyConfigValueType::Choice ? std::string(option.pChoices[this->values[i]]) : std::to_string(this->values[i]));
+        content += "\n";
+    }
+
+    return content;
+}
+INT MyConfigStore::getValue(MyConfigKey key) const
+{
+    return this->values[static_cast<size_t>(key)];
+}
+bool MyConfigStore::setValue(MyConfigKey key, INT value)
+{
+    const MYCONFIGOPTION &option = this->pSchema[static_cast<size_t>(key)];
+    if (value < option.minimumValue || value > option.maximumValue)
+        return false;
+
+    this->beginBatch();
+    this->values[static_cast<size_t>(key)] = value;
+    this->endBatch();
+
+    return true;
+}
+bool MyConfigStore::setValue(MyConfigKey key, const std::string &value)
+{
+    INT parsed_value = 0;
+    if (!this->parseValue(key, value.c_str(), value.size(), parsed_value))
+        return false;
+
+    this->beginBatch();
+    this->values[static_cast<size_t>(key)] = parsed_value;
+    this->endBatch();
+
+    return true;
+}
+bool MyConfigStore::isDefined(MyConfigKey key) const
+{
+    return this->definedKeys.test(static_cast<size_t>(key));
+}
+bool MyConfigStore::findKey(const std::string &name, MyConfigKey &key) const
+{
+    return this->findKey(name.c_str(), name.size(), key);
+}
+void MyConfigStore::setWarningCallback(std::function<void(const std::string &, const std::string &)> callback)
+{
+    this->warningCallback = std::move(callback);
+}
+UINT MyConfigStore::subscribe(const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &keys, std::function<void(const std::bitset<static_cast<size_t>(MyConfigKey::Count)> &)> callback)
+{
+    MYCONFIGSUBSCRIPTION subscription = {};
+    subscription.id = this->nextSubscriptionID++;
+    subscription.keys = keys;
+    subscription.batchCallback = std::move(callback);
+    this->subscriptions.push_back(std::move(subscription));
+
+    return this->subscriptions.back().id;
+}
+UINT MyConfigStore::subscribe(MyConfigKey key, std::function<void(INT)> callback)
+{
+    MYCONFIGSUBSCRIPTION subscription = {};
+    subscription.id = this->nextSubscriptionID++;
+    subscription.keys.set(static_cast<size_t>(key));
+    subscription.valueCallback = std::move(callback);
+    this->subscriptions.push_back(std::move(subscription));
+
+    return this->subscriptions.back().id;
+}
+bool MyConfigStore::unsubscribe(UINT subscriptionID)
+{
+    for (auto it = this->subscriptions.begin(); it != this->subscriptions.end(); it++)
+    {
+        if (it->id == subscriptionID)
+        {
+            this->subscriptions.erase(it);
+            return true;
+        }
+    }
+
+    return false;
+}
+void MyConfigStore::beginBatch()
+{
+    if (!this->batchDepth++)
+    {
+        for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+            this->batchValues[i] = this->values[i];
+    }
+}
+void MyConfigStore::endBatch()
+{
+    if (!this->batchDepth || --this->batchDepth)
+        return;
+
+    std::bitset<static_cast<size_t>(MyConfigKey::Count)> changed_keys;
+    for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+    {
+        if (this->values[i] != this->batchValues[i])
+            changed_keys.set(i);
+    }
+    if (changed_keys.none())
+        return;
+
+    // Notify a copy of the subscriptions, the callbacks may subscribe, unsubscribe or start new batches.
+    std::vector<MYCONFIGSUBSCRIPTION> subscriptions = this->subscriptions;
+    for (const auto &subscription : subscriptions)
+    {
+        std::bitset<static_cast<size_t>(MyConfigKey::Count)> changed_watched_keys = changed_keys & subscription.keys;
+        if (changed_watched_keys.none())
+            continue;
+
+        if (subscription.batchCallback)
+            subscription.batchCallback(changed_watched_keys);
+        else if (subscription.valueCallback)
+        {
+            for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+            {
+                if (changed_watched_keys.test(i))
+                    subscription.valueCallback(this->values[i]);
+            }
+        }
+    }
+}
+bool MyConfigStore::findKey(const char *pName, size_t size, MyConfigKey &key) const
+{
+    for (size_t i = 0; i < static_cast<size_t>(MyConfigKey::Count); i++)
+    {
+        const char *option_name = this->pSchema[i].name;
+        if (std::strlen(option_name) == size && IsEqualIgnoreCase(option_name, pName, size))
+        {
+            key = static_cast<MyConfigKey>(i);
+            return true;
+        }
+    }
+
+    return false;
+}
+bool MyConfigStore::parseValue(MyConfigKey key, const char *pValue, size_t size, INT &value) const
+{
+    const MYCONFIGOPTION &option = this->pSchema[static_cast<size_t>(key)];
+    if (!size)
+        return false;
+
+    switch (option.type)
+    {
+    case MyConfigValueType::Integer:
+    {
+        // Parse a decimal number, the digit count limit avoids overflows.
+        size_t i = 0;
+        bool is_negative = (pValue[0] == '-');
+        if (pValue[0] == '-' || pValue[0] == '+')
+            i++;
+        if (i == size || size - i > 9)
+            return false;
+
+        INT parsed_value = 0;
+        for (; i < size; i++)
+        {
+            if (!MyCharClass::IsDigit(pValue[i]))
+                return false;
+            parsed_value = parsed_value * 10 + (pValue[i] - '0');
+        }
+        if (is_negative)
+            parsed_value = -parsed_value;
+        if (parsed_value < option.minimumValue || parsed_value > option.maximumValue)
+            return false;
+
+        value = parsed_value;
+        return true;
+    }
+    case MyConfigValueType::Choice:
+    {
+        for (INT i = 0; i <= option.maximumValue; i++)
+        {
+            if (std::strlen(option.pChoices[i]) == size && IsEqualIgnoreCase(option.pChoices[i], pValue, size))
+            {
+                value = i;
+                return true;
+            }
+        }
+
+        return false;
+    }
+    }
+
+    return false;
+}
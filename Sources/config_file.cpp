@@ -0,0 +1,279 @@
+/**
+ * @file config_file.cpp
+ * @brief Implementation of the user-defined types defined in config_file.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/**********************************************
+ * Configuration file classes implementations *
+ **********************************************/
+
+// [MyConfigStore] class implementations: (Configuration file mapping, see config.cpp for the portable store)
+
+bool MyConfigStore::load(const std::wstring &filePath, bool &isFileFound)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    HANDLE file = INVALID_HANDLE_VALUE;
+    HANDLE file_mapping = nullptr;
+    const char *p_view = nullptr;
+    this->beginBatch();
+    while (!are_all_operation_success)
+    {
+        isFileFound = false;
+        this->reset();
+
+        file = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            DWORD last_error = GetLastError();
+            if (last_error == ERROR_FILE_NOT_FOUND || last_error == ERROR_PATH_NOT_FOUND)
+            {
+                are_all_operation_success = true;
+                break;
+            }
+
+            error_message = "Failed to open the configuration file.";
+            break;
+        }
+        isFileFound = true;
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(file, &file_size))
+        {
+            error_message = "Failed to retrieve the configuration file size.";
+            break;
+        }
+        if (!file_size.QuadPart)
+        {
+            // Empty files can't be mapped, there is nothing to parse anyway.
+            are_all_operation_success = true;
+            break;
+        }
+
+        file_mapping = CreateFileMappingW(file, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!file_mapping)
+        {
+            error_message = "Failed to create the configuration file mapping object.";
+            break;
+        }
+
+        p_view = static_cast<const char *>(MapViewOfFile(file_mapping, FILE_MAP_READ, 0, 0, 0));
+        if (!p_view)
+        {
+            error_message = "Failed to map the configuration file.";
+            break;
+        }
+
+        this->parse(p_view, static_cast<size_t>(file_size.QuadPart));
+
+        are_all_operation_success = true;
+    }
+
+    if (p_view)
+        UnmapViewOfFile(p_view);
+    if (file_mapping)
+        CloseHandle(file_mapping);
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+    this->endBatch();
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyConfigStore' | FUNC: 'load()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+
+// [MyConfigWriter] class implementations:
+
+MyConfigWriter::MyConfigWriter()
+{
+    InitializeCriticalSection(&this->lock);
+    InitializeConditionVariable(&this->condition);
+}
+MyConfigWriter::~MyConfigWriter()
+{
+    this->stop();
+    DeleteCriticalSection(&this->lock);
+}
+bool MyConfigWriter::start(const std::wstring &filePath)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (this->hThread)
+        {
+            error_message = "The writer thread is already running.";
+            break;
+        }
+
+        this->filePath = filePath;
+        this->isStopping = false;
+        this->hThread = CreateThread(nullptr, 0, MyConfigWriter::writerThreadProcedure, this, 0, nullptr);
+        if (!this->hThread)
+        {
+            error_message = "Failed to create the writer thread.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyConfigWriter' | FUNC: 'start()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+void MyConfigWriter::stop()
+{
+    if (!this->hThread)
+        return;
+
+    EnterCriticalSection(&this->lock);
+    this->isStopping = true;
+    LeaveCriticalSection(&this->lock);
+    WakeConditionVariable(&this->condition);
+
+    WaitForSingleObject(this->hThread, INFINITE);
+    CloseHandle(this->hThread);
+    this->hThread = nullptr;
+}
+bool MyConfigWriter::submit(std::string content)
+{
+    if (!this->hThread)
+        return false;
+
+    EnterCriticalSection(&this->lock);
+    this->lastSubmittedContent = content;
+    this->pendingContent = std::move(content);
+    this->isPending = true;
+    this->totalSubmits++;
+    LeaveCriticalSection(&this->lock);
+    WakeConditionVariable(&this->condition);
+
+    return true;
+}
+UINT MyConfigWriter::getTotalSubmits()
+{
+    EnterCriticalSection(&this->lock);
+    UINT total_submits = this->totalSubmits;
+    LeaveCriticalSection(&this->lock);
+
+    return total_submits;
+}
+UINT MyConfigWriter::getTotalWrites()
+{
+    EnterCriticalSection(&this->lock);
+    UINT total_writes = this->totalWrites;
+    LeaveCriticalSection(&this->lock);
+
+    return total_writes;
+}
+bool MyConfigWriter::isOwnContent(const std::string &content)
+{
+    EnterCriticalSection(&this->lock);
+    bool is_own_content = (this->totalSubmits && (content == this->lastSubmittedContent || content == this->lastWrittenContent));
+    LeaveCriticalSection(&this->lock);
+
+    return is_own_content;
+}
+DWORD WINAPI MyConfigWriter::writerThreadProcedure(LPVOID pParameter)
+{
+    MyConfigWriter *p_this = static_cast<MyConfigWriter *>(pParameter);
+
+    EnterCriticalSection(&p_this->lock);
+    while (true)
+    {
+        while (!p_this->isPending && !p_this->isStopping)
+            SleepConditionVariableCS(&p_this->condition, &p_this->lock, INFINITE);
+        if (!p_this->isPending)
+            break; // Stopping with nothing left to write.
+
+        // Coalesce the burst: wait until no new content is submitted for the quiet period.
+        ULONGLONG first_pending_time = GetTickCount64();
+        while (!p_this->isStopping)
+        {
+            UINT total_submits = p_this->totalSubmits;
+            ULONGLONG elapsed_time = GetTickCount64() - first_pending_time;
+            if (elapsed_time >= MyConfigWriter::maximumWriteDelay)
+                break;
+
+            DWORD wait_time = MyConfigWriter::coalesceDelay;
+            if (elapsed_time + wait_time > MyConfigWriter::maximumWriteDelay)
+                wait_time = static_cast<DWORD>(MyConfigWriter::maximumWriteDelay - elapsed_time);
+            if (!SleepConditionVariableCS(&p_this->condition, &p_this->lock, wait_time) && p_this->totalSubmits == total_submits)
+                break; // Quiet period elapsed.
+        }
+
+        std::string content = std::move(p_this->pendingContent);
+        p_this->pendingContent.clear();
+        p_this->isPending = false;
+        LeaveCriticalSection(&p_this->lock);
+
+        bool is_write_success = p_this->writeFile(content);
+
+        EnterCriticalSection(&p_this->lock);
+        if (is_write_success)
+        {
+            p_this->totalWrites++;
+            p_this->lastWrittenContent = std::move(content);
+        }
+    }
+    LeaveCriticalSection(&p_this->lock);
+
+    return 0;
+}
+bool MyConfigWriter::writeFile(const std::string &content)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    std::wstring temporary_file_path = this->filePath + L".tmp";
+    HANDLE file = INVALID_HANDLE_VALUE;
+    while (!are_all_operation_success)
+    {
+        file = CreateFileW(temporary_file_path.c_str(), GENERIC_WRITE, 0, nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            error_message = "Failed to create the temporary configuration file.";
+            break;
+        }
+
+        DWORD total_written_bytes = 0;
+        if (!WriteFile(file, content.data(), static_cast<DWORD>(content.size()), &total_written_bytes, nullptr) || total_written_bytes != content.size())
+        {
+            error_message = "Failed to write the temporary configuration file.";
+            break;
+        }
+
+        // Make sure the content reached the disk before it replaces the configuration file.
+        if (!FlushFileBuffers(file))
+        {
+            error_message = "Failed to flush the temporary configuration file.";
+            break;
+        }
+        CloseHandle(file);
+        file = INVALID_HANDLE_VALUE;
+
+        if (!MoveFileExW(temporary_file_path.c_str(), this->filePath.c_str(), MOVEFILE_REPLACE_EXISTING | MOVEFILE_WRITE_THROUGH))
+        {
+            error_message = "Failed to replace the configuration file.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (file != INVALID_HANDLE_VALUE)
+        CloseHandle(file);
+
+    if (!are_all_operation_success)
+    {
+        DeleteFileW(temporary_file_path.c_str());
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyConfigWriter' | FUNC: 'writeFile()']", MyLogType::Error);
+    }
+
+    return are_all_operation_success;
+}
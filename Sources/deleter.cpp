@@ -0,0 +1,376 @@
+/**
+ * @file deleter.cpp
+ * @brief Implementation of the user-defined types defined in deleter.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/***********************************
+ * Deleter structs implementations *
+ ***********************************/
+
+// Deleter base struct:
+
+void Deleter::setLogger(MyLogger *pLogger)
+{
+    Deleter::pLogger.store(pLogger, std::memory_order_release);
+}
+void Deleter::detachLogger(MyLogger *pLogger)
+{
+    Deleter::pLogger.compare_exchange_strong(pLogger, nullptr, std::memory_order_acq_rel);
+}
+void Deleter::writeLog(std::string description, std::string extraDescription, MyLogType logType)
+{
+    MyLogger *p_logger = Deleter::pLogger.load(std::memory_order_acquire);
+    if (p_logger)
+        p_logger->writeLog(std::move(description), std::move(extraDescription), logType);
+}
+void Deleter::onResourceCreated(MyResourceType resourceType)
+{
+    size_t index = static_cast<size_t>(resourceType);
+    Deleter::createdResources[index].fetch_add(1, std::memory_order_relaxed);
+    UINT64 live_resources = Deleter::liveResources[index].fetch_add(1, std::memory_order_relaxed) + 1;
+    UINT64 peak_resources = Deleter::peakResources[index].load(std::memory_order_relaxed);
+    while (live_resources > peak_resources && !Deleter::peakResources[index].compare_exchange_weak(peak_resources, live_resources, std::memory_order_relaxed))
+        ;
+}
+void Deleter::onResourceReleased(MyResourceType resourceType)
+{
+    size_t index = static_cast<size_t>(resourceType);
+    Deleter::releasedResources[index].fetch_add(1, std::memory_order_relaxed);
+    UINT64 live_resources = Deleter::liveResources[index].load(std::memory_order_relaxed);
+    while (true)
+    {
+        // No live resource to release, the resource was created by an uncounted creation site.
+        if (!live_resources)
+        {
+            Deleter::untrackedReleases[index].fetch_add(1, std::memory_order_relaxed);
+            break;
+        }
+        if (Deleter::liveResources[index].compare_exchange_weak(live_resources, live_resources - 1, std::memory_order_relaxed))
+            break;
+    }
+}
+MYRESOURCECOUNTER Deleter::getResourceCounter(MyResourceType resourceType)
+{
+    size_t index = static_cast<size_t>(resourceType);
+    return {Deleter::liveResources[index].load(std::memory_order_relaxed), Deleter::peakResources[index].load(std::memory_order_relaxed),
+            Deleter::createdResources[index].load(std::memory_order_relaxed), Deleter::releasedResources[index].load(std::memory_order_relaxed),
+            Deleter::untrackedReleases[index].load(std::memory_order_relaxed)};
+}
+UINT64 Deleter::writeResourceCounters(MyLogger &logger)
+{
+    static const char *resource_type_names[Deleter::totalResourceTypes] = {"HWND", "HBRUSH", "HFONT", "HRGN", "IUIAnimationStoryboard", "IUIAnimationVariable", "IUIAnimationTransition",
+                                                                           "IWICBitmapSource", "IDWriteTextFormat", "ID2D1DCRenderTarget", "ID2D1SolidColorBrush", "ID2D1Bitmap"};
+
+    // The first call reports the creation rates since the application start.
+    ULONGLONG current_time = GetTickCount64();
+    ULONGLONG elapsed_time = current_time - Deleter::lastReportTime;
+    Deleter::lastReportTime = current_time;
+    DOUBLE elapsed_seconds = (elapsed_time ? static_cast<DOUBLE>(elapsed_time) / 1000.0 : 0.001);
+
+    UINT64 total_live_resources = 0;
+    for (size_t i = 0; i < Deleter::totalResourceTypes; i++)
+    {
+        MYRESOURCECOUNTER counter = Deleter::getResourceCounter(static_cast<MyResourceType>(i));
+        UINT64 new_created_resources = counter.createdResources - Deleter::reportedCreatedResources[i];
+        Deleter::reportedCreatedResources[i] = counter.createdResources;
+        total_live_resources += counter.liveResources;
+        if (!counter.createdResources && !counter.releasedResources)
+            continue;
+
+        MY_LOG(logger, MyLogType::Info, "Resource counters:", "'{}: {} live, {} peak, {} created, {} released, {} created/s'",
+               resource_type_names[i], counter.liveResources, counter.peakResources, counter.createdResources, counter.releasedResources,
+               static_cast<DOUBLE>(new_created_resources) / elapsed_seconds);
+        if (counter.untrackedReleases)
+            MY_LOG(logger, MyLogType::Warn, "Untracked resource releases:", "'{}: {} release(s) without a counted creation'", resource_type_names[i], counter.untrackedReleases);
+    }
+
+    return total_live_resources;
+}
+
+// WinAPI deleters:
+
+void HWNDDeleter::operator()(HWND *variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            if (!DestroyWindow(*variable))
+            {
+                Deleter::writeLog("Deleter failed.", "[DELETER: 'HWNDDeleter']", MyLogType::Error);
+                throw std::runtime_error("'HWNDDeleter' deleter failed.");
+            }
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'HWNDDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'HWNDDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void HBRUSHDeleter::operator()(HBRUSH *variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            if (!DeleteObject(*variable))
+            {
+                Deleter::writeLog("Deleter failed.", "[DELETER: 'HBRUSHDeleter']", MyLogType::Error);
+                throw std::runtime_error("'HBRUSHDeleter' deleter failed.");
+            }
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'HBRUSHDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'HBRUSHDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void HFONTDeleter::operator()(HFONT *variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            if (!DeleteObject(*variable))
+            {
+                Deleter::writeLog("Deleter failed.", "[DELETER: 'HFONTDeleter']", MyLogType::Error);
+                throw std::runtime_error("'HFONTDeleter' deleter failed.");
+            }
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'HFONTDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'HFONTDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void HRGNDeleter::operator()(HRGN *variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            if (!DeleteObject(*variable))
+            {
+                Deleter::writeLog("Deleter failed.", "[DELETER: 'HRGNDeleter']", MyLogType::Error);
+                throw std::runtime_error("'HRGNDeleter' deleter failed.");
+            }
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'HRGNDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'HRGNDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+
+// WAM deleters:
+
+void IUIAnimationStoryboardDeleter::operator()(IUIAnimationStoryboard **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'IUIAnimationStoryboardDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'IUIAnimationStoryboardDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void IUIAnimationVariableDeleter::operator()(IUIAnimationVariable **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'IUIAnimationVariableDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'IUIAnimationVariableDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void IUIAnimationTransitionDeleter::operator()(IUIAnimationTransition **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'IUIAnimationTransitionDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'IUIAnimationTransitionDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+
+// Direct2D/DirectWrite deleters:
+
+void IWICBitmapSourceDeleter::operator()(IWICBitmapSource **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'IWICBitmapSourceDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'IWICBitmapSourceDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void IDWriteTextFormatDeleter::operator()(IDWriteTextFormat **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'IDWriteTextFormatDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'IDWriteTextFormatDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void ID2D1DCRenderTargetDeleter::operator()(ID2D1DCRenderTarget **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'ID2D1DCRenderTargetDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'ID2D1DCRenderTargetDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void ID2D1SolidColorBrushDeleter::operator()(ID2D1SolidColorBrush **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'ID2D1SolidColorBrushDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'ID2D1SolidColorBrushDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
+void ID2D1BitmapDeleter::operator()(ID2D1Bitmap **variable) const
+{
+    if (variable)
+    {
+        if (*variable)
+        {
+            (*variable)->Release();
+            *variable = nullptr;
+
+            Deleter::onResourceReleased(resourceType);
+            if (debugMode)
+                Deleter::writeLog("Object released.", "[DELETER: 'ID2D1BitmapDeleter']", MyLogType::Info);
+        }
+        else
+        {
+            if (debugMode)
+                Deleter::writeLog("Object empty.", "[DELETER: 'ID2D1BitmapDeleter']", MyLogType::Info);
+        }
+
+        delete variable;
+    }
+}
@@ -20,127 +20,103 @@ MYIMAGEINFO::MYIMAGEINFO(INT resourceID, std::wstring resourceType, UINT imageWi
  * Graphic-related classes implementations *
  *******************************************/
 
-// [MyColor] class implementations:
+// [MySolidBrushPool] class implementations:
 
-MyColor::MyColor(MYRGBA rgba)
-{
-    if (!this->update(rgba))
-    {
-        g_pApp->logger.writeLog("Failed to initialize the object.", "[CLASS: 'MyColor' | FUNC: 'Constructor 1']", MyLogType::Error);
-        throw std::runtime_error("Failed to initialize the object.");
-    }
-}
-MyColor::MyColor(BYTE red, BYTE green, BYTE blue, BYTE alpha)
+HBRUSH MySolidBrushPool::getBrush(COLORREF colorref)
 {
-    MYRGBA t_rgba(red, green, blue, alpha);
-    if (!this->update(t_rgba))
+    MySolidBrushPool::totalRequests++;
+    auto it = MySolidBrushPool::brushes.find(colorref);
+    if (it != MySolidBrushPool::brushes.end())
     {
-        g_pApp->logger.writeLog("Failed to initialize the object.", "[CLASS: 'MyColor' | FUNC: 'Constructor 2']", MyLogType::Error);
-        throw std::runtime_error("Failed to initialize the object.");
+        it->second.lastUse = MySolidBrushPool::totalRequests;
+        return *it->second.pBrush;
     }
-}
-MyColor::MyColor(const MyColor &other)
-{
-    if (!this->update(other.rgba))
+
+    // Evict the least recently used brush, the pool is only full on color changes.
+    if (MySolidBrushPool::brushes.size() >= MySolidBrushPool::maximumBrushes)
     {
-        g_pApp->logger.writeLog("Failed to initialize the object.", "[CLASS: 'MyColor' | FUNC: 'Copy Constructor']", MyLogType::Error);
-        throw std::runtime_error("Failed to initialize the object.");
+        auto lru_it = std::min_element(MySolidBrushPool::brushes.begin(), MySolidBrushPool::brushes.end(), [](const auto &a, const auto &b)
+                                       { return a.second.lastUse < b.second.lastUse; });
+        MySolidBrushPool::brushes.erase(lru_it);
     }
-}
-MyColor &MyColor::operator=(const MyColor &other)
-{
-    if (this == &other)
-        return *this;
 
-    if (!this->update(other.rgba))
+    HBRUSH brush = CreateSolidBrush(colorref);
+    if (!brush)
     {
-        g_pApp->logger.writeLog("Failed to initialize the object.", "[CLASS: 'MyColor' | FUNC: 'Assignment Operator']", MyLogType::Error);
-        throw std::runtime_error("Failed to initialize the object.");
+        g_pApp->logger.writeLog("Failed to create the solid brush object.", "[CLASS: 'MySolidBrushPool' | FUNC: 'getBrush()']", MyLogType::Error);
+        return nullptr;
     }
+    Deleter::onResourceCreated(MyResourceType::Brush);
+    MySolidBrushPool::brushes.emplace(colorref, MYPOOLEDBRUSH{std::unique_ptr<HBRUSH, HBRUSHDeleter>(new HBRUSH(brush)), MySolidBrushPool::totalRequests});
 
-    return *this;
+    return brush;
 }
-bool MyColor::update(const MYRGBA &rgba)
+size_t MySolidBrushPool::getBrushCount()
 {
-    bool are_all_operation_success = false;
-    std::string error_message = "";
-    while (!are_all_operation_success)
-    {
-        this->rgba = rgba;
-        this->colorref = RGB(rgba.red, rgba.green, rgba.blue);
-        this->pSolidBrush.reset(new HBRUSH(CreateSolidBrush(this->colorref)));
-        this->d2d1Color = D2D1::ColorF(rgba.red / 255.0f, rgba.green / 255.0f, rgba.blue / 255.0f, rgba.alpha / 255.0f);
-
-        if (!*this->pSolidBrush)
-        {
-            error_message = "Failed to create the solid brush object.";
-            break;
-        }
+    return MySolidBrushPool::brushes.size();
+}
+void MySolidBrushPool::release()
+{
+    MySolidBrushPool::brushes.clear();
+}
 
-        are_all_operation_success = true;
-    }
+// [MyColor] class implementations:
 
-    if (!are_all_operation_success)
-        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyColor' | FUNC: 'update()']", MyLogType::Error);
+MyColor::MyColor(MYRGBA rgba)
+    : packedRGBA(MyColor::pack(rgba)) {}
+MyColor::MyColor(BYTE red, BYTE green, BYTE blue, BYTE alpha)
+    : packedRGBA(MyColor::pack(MYRGBA(red, green, blue, alpha))) {}
+bool MyColor::update(const MYRGBA &rgba)
+{
+    this->packedRGBA = MyColor::pack(rgba);
 
-    return are_all_operation_success;
+    return true;
+}
+BYTE MyColor::getRed() const
+{
+    return static_cast<BYTE>(this->packedRGBA & 0xFF);
+}
+BYTE MyColor::getGreen() const
+{
+    return static_cast<BYTE>((this->packedRGBA >> 8) & 0xFF);
 }
-const BYTE &MyColor::getRed()
+BYTE MyColor::getBlue() const
 {
-    return this->rgba.red;
+    return static_cast<BYTE>((this->packedRGBA >> 16) & 0xFF);
 }
-const BYTE &MyColor::getGreen()
+BYTE MyColor::getAlpha() const
 {
-    return this->rgba.green;
+    return static_cast<BYTE>((this->packedRGBA >> 24) & 0xFF);
 }
-const BYTE &MyColor::getBlue()
+UINT32 MyColor::getPackedRGBA() const
 {
-    return this->rgba.blue;
+    return this->packedRGBA;
 }
-const BYTE &MyColor::getAlpha()
+COLORREF MyColor::getCOLORREF() const
 {
-    return this->rgba.alpha;
+    return static_cast<COLORREF>(this->packedRGBA & 0x00FFFFFF);
 }
-const COLORREF &MyColor::getCOLORREF()
+HBRUSH MyColor::getSolidBrush() const
 {
-    return this->colorref;
+    return MySolidBrushPool::getBrush(this->getCOLORREF());
 }
-const HBRUSH &MyColor::getSolidBrush()
+D2D1::ColorF MyColor::getD2D1Color() const
 {
-    return *this->pSolidBrush;
+    return D2D1::ColorF(this->getRed() / 255.0f, this->getGreen() / 255.0f, this->getBlue() / 255.0f, this->getAlpha() / 255.0f);
 }
-const D2D1::ColorF &MyColor::getD2D1Color()
+UINT32 MyColor::pack(const MYRGBA &rgba)
 {
-    return this->d2d1Color;
+    return static_cast<UINT32>(rgba.red) | (static_cast<UINT32>(rgba.green) << 8) | (static_cast<UINT32>(rgba.blue) << 16) | (static_cast<UINT32>(rgba.alpha) << 24);
 }
 
 // [MyWICBitmap] class implementations:
 
 MyWICBitmap::MyWICBitmap(MYIMAGEINFO imageInfo)
-{
-    if (!this->update(imageInfo))
-    {
-        g_pApp->logger.writeLog("Failed to initialize the object.", "[CLASS: 'MyWICBitmap' | FUNC: 'Constructor 1']", MyLogType::Error);
-        throw std::runtime_error("Failed to initialize the object.");
-    }
-}
+    : imageInfo(imageInfo) {}
 MyWICBitmap::MyWICBitmap(INT resourceID, std::wstring resourceType, UINT imageWidth, UINT imageHeight)
-{
-    MYIMAGEINFO t_imageInfo(resourceID, resourceType, imageWidth, imageHeight);
-    if (!this->update(t_imageInfo))
-    {
-        g_pApp->logger.writeLog("Failed to initialize the object.", "[CLASS: 'MyWICBitmap' | FUNC: 'Constructor 2']", MyLogType::Error);
-        throw std::runtime_error("Failed to initialize the object.");
-    }
-}
+    : imageInfo(resourceID, resourceType, imageWidth, imageHeight) {}
 MyWICBitmap::MyWICBitmap(const MyWICBitmap &other)
-{
-    if (!this->update(other.imageInfo))
-    {
-        g_pApp->logger.writeLog("Failed to initialize the object.", "[CLASS: 'MyWICBitmap' | FUNC: 'Copy Constructor']", MyLogType::Error);
-        throw std::runtime_error("Failed to initialize the object.");
-    }
-}
+    : imageInfo(other.imageInfo) {}
 MyWICBitmap &MyWICBitmap::operator=(const MyWICBitmap &other)
 {
     if (this == &other)
@@ -156,33 +132,115 @@ MyWICBitmap &MyWICBitmap::operator=(const MyWICBitmap &other)
 }
 bool MyWICBitmap::update(const MYIMAGEINFO &imageInfo)
 {
+    AcquireSRWLockExclusive(&this->decodeLock);
+    this->imageInfo = imageInfo;
+    this->pBitmap.reset();
+    ReleaseSRWLockExclusive(&this->decodeLock);
+
+    return true;
+}
+bool MyWICBitmap::decode()
+{
+    AcquireSRWLockExclusive(&this->decodeLock);
+
     bool are_all_operation_success = false;
     std::string error_message = "";
     while (!are_all_operation_success)
     {
-        this->imageInfo = imageInfo;
-        this->pBitmap.reset(new IWICBitmapSource *(nullptr));
-        if (!g_pApp->pGraphic->d2d1Engine().createWicBitmapSourceFromResource(*this->pBitmap, MAKEINTRESOURCEW(this->imageInfo.resourceID), this->imageInfo.resourceType.c_str(), this->imageInfo.imageWidth, this->imageInfo.imageHeight) ||
-            !*this->pBitmap)
+        if (this->pBitmap && *this->pBitmap)
         {
-            error_message = "Failed to create the wic bitmap object.";
+            are_all_operation_success = true;
             break;
         }
+        MY_STARTUP_PHASE(g_pApp->startupTracer, "Image decode");
+
+        // Restore the pixels from the startup snapshot.
+        IWICBitmap *p_wic_bitmap = nullptr;
+        UINT stride = this->imageInfo.imageWidth * 4;
+        const BYTE *p_pixels = nullptr;
+        size_t pixels_size = 0;
+        if (g_pApp->startupSnapshot.find(this->getSnapshotKey(), p_pixels, pixels_size) && pixels_size == static_cast<size_t>(stride) * this->imageInfo.imageHeight)
+        {
+            HRESULT hr = g_pApp->pGraphic->d2d1Engine().wicImageFactory()->CreateBitmapFromMemory(this->imageInfo.imageWidth, this->imageInfo.imageHeight, GUID_WICPixelFormat32bppPBGRA, stride,
+                                                                                                   static_cast<UINT>(pixels_size), const_cast<BYTE *>(p_pixels), &p_wic_bitmap);
+            if (FAILED(hr))
+                p_wic_bitmap = nullptr;
+        }
+
+        // The decoder pipeline only decodes the pixels when they are read,
+        // copy them to a memory bitmap so the whole decode happens here rather than on the first draw.
+        if (!p_wic_bitmap)
+        {
+            std::unique_ptr<IWICBitmapSource *, IWICBitmapSourceDeleter> p_bitmap_source(new IWICBitmapSource *(nullptr));
+            if (!g_pApp->pGraphic->d2d1Engine().createWicBitmapSourceFromResource(*p_bitmap_source, MAKEINTRESOURCEW(this->imageInfo.resourceID), this->imageInfo.resourceType.c_str(), this->imageInfo.imageWidth, this->imageInfo.imageHeight) ||
+                !*p_bitmap_source)
+            {
+                error_message = "Failed to create the wic bitmap object.";
+                break;
+            }
+
+            HRESULT hr = g_pApp->pGraphic->d2d1Engine().wicImageFactory()->CreateBitmapFromSource(*p_bitmap_source, WICBitmapCacheOnLoad, &p_wic_bitmap);
+            if (FAILED(hr) || !p_wic_bitmap)
+            {
+                error_message = "Failed to decode the wic bitmap object.";
+                break;
+            }
+        }
+        this->pBitmap.reset(new IWICBitmapSource *(p_wic_bitmap));
+        Deleter::onResourceCreated(MyResourceType::WicBitmapSource);
+        MyWICBitmap::totalDecodes.fetch_add(1, std::memory_order_relaxed);
 
         are_all_operation_success = true;
     }
 
+    ReleaseSRWLockExclusive(&this->decodeLock);
+
     if (!are_all_operation_success)
-        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyWICBitmap' | FUNC: 'update()']", MyLogType::Error);
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyWICBitmap' | FUNC: 'decode()']", MyLogType::Error);
 
     return are_all_operation_success;
 }
+bool MyWICBitmap::isDecoded()
+{
+    AcquireSRWLockShared(&this->decodeLock);
+    bool is_decoded = (this->pBitmap && *this->pBitmap);
+    ReleaseSRWLockShared(&this->decodeLock);
+
+    return is_decoded;
+}
+bool MyWICBitmap::copyPixels(std::string &pixels)
+{
+    AcquireSRWLockShared(&this->decodeLock);
+
+    bool is_copied = false;
+    if (this->pBitmap && *this->pBitmap)
+    {
+        UINT stride = this->imageInfo.imageWidth * 4;
+        pixels.resize(static_cast<size_t>(stride) * this->imageInfo.imageHeight);
+        is_copied = SUCCEEDED((*this->pBitmap)->CopyPixels(nullptr, stride, static_cast<UINT>(pixels.size()), reinterpret_cast<BYTE *>(pixels.data())));
+    }
+
+    ReleaseSRWLockShared(&this->decodeLock);
+
+    return is_copied;
+}
+UINT64 MyWICBitmap::getSnapshotKey() const
+{
+    return (static_cast<UINT64>(static_cast<UINT32>(this->imageInfo.resourceID)) << 32) | (static_cast<UINT64>(this->imageInfo.imageWidth & 0xFFFF) << 16) | (this->imageInfo.imageHeight & 0xFFFF);
+}
+UINT MyWICBitmap::getTotalDecodes()
+{
+    return MyWICBitmap::totalDecodes.load(std::memory_order_relaxed);
+}
 const MYIMAGEINFO &MyWICBitmap::getInfo() const
 {
     return this->imageInfo;
 }
 IWICBitmapSource *MyWICBitmap::getBitmapSource()
 {
+    if (!this->decode())
+        return nullptr;
+
     return *this->pBitmap;
 }
 
@@ -385,6 +443,7 @@ bool MyWAMEngine::createAnimationVariable(IUIAnimationVariable *&pAnimationVaria
             error_message = "Failed to create the animation variable.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::AnimationVariable);
 
         // Set lower bound value.
         hr = pAnimationVariable->SetLowerBound(lowerBound);
@@ -624,6 +683,7 @@ bool MyD2D1Engine::createDCRenderTarget(ID2D1DCRenderTarget *&pRenderTarget, D2D
             error_message = "Failed to create the device context render target.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::RenderTarget);
 
         are_all_operation_success = true;
     }
@@ -668,6 +728,7 @@ bool MyD2D1Engine::createTextFormat(IDWriteTextFormat *&pTextFormat, std::wstrin
             error_message = "Failed to create the direct write text format.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::TextFormat);
 
         are_all_operation_success = true;
     }
@@ -836,6 +897,7 @@ bool MyD2D1Engine::createWicBitmapSourceFromResource(IWICBitmapSource *&pIWCBitm
         // Store the WIC bitmap source.
         pIWCBitmapSource = p_wic_format_converter;
         p_wic_format_converter = nullptr;
+        Deleter::onResourceCreated(MyResourceType::WicBitmapSource);
 
         // Release the resources.
         if (p_wic_scaler)
@@ -950,6 +1012,7 @@ bool MyD2D1Engine::createWicBitmapSourceFromIconResource(IWICBitmapSource *&pIWC
         // Store the WIC bitmap source.
         pIWCBitmapSource = p_wic_format_converter;
         p_wic_format_converter = nullptr;
+        Deleter::onResourceCreated(MyResourceType::WicBitmapSource);
 
         // Release the resources.
         if (p_wic_scaler)
@@ -1168,6 +1231,7 @@ bool MyD2D1Engine::drawText(ID2D1DCRenderTarget *&pRenderTarget, IDWriteTextForm
             error_message = "Failed to create the text layout.";
             break;
         }
+        this->totalTextLayouts++;
 
         // Center the text if specified.
         bool is_switch_success = false;
@@ -0,0 +1,242 @@
+/**
+ * @file input_recorder.cpp
+ * @brief Implementation of the user-defined types defined in input_recorder.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/******************************************
+ * Input recorder classes implementations *
+ ******************************************/
+
+// [MyInputRecorder] class implementations:
+
+static_assert(sizeof(MYINPUTRECORDINGHEADER) == 24 && sizeof(MYINPUTRECORD) == 40, "The input recording structures must match the file format.");
+
+MyInputRecorder::MyInputRecorder()
+{
+    LARGE_INTEGER frequency;
+    if (QueryPerformanceFrequency(&frequency) && frequency.QuadPart > 0)
+        this->counterFrequency = frequency.QuadPart;
+}
+bool MyInputRecorder::isInputMessage(UINT message)
+{
+    switch (message)
+    {
+    case WM_MOUSEMOVE:
+    case WM_MOUSELEAVE:
+    case WM_MOUSEHOVER:
+    case WM_MOUSEWHEEL:
+    case WM_LBUTTONDOWN:
+    case WM_LBUTTONUP:
+    case WM_LBUTTONDBLCLK:
+    case WM_RBUTTONDOWN:
+    case WM_RBUTTONUP:
+    case WM_MBUTTONDOWN:
+    case WM_MBUTTONUP:
+    case WM_KEYDOWN:
+    case WM_KEYUP:
+    case WM_CHAR:
+    case WM_SIZE:
+        return true;
+    default:
+        return false;
+    }
+}
+bool MyInputRecorder::startRecording(const RECT &windowRect)
+{
+    if (this->isReplayActive)
+    {
+        g_pApp->logger.writeLog("Can't record while a replay is in progress.", "[CLASS: 'MyInputRecorder' | FUNC: 'startRecording()']", MyLogType::Error);
+        return false;
+    }
+
+    this->recordingHeader.signature = INPUT_RECORDING_SIGNATURE;
+    this->recordingHeader.version = INPUT_RECORDING_VERSION;
+    this->recordingHeader.windowX = windowRect.left;
+    this->recordingHeader.windowY = windowRect.top;
+    this->recordingHeader.windowWidth = static_cast<UINT32>(windowRect.right - windowRect.left);
+    this->recordingHeader.windowHeight = static_cast<UINT32>(windowRect.bottom - windowRect.top);
+    this->records.clear();
+    this->recordingStartTime = MyProfiler::getTime();
+    this->isRecordingActive = true;
+
+    return true;
+}
+bool MyInputRecorder::stopRecording(const std::wstring &filePath)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (!this->isRecordingActive)
+        {
+            error_message = "No recording is in progress.";
+            break;
+        }
+        this->isRecordingActive = false;
+
+        std::ofstream recording_file(filePath.c_str(), std::ios::binary | std::ios::trunc);
+        if (!recording_file.is_open())
+        {
+            error_message = "Failed to open the recording file.";
+            break;
+        }
+
+        recording_file.write(reinterpret_cast<const char *>(&this->recordingHeader), sizeof(MYINPUTRECORDINGHEADER));
+        recording_file.write(reinterpret_cast<const char *>(this->records.data()), static_cast<std::streamsize>(this->records.size() * sizeof(MYINPUTRECORD)));
+        if (!recording_file.good())
+        {
+            error_message = "Failed to write the recording file.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    this->records.clear();
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyInputRecorder' | FUNC: 'stopRecording()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyInputRecorder::startReplay(const std::wstring &filePath)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (this->isRecordingActive)
+        {
+            error_message = "Can't replay while a recording is in progress.";
+            break;
+        }
+        this->stopReplay();
+
+        std::ifstream recording_file(filePath.c_str(), std::ios::binary | std::ios::ate);
+        if (!recording_file.is_open())
+        {
+            error_message = "Failed to open the recording file.";
+            break;
+        }
+        std::streamoff file_size = recording_file.tellg();
+        if (file_size < static_cast<std::streamoff>(sizeof(MYINPUTRECORDINGHEADER)) || (file_size - sizeof(MYINPUTRECORDINGHEADER)) % sizeof(MYINPUTRECORD))
+        {
+            error_message = "The recording file size is invalid.";
+            break;
+        }
+
+        recording_file.seekg(0);
+        recording_file.read(reinterpret_cast<char *>(&this->replayHeader), sizeof(MYINPUTRECORDINGHEADER));
+        if (!recording_file.good() || this->replayHeader.signature != INPUT_RECORDING_SIGNATURE)
+        {
+            error_message = "The file is not an input recording file.";
+            break;
+        }
+        if (this->replayHeader.version != INPUT_RECORDING_VERSION)
+        {
+            error_message = "The input recording file version is not supported.";
+            break;
+        }
+
+        this->records.resize(static_cast<size_t>((file_size - sizeof(MYINPUTRECORDINGHEADER)) / sizeof(MYINPUTRECORD)));
+        recording_file.read(reinterpret_cast<char *>(this->records.data()), static_cast<std::streamsize>(this->records.size() * sizeof(MYINPUTRECORD)));
+        if (!recording_file.good())
+        {
+            this->records.clear();
+            error_message = "Failed to read the recording file.";
+            break;
+        }
+
+        this->replayPosition = 0;
+        this->replayTime = 0;
+        this->totalReplayRecords = this->records.size();
+        this->totalReplayFrames = 0;
+        this->totalSkippedRecords = 0;
+        this->isReplayActive = true;
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyInputRecorder' | FUNC: 'startReplay()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+void MyInputRecorder::stopReplay()
+{
+    this->isReplayActive = false;
+    this->records.clear();
+    this->replayPosition = 0;
+}
+bool MyInputRecorder::advanceReplay(const std::function<bool(const MYINPUTRECORD &)> &dispatch)
+{
+    if (!this->isReplayActive)
+        return false;
+
+    // A modal loop entered by a replayed message may advance the replay again, the frame is skipped.
+    if (this->isDispatching)
+        return true;
+
+    this->replayTime += INPUT_REPLAY_FRAME_TIME;
+    this->totalReplayFrames++;
+
+    // A replayed message may stop the replay. (e.g. Closing the application)
+    this->isDispatching = true;
+    while (this->isReplayActive && this->replayPosition < this->records.size() && this->records[this->replayPosition].time <= this->replayTime)
+    {
+        MYINPUTRECORD record = this->records[this->replayPosition++];
+        if (!dispatch(record))
+            this->totalSkippedRecords++;
+    }
+    this->isDispatching = false;
+
+    if (this->isReplayActive && this->replayPosition >= this->records.size())
+        this->isReplayActive = false;
+
+    return this->isReplayActive;
+}
+void MyInputRecorder::getReplayStatistics(size_t &totalRecords, size_t &totalSkippedRecords, UINT64 &totalFrames) const
+{
+    totalRecords = this->totalReplayRecords;
+    totalSkippedRecords = this->totalSkippedRecords;
+    totalFrames = this->totalReplayFrames;
+}
+bool MyInputRecorder::enterInput(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
+{
+    // The live resizes are never dropped, the window would no longer match the application state.
+    bool is_dropped = (this->isReplayActive && !this->isDispatching && message != WM_SIZE);
+
+    if (this->isRecordingActive && !this->inputDepth)
+    {
+        // Only the application window and the windows up to two levels below it are identified by their control IDs.
+        MYINPUTRECORD record = {};
+        bool is_identified = true;
+        if (hWnd == g_pApp->hWnd)
+            record.flags = INPUT_RECORD_APPLICATION_WINDOW;
+        else
+        {
+            HWND parent = GetParent(hWnd);
+            record.controlId = static_cast<UINT32>(GetDlgCtrlID(hWnd));
+            if (parent != g_pApp->hWnd)
+            {
+                is_identified = (parent && GetParent(parent) == g_pApp->hWnd);
+                record.parentControlId = (is_identified ? static_cast<UINT32>(GetDlgCtrlID(parent)) : 0);
+            }
+        }
+
+        if (is_identified)
+        {
+            record.time = static_cast<UINT64>((MyProfiler::getTime() - this->recordingStartTime) * 1000000.0 / static_cast<DOUBLE>(this->counterFrequency));
+            record.message = message;
+            record.wParam = static_cast<UINT64>(wParam);
+            record.lParam = static_cast<INT64>(lParam);
+            this->records.push_back(record);
+        }
+    }
+
+    this->inputDepth++;
+    return is_dropped;
+}
@@ -0,0 +1,1060 @@
+/**
+ * @file logger.cpp
+ * @brief Implementation of the user-defined types defined in logger.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/**********************************
+ * Logger classes implementations *
+ **********************************/
+
+// [MyLogSegmentFile] class implementations:
+
+MyLogSegmentFile::MyLogSegmentFile()
+{
+}
+MyLogSegmentFile::~MyLogSegmentFile()
+{
+    this->close();
+}
+bool MyLogSegmentFile::open(const std::wstring &filePath, size_t segmentSize, UINT segmentCount)
+{
+    // The errors aren't logged, the logger is the only user of the segments.
+    bool are_all_operation_success = false;
+    while (!are_all_operation_success)
+    {
+        if (this->pView || filePath.empty() || !segmentSize || !segmentCount)
+            break;
+
+        this->filePath = filePath;
+        this->segmentSize = segmentSize;
+        this->segmentCount = segmentCount;
+
+        this->hFile = CreateFileW(this->filePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                  nullptr, OPEN_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (this->hFile == INVALID_HANDLE_VALUE)
+            break;
+
+        // A full segment (or one left preallocated by a crash) is rotated before appending.
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(this->hFile, &file_size))
+            break;
+        if (static_cast<ULONGLONG>(file_size.QuadPart) >= this->segmentSize)
+        {
+            CloseHandle(this->hFile);
+            this->hFile = nullptr;
+            if (!this->shiftSegments())
+                break;
+            this->totalRotations++;
+
+            this->hFile = CreateFileW(this->filePath.c_str(), GENERIC_READ | GENERIC_WRITE, FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE,
+                                      nullptr, CREATE_ALWAYS, FILE_ATTRIBUTE_NORMAL, nullptr);
+            if (this->hFile == INVALID_HANDLE_VALUE)
+                break;
+            file_size.QuadPart = 0;
+        }
+        this->writtenSize = static_cast<size_t>(file_size.QuadPart);
+
+        // Preallocate the segment and map it.
+        LARGE_INTEGER mapping_size;
+        mapping_size.QuadPart = static_cast<LONGLONG>(this->segmentSize);
+        if (!SetFilePointerEx(this->hFile, mapping_size, nullptr, FILE_BEGIN) || !SetEndOfFile(this->hFile))
+            break;
+        this->hMapping = CreateFileMappingW(this->hFile, nullptr, PAGE_READWRITE, mapping_size.HighPart, mapping_size.LowPart, nullptr);
+        if (!this->hMapping)
+            break;
+        this->pView = static_cast<char *>(MapViewOfFile(this->hMapping, FILE_MAP_WRITE, 0, 0, this->segmentSize));
+        if (!this->pView)
+            break;
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        this->close();
+
+    return are_all_operation_success;
+}
+void MyLogSegmentFile::close()
+{
+    if (this->pView)
+    {
+        UnmapViewOfFile(this->pView);
+        this->pView = nullptr;
+    }
+    if (this->hMapping)
+    {
+        CloseHandle(this->hMapping);
+        this->hMapping = nullptr;
+    }
+    if (this->hFile && this->hFile != INVALID_HANDLE_VALUE)
+    {
+        // Drop the unwritten preallocated tail.
+        LARGE_INTEGER written_size;
+        written_size.QuadPart = static_cast<LONGLONG>(this->writtenSize);
+        if (SetFilePointerEx(this->hFile, written_size, nullptr, FILE_BEGIN))
+            SetEndOfFile(this->hFile);
+        CloseHandle(this->hFile);
+    }
+    this->hFile = nullptr;
+    this->writtenSize = 0;
+}
+bool MyLogSegmentFile::rotate()
+{
+    if (!this->pView)
+        return false;
+
+    this->close();
+    if (!this->shiftSegments())
+        return false;
+    this->totalRotations++;
+
+    return this->open(this->filePath, this->segmentSize, this->segmentCount);
+}
+bool MyLogSegmentFile::write(const char *pData, size_t size)
+{
+    if (!this->pView || size > this->segmentSize - this->writtenSize)
+        return false;
+
+    memcpy(this->pView + this->writtenSize, pData, size);
+    this->writtenSize += size;
+
+    return true;
+}
+bool MyLogSegmentFile::isOpen()
+{
+    return (this->pView != nullptr);
+}
+size_t MyLogSegmentFile::getWrittenSize()
+{
+    return this->writtenSize;
+}
+size_t MyLogSegmentFile::getFreeSize()
+{
+    return (this->pView ? this->segmentSize - this->writtenSize : 0);
+}
+UINT MyLogSegmentFile::getTotalRotations()
+{
+    return this->totalRotations;
+}
+std::wstring MyLogSegmentFile::getSegmentPath(UINT index)
+{
+    if (!index)
+        return this->filePath;
+
+    // <name>.<index><extension>
+    std::filesystem::path segment_path = this->filePath;
+    std::wstring extension = segment_path.extension().wstring();
+    segment_path.replace_extension(L"." + std::to_wstring(index) + extension);
+
+    return segment_path.wstring();
+}
+bool MyLogSegmentFile::shiftSegments()
+{
+    // Delete the oldest segment and shift the others, the current segment becomes segment 1.
+    std::wstring oldest_segment_path = this->getSegmentPath(this->segmentCount - 1);
+    if (!DeleteFileW(oldest_segment_path.c_str()) && GetLastError() != ERROR_FILE_NOT_FOUND)
+        return false;
+    for (UINT i = this->segmentCount - 1; i > 0; i--)
+    {
+        std::wstring source_path = this->getSegmentPath(i - 1);
+        if (!MoveFileExW(source_path.c_str(), this->getSegmentPath(i).c_str(), MOVEFILE_REPLACE_EXISTING) && GetLastError() != ERROR_FILE_NOT_FOUND)
+            return false;
+    }
+
+    return true;
+}
+
+// [MyLogger] class implementations:
+
+MyLogger::MyLogger()
+{
+    std::wstring command_line = GetCommandLineW();
+    if (command_line.size() <= 2)
+        throw std::runtime_error("Unexpected command line string.");
+
+    command_line.erase(0, 1);
+    command_line.pop_back();
+    this->path = command_line;
+}
+MyLogger::MyLogger(std::wstring path)
+    : path(path)
+{
+    if (path.size() <= 2)
+        throw std::runtime_error("Invalid path string.");
+}
+MyLogger::~MyLogger()
+{
+    Deleter::detachLogger(this);
+    this->stopAsync();
+    this->flushSuppressedRecords(true);
+
+    if (this->isSegmentAbandoned.load(std::memory_order_acquire))
+        return;
+    AcquireSRWLockExclusive(&this->logSegmentLock);
+    this->logSegment.close();
+    ReleaseSRWLockExclusive(&this->logSegmentLock);
+}
+int MyLogger::getLogLevel()
+{
+    return this->logLevel.load(std::memory_order_relaxed);
+}
+bool MyLogger::setPath(std::wstring path)
+{
+    if (path.empty())
+    {
+        std::wstring command_line = GetCommandLineW();
+        if (command_line.size() <= 2)
+            throw std::runtime_error("Unexpected command line string.");
+
+        command_line.erase(0, 1);
+        command_line.pop_back();
+        this->path = command_line;
+    }
+    else
+    {
+        if (path.size() <= 2)
+            return false;
+
+        this->path = path;
+    }
+
+    return true;
+}
+bool MyLogger::setLogLevel(int logLevel)
+{
+    this->logLevel.store(logLevel, std::memory_order_relaxed);
+    return true;
+}
+bool MyLogger::setLogFileName(std::wstring logFileName)
+{
+    if (logFileName.empty())
+        return false;
+
+    this->logFileName = logFileName;
+
+    return true;
+}
+bool MyLogger::writeLog(std::string description, std::string extraDescription, MyLogType logType)
+{
+    if (!this->isLogTypeEnabled(logType))
+        return true;
+
+    if (!extraDescription.empty())
+        description += " " + extraDescription;
+    if (this->logFormat.load(std::memory_order_relaxed) == MyLogFormat::Binary)
+    {
+        // Unstructured records use the reserved call site of their log type.
+        std::string payload = "";
+        MyLogger::encodeStringArgument(payload, description);
+        return this->writeEncodedLog(static_cast<UINT>(logType), 1, payload);
+    }
+    if (this->pushRecord(logType, false, false, false, description))
+        return true;
+
+    std::string line = "";
+    this->formatRecord(this->getCurrentDateTimeString(), logType, false, false, description, line);
+
+    return this->writeSegmentRecordSync(line, false);
+}
+bool MyLogger::writeLog(std::string description, bool includeTime)
+{
+    if (this->logFormat.load(std::memory_order_relaxed) == MyLogFormat::Binary)
+    {
+        std::string payload = "";
+        MyLogger::encodeStringArgument(payload, description);
+        return this->writeEncodedLog((includeTime ? 5 : 4), 1, payload);
+    }
+    if (this->pushRecord(MyLogType::Info, true, includeTime, false, description))
+        return true;
+
+    std::string line = "";
+    this->formatRecord((includeTime ? this->getCurrentDateTimeString() : ""), MyLogType::Info, true, includeTime, description, line);
+
+    return this->writeSegmentRecordSync(line, false);
+}
+bool MyLogger::writeLimitedLog(std::string description, std::string extraDescription, MyLogType logType)
+{
+    if (!this->isLogTypeEnabled(logType))
+        return true;
+
+    UINT64 record_hash = MyLogger::hashRecord(logType, description, extraDescription);
+    ULONGLONG current_time = GetTickCount64();
+    UINT total_suppressed_records = 0;
+    AcquireSRWLockExclusive(&this->rateLimitLock);
+    auto it = this->rateLimits.find(record_hash);
+    if (it == this->rateLimits.end())
+    {
+        // First occurrence, the record takes a token from a full bucket.
+        if (this->rateLimits.size() < MyLogger::maximumRateLimits)
+        {
+            MYLOGRATELIMIT &rate_limit = this->rateLimits[record_hash];
+            rate_limit.logType = logType;
+            rate_limit.text = (extraDescription.empty() ? description : description + " " + extraDescription);
+            rate_limit.lastRefillTime = current_time;
+            rate_limit.credit = (MyLogger::rateLimitBurst - 1) * MyLogger::rateLimitInterval;
+            rate_limit.lastSuppressedTime = 0;
+            rate_limit.totalSuppressedRecords = 0;
+        }
+    }
+    else
+    {
+        MYLOGRATELIMIT &rate_limit = it->second;
+        rate_limit.credit += current_time - rate_limit.lastRefillTime;
+        if (rate_limit.credit > MyLogger::rateLimitBurst * MyLogger::rateLimitInterval)
+            rate_limit.credit = MyLogger::rateLimitBurst * MyLogger::rateLimitInterval;
+        rate_limit.lastRefillTime = current_time;
+
+        if (rate_limit.credit < MyLogger::rateLimitInterval)
+        {
+            // The bucket is empty, count the record and drop it.
+            if (!rate_limit.totalSuppressedRecords++)
+                this->totalPendingSummaries.fetch_add(1, std::memory_order_relaxed);
+            rate_limit.lastSuppressedTime = current_time;
+            ReleaseSRWLockExclusive(&this->rateLimitLock);
+            this->totalSuppressedRecords.fetch_add(1, std::memory_order_relaxed);
+            return true;
+        }
+
+        rate_limit.credit -= MyLogger::rateLimitInterval;
+        total_suppressed_records = rate_limit.totalSuppressedRecords;
+        if (total_suppressed_records)
+        {
+            rate_limit.totalSuppressedRecords = 0;
+            this->totalPendingSummaries.fetch_sub(1, std::memory_order_relaxed);
+        }
+    }
+    ReleaseSRWLockExclusive(&this->rateLimitLock);
+
+    // The written record carries the summary of the records suppressed before it.
+    if (total_suppressed_records)
+        extraDescription += (extraDescription.empty() ? "(" : " (") + std::to_string(total_suppressed_records) + " repeated record(s) suppressed)";
+
+    return this->writeLog(description, extraDescription, logType);
+}
+bool MyLogger::startAsync(UINT capacity, MyLogOverflowPolicy overflowPolicy)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (this->hFlushThread)
+        {
+            error_message = "The logger is already in asynchronous mode.";
+            break;
+        }
+        if (this->isSegmentAbandoned.load(std::memory_order_acquire))
+        {
+            error_message = "The log segment is abandoned to a stuck flush thread.";
+            break;
+        }
+
+        // Allocate the ring buffer, each slot starts with its own position as sequence number.
+        size_t total_slots = 2;
+        while (total_slots < capacity)
+            total_slots <<= 1;
+        this->pRecords.reset(new MYLOGRECORD[total_slots]);
+        for (size_t i = 0; i < total_slots; i++)
+            this->pRecords[i].sequence.store(i, std::memory_order_relaxed);
+        this->recordMask = total_slots - 1;
+        this->enqueuePosition.store(0, std::memory_order_relaxed);
+        this->dequeuePosition = 0;
+        this->flushedPosition.store(0, std::memory_order_relaxed);
+        this->overflowPolicy = overflowPolicy;
+        this->isStopping.store(false, std::memory_order_relaxed);
+
+        this->hFlushEvent = CreateEventW(nullptr, FALSE, FALSE, nullptr);
+        if (!this->hFlushEvent)
+        {
+            error_message = "Failed to create the flush event.";
+            break;
+        }
+        this->hFlushThread = CreateThread(nullptr, 0, MyLogger::flushThreadProcedure, this, 0, nullptr);
+        if (!this->hFlushThread)
+        {
+            error_message = "Failed to create the flush thread.";
+            break;
+        }
+        this->isAsyncMode.store(true, std::memory_order_release);
+
+        // Flush the pending records on unhandled exceptions.
+        if (!MyLogger::pCrashFlushLogger)
+        {
+            MyLogger::pCrashFlushLogger = this;
+            MyLogger::pPreviousExceptionFilter = SetUnhandledExceptionFilter(MyLogger::crashHandler);
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+    {
+        if (this->hFlushEvent)
+        {
+            CloseHandle(this->hFlushEvent);
+            this->hFlushEvent = nullptr;
+        }
+        this->pRecords.reset();
+        this->writeLog(error_message, "[CLASS: 'MyLogger' | FUNC: 'startAsync()']", MyLogType::Error);
+    }
+
+    return are_all_operation_success;
+}
+bool MyLogger::stopAsync(DWORD timeout)
+{
+    if (!this->hFlushThread)
+        return true;
+
+    // Write the pending summaries while the flush thread is still running.
+    this->flushSuppressedRecords(true);
+
+    // Route the new records to the synchronous path, then wait for the in-flight pushes to complete.
+    this->isAsyncMode.store(false, std::memory_order_seq_cst);
+    while (this->totalActiveProducers.load(std::memory_order_seq_cst))
+        SwitchToThread();
+
+    if (MyLogger::pCrashFlushLogger == this)
+    {
+        SetUnhandledExceptionFilter(MyLogger::pPreviousExceptionFilter);
+        MyLogger::pCrashFlushLogger = nullptr;
+        MyLogger::pPreviousExceptionFilter = nullptr;
+    }
+
+    // The flush thread writes everything left in the ring buffer before it exits.
+    this->isStopping.store(true, std::memory_order_release);
+    SetEvent(this->hFlushEvent);
+    bool is_flushed = (WaitForSingleObject(this->hFlushThread, timeout) == WAIT_OBJECT_0);
+    CloseHandle(this->hFlushThread);
+    this->hFlushThread = nullptr;
+    if (is_flushed)
+    {
+        CloseHandle(this->hFlushEvent);
+        this->pRecords.reset();
+    }
+    else
+    {
+        // The flush thread is stuck (e.g. on disk I/O), abandon it with the remaining records rather than blocking the shutdown.
+        // Terminating it could leave the segment lock held forever, so the thread keeps its ring buffer, its event and the segment.
+        this->totalDroppedRecords.fetch_add(this->enqueuePosition.load() - this->flushedPosition.load());
+        this->isSegmentAbandoned.store(true, std::memory_order_release);
+        static_cast<void>(this->pRecords.release());
+    }
+    this->hFlushEvent = nullptr;
+
+    return is_flushed;
+}
+bool MyLogger::flush(DWORD timeout)
+{
+    if (!this->isAsyncMode.load(std::memory_order_acquire))
+        return true;
+
+    size_t target_position = this->enqueuePosition.load(std::memory_order_acquire);
+    SetEvent(this->hFlushEvent);
+
+    ULONGLONG start_time = GetTickCount64();
+    while (this->flushedPosition.load(std::memory_order_acquire) < target_position)
+    {
+        if (GetTickCount64() - start_time >= timeout)
+            return false;
+        Sleep(1);
+    }
+
+    return true;
+}
+bool MyLogger::isAsync()
+{
+    return this->isAsyncMode.load(std::memory_order_acquire);
+}
+ULONGLONG MyLogger::getTotalDroppedRecords()
+{
+    return this->totalDroppedRecords.load(std::memory_order_relaxed);
+}
+ULONGLONG MyLogger::getTotalBlockedRecords()
+{
+    return this->totalBlockedRecords.load(std::memory_order_relaxed);
+}
+ULONGLONG MyLogger::getTotalWrittenRecords()
+{
+    return this->totalWrittenRecords.load(std::memory_order_relaxed);
+}
+size_t MyLogger::getQueueDepth()
+{
+    size_t flushed_position = this->flushedPosition.load(std::memory_order_relaxed);
+    size_t enqueue_position = this->enqueuePosition.load(std::memory_order_relaxed);
+    return (enqueue_position > flushed_position ? enqueue_position - flushed_position : 0);
+}
+ULONGLONG MyLogger::getTotalSuppressedRecords()
+{
+    return this->totalSuppressedRecords.load(std::memory_order_relaxed);
+}
+bool MyLogger::setLogRotation(size_t segmentSize, UINT segmentCount)
+{
+    if (!segmentSize || !segmentCount || this->isSegmentAbandoned.load(std::memory_order_acquire))
+        return false;
+
+    AcquireSRWLockExclusive(&this->logSegmentLock);
+    this->logSegment.close();
+    this->logSegmentSize = segmentSize;
+    this->logSegmentCount = segmentCount;
+    ReleaseSRWLockExclusive(&this->logSegmentLock);
+
+    return true;
+}
+UINT MyLogger::getTotalRotations()
+{
+    if (this->isSegmentAbandoned.load(std::memory_order_acquire))
+        return 0;
+
+    AcquireSRWLockShared(&this->logSegmentLock);
+    UINT total_rotations = this->logSegment.getTotalRotations();
+    ReleaseSRWLockShared(&this->logSegmentLock);
+
+    return total_rotations;
+}
+std::string MyLogger::getCurrentDateTimeString()
+{
+    return this->getDateTimeString(time(0));
+}
+std::string MyLogger::getDateTimeString(time_t time)
+{
+    tm time_struct;
+    CHAR text_buffer[80];
+    if (localtime_s(&time_struct, &time))
+        return "";
+
+    strftime(text_buffer, 79, "%Y-%m-%d.%X", &time_struct);
+
+    return text_buffer;
+}
+void MyLogger::formatRecord(const std::string &dateTime, MyLogType logType, bool isCustom, bool includeTime, const std::string &text, std::string &line)
+{
+    if (isCustom)
+    {
+        if (includeTime)
+            line += "[" + dateTime + "] ";
+        line += text;
+        line += "\n";
+        return;
+    }
+
+    line += "[" + dateTime + "] ";
+    switch (logType)
+    {
+    case MyLogType::Info:
+        line += "(INFO)";
+        break;
+    case MyLogType::Warn:
+        line += "(WARN)";
+        break;
+    case MyLogType::Error:
+        line += "(ERROR)";
+        break;
+    case MyLogType::Debug:
+        line += "(DEBUG)";
+        break;
+    }
+    line += " ";
+    line += text;
+    line += "\n";
+}
+bool MyLogger::pushRecord(MyLogType logType, bool isCustom, bool includeTime, bool isBinary, std::string &text)
+{
+    // Register as an active producer before checking the mode, so `stopAsync()` can't free the ring buffer underneath.
+    this->totalActiveProducers.fetch_add(1, std::memory_order_seq_cst);
+    if (!this->isAsyncMode.load(std::memory_order_seq_cst))
+    {
+        this->totalActiveProducers.fetch_sub(1, std::memory_order_release);
+        return false;
+    }
+
+    // Claim a slot. (Bounded multi-producer queue, the slot sequence tells whether it is free for the claimed position)
+    MYLOGRECORD *p_record = nullptr;
+    size_t position = this->enqueuePosition.load(std::memory_order_relaxed);
+    ULONGLONG block_start_time = 0;
+    while (true)
+    {
+        p_record = &this->pRecords[position & this->recordMask];
+        size_t sequence = p_record->sequence.load(std::memory_order_acquire);
+        INT_PTR difference = static_cast<INT_PTR>(sequence) - static_cast<INT_PTR>(position);
+        if (!difference)
+        {
+            if (this->enqueuePosition.compare_exchange_weak(position, position + 1, std::memory_order_relaxed))
+                break;
+        }
+        else if (difference < 0)
+        {
+            // The ring buffer is full.
+            if (this->overflowPolicy == MyLogOverflowPolicy::Block)
+            {
+                if (!block_start_time)
+                {
+                    block_start_time = GetTickCount64();
+                    this->totalBlockedRecords.fetch_add(1, std::memory_order_relaxed);
+                }
+                if (GetTickCount64() - block_start_time < MyLogger::maximumBlockTime)
+                {
+                    SetEvent(this->hFlushEvent);
+                    Sleep(1);
+                    position = this->enqueuePosition.load(std::memory_order_relaxed);
+                    continue;
+                }
+            }
+
+            this->totalDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+            this->totalActiveProducers.fetch_sub(1, std::memory_order_release);
+            return true;
+        }
+        else
+            position = this->enqueuePosition.load(std::memory_order_relaxed);
+    }
+
+    p_record->time = time(0);
+    p_record->logType = logType;
+    p_record->isCustom = isCustom;
+    p_record->includeTime = includeTime;
+    p_record->isBinary = isBinary;
+    p_record->text = std::move(text);
+    p_record->sequence.store(position + 1, std::memory_order_release);
+
+    // Wake the flush thread early for errors or when the ring buffer is getting full.
+    if ((!isCustom && logType == MyLogType::Error) || position - this->flushedPosition.load(std::memory_order_relaxed) > (this->recordMask >> 1))
+        SetEvent(this->hFlushEvent);
+
+    this->totalActiveProducers.fetch_sub(1, std::memory_order_release);
+    return true;
+}
+DWORD WINAPI MyLogger::flushThreadProcedure(LPVOID pParameter)
+{
+    MyLogger *p_this = static_cast<MyLogger *>(pParameter);
+
+    // The log format is fixed for the lifetime of the flush thread. (See `setLogFormat()`)
+    bool is_binary = (p_this->logFormat.load(std::memory_order_acquire) == MyLogFormat::Binary);
+    std::string line = "";
+    time_t cached_time = 0;
+    std::string cached_date_time = "";
+    while (true)
+    {
+        WaitForSingleObject(p_this->hFlushEvent, MyLogger::flushInterval);
+        bool is_stopping = p_this->isStopping.load(std::memory_order_acquire);
+
+        // Summarize the suppressed records that stopped repeating, they are drained below.
+        if (!is_stopping)
+            p_this->flushSuppressedRecords(false);
+
+        // Drain the ring buffer into the mapped log segment.
+        ULONGLONG total_records = 0;
+        AcquireSRWLockExclusive(&p_this->logSegmentLock);
+        while (true)
+        {
+            MYLOGRECORD &record = p_this->pRecords[p_this->dequeuePosition & p_this->recordMask];
+            if (record.sequence.load(std::memory_order_acquire) != p_this->dequeuePosition + 1)
+                break; // Empty, or the next slot isn't published yet.
+
+            bool is_written = false;
+            if (record.isBinary != is_binary)
+                is_written = false; // Pushed across a log format switch.
+            else if (is_binary)
+                is_written = p_this->writeSegmentRecord(record.text, true);
+            else
+            {
+                if (record.time != cached_time)
+                {
+                    cached_time = record.time;
+                    cached_date_time = p_this->getDateTimeString(cached_time);
+                }
+                line.clear();
+                p_this->formatRecord(cached_date_time, record.logType, record.isCustom, record.includeTime, record.text, line);
+                is_written = p_this->writeSegmentRecord(line, false);
+            }
+            if (is_written)
+                total_records++;
+            else
+                p_this->totalDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+
+            record.text.clear();
+            record.sequence.store(p_this->dequeuePosition + p_this->recordMask + 1, std::memory_order_release);
+            p_this->dequeuePosition++;
+        }
+        ReleaseSRWLockExclusive(&p_this->logSegmentLock);
+        p_this->totalWrittenRecords.fetch_add(total_records, std::memory_order_relaxed);
+        p_this->flushedPosition.store(p_this->dequeuePosition, std::memory_order_release);
+
+        if (is_stopping)
+            break;
+    }
+
+    return 0;
+}
+LONG WINAPI MyLogger::crashHandler(EXCEPTION_POINTERS *pExceptionInfo)
+{
+    if (MyLogger::pCrashFlushLogger)
+    {
+        MyLogger::pCrashFlushLogger->writeLog("Unhandled exception, flushing the pending log records.", "[CLASS: 'MyLogger' | FUNC: 'crashHandler()']", MyLogType::Error);
+        MyLogger::pCrashFlushLogger->flush(MyLogger::crashFlushTimeout);
+    }
+
+    return (MyLogger::pPreviousExceptionFilter ? MyLogger::pPreviousExceptionFilter(pExceptionInfo) : EXCEPTION_CONTINUE_SEARCH);
+}
+MyLogFormat MyLogger::getLogFormat()
+{
+    return this->logFormat.load(std::memory_order_acquire);
+}
+bool MyLogger::setLogFormat(MyLogFormat logFormat)
+{
+    if (this->logFormat.load(std::memory_order_acquire) == logFormat)
+        return true;
+    if (this->isSegmentAbandoned.load(std::memory_order_acquire))
+        return false;
+
+    // Restart the asynchronous mode, a flush thread only writes the records of its format.
+    bool is_async = (this->hFlushThread != nullptr);
+    UINT capacity = static_cast<UINT>(this->recordMask + 1);
+    if (is_async)
+        this->stopAsync();
+
+    // The next write opens the log file of the new format.
+    AcquireSRWLockExclusive(&this->logSegmentLock);
+    this->logSegment.close();
+
+    if (logFormat == MyLogFormat::Binary)
+    {
+        // Start a new binary log session, the records store the performance counter ticks since the session start.
+        LARGE_INTEGER frequency, counter;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&counter);
+        this->sessionCounterFrequency = frequency.QuadPart;
+        this->sessionBaseCounter = counter.QuadPart;
+
+        time_t now = time(0);
+        tm time_struct;
+        this->sessionBaseTime = static_cast<INT64>(now);
+        this->sessionTimeBias = (localtime_s(&time_struct, &now) ? 0 : static_cast<INT32>(_mkgmtime(&time_struct) - now));
+        this->isBinarySessionStarted = false;
+        this->totalEmittedCallSites = 0;
+    }
+    this->logFormat.store(logFormat, std::memory_order_release);
+    ReleaseSRWLockExclusive(&this->logSegmentLock);
+
+    if (is_async && !this->startAsync(capacity, this->overflowPolicy))
+        return false;
+
+    return true;
+}
+UINT MyLogger::registerCallSite(const MYLOGCALLSITE &callSite)
+{
+    AcquireSRWLockExclusive(&MyLogger::callSiteLock);
+    UINT call_site_id = MyLogger::totalCallSites.load(std::memory_order_relaxed);
+    if (call_site_id < MyLogger::maximumCallSites)
+    {
+        MyLogger::callSites[call_site_id] = callSite;
+        MyLogger::totalCallSites.store(call_site_id + 1, std::memory_order_release);
+    }
+    else
+        call_site_id = static_cast<UINT>(callSite.logType); // The registry is full, fall back to the unstructured call site. (The arguments are appended)
+    ReleaseSRWLockExclusive(&MyLogger::callSiteLock);
+
+    return call_site_id;
+}
+void MyLogger::flushSuppressedRecords(bool isForced)
+{
+    if (!this->totalPendingSummaries.load(std::memory_order_relaxed))
+        return;
+
+    // Collect the summaries under the lock, write them after releasing it.
+    ULONGLONG current_time = GetTickCount64();
+    std::vector<std::pair<MyLogType, std::string>> summaries;
+    AcquireSRWLockExclusive(&this->rateLimitLock);
+    for (auto &rate_limit_pair : this->rateLimits)
+    {
+        MYLOGRATELIMIT &rate_limit = rate_limit_pair.second;
+        if (!rate_limit.totalSuppressedRecords || (!isForced && current_time - rate_limit.lastSuppressedTime < MyLogger::rateLimitSummaryDelay))
+            continue;
+
+        summaries.push_back({rate_limit.logType, rate_limit.text + " (" + std::to_string(rate_limit.totalSuppressedRecords) + " repeated record(s) suppressed)"});
+        rate_limit.totalSuppressedRecords = 0;
+        this->totalPendingSummaries.fetch_sub(1, std::memory_order_relaxed);
+    }
+    ReleaseSRWLockExclusive(&this->rateLimitLock);
+
+    for (const auto &summary : summaries)
+        this->writeLog(summary.second, "", summary.first);
+}
+UINT64 MyLogger::hashRecord(MyLogType logType, const std::string &description, const std::string &extraDescription)
+{
+    UINT64 hash = 14695981039346656037ULL;
+    auto hash_byte = [&hash](UCHAR byte)
+    {
+        hash ^= byte;
+        hash *= 1099511628211ULL;
+    };
+
+    hash_byte(static_cast<UCHAR>(logType));
+    for (CHAR character : description)
+        hash_byte(static_cast<UCHAR>(character));
+    hash_byte(0); // Separator, "ab" + "c" and "a" + "bc" hash differently.
+    for (CHAR character : extraDescription)
+        hash_byte(static_cast<UCHAR>(character));
+
+    return hash;
+}
+bool MyLogger::writeSegmentRecord(const std::string &record, bool isBinary)
+{
+    if (!this->logSegment.isOpen())
+    {
+        if (!this->logSegment.open(this->path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + (isBinary ? this->binaryLogFileName : this->logFileName).c_str(),
+                                   this->logSegmentSize, this->logSegmentCount))
+            return false;
+
+        // The segment may be a new file, start a new binary log session in it.
+        this->isBinarySessionStarted = false;
+        this->totalEmittedCallSites = 0;
+    }
+
+    std::string session_records = "";
+    if (isBinary)
+        this->appendBinarySessionRecords(session_records);
+    if (session_records.size() + record.size() > this->logSegment.getFreeSize() && this->logSegment.getWrittenSize())
+    {
+        if (!this->logSegment.rotate())
+            return false;
+
+        // Every segment starts a new binary log session, so it decodes without the older segments.
+        if (isBinary)
+        {
+            this->isBinarySessionStarted = false;
+            this->totalEmittedCallSites = 0;
+            session_records.clear();
+            this->appendBinarySessionRecords(session_records);
+        }
+    }
+
+    if (!session_records.empty() && !this->logSegment.write(session_records.data(), session_records.size()))
+        return false;
+
+    // A record larger than a segment is truncated.
+    size_t free_size = this->logSegment.getFreeSize();
+    return this->logSegment.write(record.data(), (record.size() < free_size ? record.size() : free_size));
+}
+bool MyLogger::writeSegmentRecordSync(const std::string &record, bool isBinary)
+{
+    // The abandoned flush thread may hold the segment lock forever. (See `stopAsync()`)
+    if (this->isSegmentAbandoned.load(std::memory_order_acquire))
+    {
+        this->totalDroppedRecords.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    AcquireSRWLockExclusive(&this->logSegmentLock);
+    bool is_written = this->writeSegmentRecord(record, isBinary);
+    ReleaseSRWLockExclusive(&this->logSegmentLock);
+
+    return is_written;
+}
+bool MyLogger::isCallSiteEnabled(UINT callSiteId)
+{
+    if (callSiteId >= MyLogger::totalCallSites.load(std::memory_order_acquire))
+        return false;
+
+    const MYLOGCALLSITE &call_site = MyLogger::callSites[callSiteId];
+    if (call_site.isCustom)
+        return true;
+
+    return this->isLogTypeEnabled(call_site.logType);
+}
+bool MyLogger::writeEncodedLog(UINT callSiteId, UINT8 totalArguments, std::string &payload)
+{
+    if (callSiteId >= MyLogger::totalCallSites.load(std::memory_order_acquire))
+        return false;
+    const MYLOGCALLSITE &call_site = MyLogger::callSites[callSiteId];
+
+    // Text format, format the record immediately.
+    if (this->logFormat.load(std::memory_order_relaxed) == MyLogFormat::Text)
+    {
+        std::string text = "";
+        if (!MyLogger::formatStructuredRecord(call_site, totalArguments, payload, text))
+            return false;
+
+        return (call_site.isCustom ? this->writeLog(text, call_site.includeTime) : this->writeLog(text, "", call_site.logType));
+    }
+
+    // Binary format, store the call site ID, the timestamp and the raw arguments.
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    std::string record = "";
+    record.reserve(payload.size() + 16);
+    record += static_cast<char>(LOG_BINARY_RECORD_EVENT);
+    MyLogger::appendVarint(record, callSiteId);
+    MyLogger::appendVarint(record, static_cast<UINT64>(counter.QuadPart > this->sessionBaseCounter ? counter.QuadPart - this->sessionBaseCounter : 0));
+    record += static_cast<char>(totalArguments);
+    record += payload;
+    if (this->pushRecord(call_site.logType, call_site.isCustom, call_site.includeTime, true, record))
+        return true;
+
+    return this->writeSegmentRecordSync(record, true);
+}
+void MyLogger::appendBinarySessionRecords(std::string &buffer)
+{
+    // Session header. (Windows is little-endian, the fixed-size fields are copied as is)
+    if (!this->isBinarySessionStarted)
+    {
+        UINT32 signature = LOG_BINARY_SIGNATURE;
+        buffer += static_cast<char>(LOG_BINARY_RECORD_SESSION);
+        buffer.append(reinterpret_cast<const char *>(&signature), sizeof(signature));
+        buffer += static_cast<char>(LOG_BINARY_VERSION);
+        buffer.append(reinterpret_cast<const char *>(&this->sessionCounterFrequency), sizeof(this->sessionCounterFrequency));
+        buffer.append(reinterpret_cast<const char *>(&this->sessionBaseTime), sizeof(this->sessionBaseTime));
+        buffer.append(reinterpret_cast<const char *>(&this->sessionTimeBias), sizeof(this->sessionTimeBias));
+        this->isBinarySessionStarted = true;
+    }
+
+    // Definitions of the call sites registered since the last write.
+    UINT total_call_sites = MyLogger::totalCallSites.load(std::memory_order_acquire);
+    for (; this->totalEmittedCallSites < total_call_sites; this->totalEmittedCallSites++)
+    {
+        const MYLOGCALLSITE &call_site = MyLogger::callSites[this->totalEmittedCallSites];
+        size_t description_length = strlen(call_site.description);
+        size_t extra_description_length = strlen(call_site.extraDescription);
+        buffer += static_cast<char>(LOG_BINARY_RECORD_CALLSITE);
+        MyLogger::appendVarint(buffer, this->totalEmittedCallSites);
+        buffer += static_cast<char>(call_site.logType);
+        buffer += static_cast<char>((call_site.isCustom ? LOG_BINARY_CALLSITE_CUSTOM : 0) | (call_site.includeTime ? LOG_BINARY_CALLSITE_INCLUDETIME : 0));
+        MyLogger::appendVarint(buffer, description_length);
+        buffer.append(call_site.description, description_length);
+        MyLogger::appendVarint(buffer, extra_description_length);
+        buffer.append(call_site.extraDescription, extra_description_length);
+    }
+}
+bool MyLogger::formatStructuredRecord(const MYLOGCALLSITE &callSite, UINT8 totalArguments, const std::string &payload, std::string &text)
+{
+    size_t offset = 0;
+    UINT8 total_decoded_arguments = 0;
+    const char *descriptions[] = {callSite.description, callSite.extraDescription};
+    for (size_t i = 0; i < 2; i++)
+    {
+        const char *p_description = descriptions[i];
+        if (!p_description || !p_description[0])
+            continue;
+        if (i)
+            text += " ";
+
+        // Replace the placeholders with the arguments.
+        while (true)
+        {
+            const char *p_placeholder = (total_decoded_arguments < totalArguments ? strstr(p_description, "{}") : nullptr);
+            if (!p_placeholder)
+            {
+                text += p_description;
+                break;
+            }
+            text.append(p_description, p_placeholder - p_description);
+            if (!MyLogger::decodeArgument(payload, offset, text))
+                return false;
+            total_decoded_arguments++;
+            p_description = p_placeholder + 2;
+        }
+    }
+
+    // Append the arguments without a placeholder.
+    for (; total_decoded_arguments < totalArguments; total_decoded_arguments++)
+    {
+        text += " ";
+        if (!MyLogger::decodeArgument(payload, offset, text))
+            return false;
+    }
+
+    return true;
+}
+bool MyLogger::decodeArgument(const std::string &payload, size_t &offset, std::string &text)
+{
+    if (offset >= payload.size())
+        return false;
+
+    UINT64 value = 0;
+    switch (static_cast<UINT8>(payload[offset++]))
+    {
+    case LOG_BINARY_ARGUMENT_SIGNED:
+    {
+        if (!MyLogger::readVarint(payload, offset, value))
+            return false;
+        text += std::to_string(static_cast<INT64>((value >> 1) ^ (0 - (value & 1))));
+        return true;
+    }
+    case LOG_BINARY_ARGUMENT_UNSIGNED:
+    {
+        if (!MyLogger::readVarint(payload, offset, value))
+            return false;
+        text += std::to_string(value);
+        return true;
+    }
+    case LOG_BINARY_ARGUMENT_FLOAT:
+    {
+        double float_value = 0.0;
+        CHAR text_buffer[32];
+        if (payload.size() - offset < sizeof(float_value))
+            return false;
+        memcpy(&float_value, payload.data() + offset, sizeof(float_value));
+        offset += sizeof(float_value);
+        snprintf(text_buffer, sizeof(text_buffer), "%g", float_value);
+        text += text_buffer;
+        return true;
+    }
+    case LOG_BINARY_ARGUMENT_STRING:
+    {
+        if (!MyLogger::readVarint(payload, offset, value) || value > payload.size() - offset)
+            return false;
+        text.append(payload, offset, static_cast<size_t>(value));
+        offset += static_cast<size_t>(value);
+        return true;
+    }
+    }
+
+    return false;
+}
+void MyLogger::encodeSignedArgument(std::string &payload, INT64 value)
+{
+    payload += static_cast<char>(LOG_BINARY_ARGUMENT_SIGNED);
+    MyLogger::appendVarint(payload, (static_cast<UINT64>(value) << 1) ^ static_cast<UINT64>(value >> 63)); // Zigzag encoding.
+}
+void MyLogger::encodeUnsignedArgument(std::string &payload, UINT64 value)
+{
+    payload += static_cast<char>(LOG_BINARY_ARGUMENT_UNSIGNED);
+    MyLogger::appendVarint(payload, value);
+}
+void MyLogger::encodeFloatArgument(std::string &payload, double value)
+{
+    payload += static_cast<char>(LOG_BINARY_ARGUMENT_FLOAT);
+    payload.append(reinterpret_cast<const char *>(&value), sizeof(value));
+}
+void MyLogger::encodeStringArgument(std::string &payload, std::string_view value)
+{
+    payload += static_cast<char>(LOG_BINARY_ARGUMENT_STRING);
+    MyLogger::appendVarint(payload, value.size());
+    payload.append(value.data(), value.size());
+}
+void MyLogger::appendVarint(std::string &buffer, UINT64 value)
+{
+    while (value >= 0x80)
+    {
+        buffer += static_cast<char>((value & 0x7F) | 0x80);
+        value >>= 7;
+    }
+    buffer += static_cast<char>(value);
+}
+bool MyLogger::readVarint(const std::string &buffer, size_t &offset, UINT64 &value)
+{
+    value = 0;
+    for (UINT shift = 0; shift < 64; shift += 7)
+    {
+        if (offset >= buffer.size())
+            return false;
+
+        UINT8 byte = static_cast<UINT8>(buffer[offset++]);
+        value |= static_cast<UINT64>(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+            return true;
+    }
+
+    return false;
+}
@@ -28,6 +28,10 @@ int WINAPI wWinMain(
         return -1;
     }
 
+    // Move the log writes off the calling threads, records are written in batches by a background flush thread.
+    if (!g_pApp->logger.startAsync())
+        g_pApp->logger.writeLog("Failed to start the asynchronous logger, falling back to synchronous logging.", "", MyLogType::Warn);
+
     if (!g_pApp->loadConfigurationFile())
     {
         g_pApp->logger.writeLog("Failed to load the application configuration file.", "", MyLogType::Error);
@@ -41,6 +45,8 @@ int WINAPI wWinMain(
     }
 
     {
+        MY_STARTUP_PHASE(g_pApp->startupTracer, "Application window");
+
         // Get the user desktop resolution to calculate the appropriate application window positions.
         INT desktop_width = 0, desktop_height = 0;
         if (!MyUtility::GetDesktopResolution(desktop_width, desktop_height))
@@ -48,7 +54,7 @@ int WINAPI wWinMain(
             g_pApp->logger.writeLog("Failed to retrieve the desktop resolution.", "", MyLogType::Error);
             return -1;
         }
-        g_pApp->logger.writeLog("Current desktop resolution:", ("'" + std::to_string(desktop_width) + "x" + std::to_string(desktop_height) + "'").c_str(), MyLogType::Debug);
+        MY_LOG(g_pApp->logger, MyLogType::Debug, "Current desktop resolution:", "'{}x{}'", desktop_width, desktop_height);
 
         // Create the application window.
         g_pApp->hWnd = CreateWindowExW(0,                       // No extended style.
@@ -73,6 +79,9 @@ int WINAPI wWinMain(
         return -1;
     }
 
+    // The first frame is drawn, the startup is complete.
+    g_pApp->finishStartupTrace();
+
     // Enter the message loop.
     MSG message = {0};
     while (GetMessageW(&message, NULL, 0, 0))
@@ -117,6 +126,28 @@ int WINAPI wWinMain(
         return -1;
     }
 
+    // Write the resource counters, the resources still alive after the uninitialization are potential leaks.
+    Deleter::writeResourceCounters(g_pApp->logger);
+
+    // Write the profiler trace and the latency summaries.
+    if (g_pApp->profiler.isEnabled())
+    {
+        g_pApp->profiler.setEnabled(false);
+        std::filesystem::path path(g_pApp->configurationFilePath);
+        std::wstring profile_file_path = path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + g_pApp->profileFileName.c_str();
+        if (g_pApp->profiler.exportChromeTrace(profile_file_path))
+            g_pApp->logger.writeLog("Profiler trace written:", "'" + MyUtility::ConvertWideStringToString(g_pApp->profileFileName) + "'", MyLogType::Info);
+        g_pApp->profiler.writeSummary(g_pApp->logger);
+    }
+
+    // Flush the pending log records and return to synchronous logging.
+    if (g_pApp->logger.isAsync())
+    {
+        if (!g_pApp->logger.stopAsync())
+            g_pApp->logger.writeLog("Timed out flushing the asynchronous logger.", "", MyLogType::Warn);
+        MY_LOG(g_pApp->logger, MyLogType::Debug, "Asynchronous logger statistics:", "'{} written, {} blocked, {} dropped, {} suppressed, {} log file rotation(s)'", g_pApp->logger.getTotalWrittenRecords(), g_pApp->logger.getTotalBlockedRecords(), g_pApp->logger.getTotalDroppedRecords(), g_pApp->logger.getTotalSuppressedRecords(), g_pApp->logger.getTotalRotations());
+    }
+
     // Write a log record indicating that the application has exited successfully.
     g_pApp->logger.writeLog("Finished exiting.", true);
 
@@ -133,13 +164,24 @@ int WINAPI wWinMain(
  */
 LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam)
 {
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(message, 0);
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, message, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     switch (message)
     {
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, 0, "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(g_pApp->pUIManager->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -154,7 +196,10 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
             }
 
             auto &p_rendertarget = *g_pApp->pUIManager->pRenderTarget;
-            hr = p_rendertarget->BindDC(hdc, &rect_window);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, 0, "WM_PAINT/BindDC");
+                hr = p_rendertarget->BindDC(hdc, &rect_window);
+            }
             if (FAILED(hr))
             {
                 error_message = "Failed to bind the render target to the window device context.";
@@ -163,7 +208,7 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
 
             D2D1_RECT_F d2d1_rect_window = D2D1::RectF(0, 0, static_cast<FLOAT>(rect_window.right), static_cast<FLOAT>(rect_window.bottom));
             D2D1_RECT_F d2d1_rect_caption = D2D1::RectF(static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.left), static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.top), static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.right), static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.bottom));
-            auto &d2d1_color_background = g_pApp->pUIManager->colors.background.getD2D1Color();
+            auto d2d1_color_background = g_pApp->pUIManager->colors.background.getD2D1Color();
             auto &p_d2d1_solidcolorbrush_caption = *g_pApp->pUIManager->pSolidColorBrushCaptionBackground;
             auto &p_d2d1_solidcolorbrush_border = (g_pApp->isWindowActive ? *g_pApp->pUIManager->pSolidColorBrushBorderActive : *g_pApp->pUIManager->pSolidColorBrushBorderInactive);
 
@@ -180,7 +225,10 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
                 g_pApp->pGraphic->d2d1Engine().drawRectangle(p_rendertarget, d2d1_rect_window, p_d2d1_solidcolorbrush_border);
             }
 
-            hr = p_rendertarget->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, 0, "WM_PAINT/EndDraw");
+                hr = p_rendertarget->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!g_pApp->pUIManager->createDeviceResources())
@@ -244,7 +292,7 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
 
                 D2D1_RECT_F d2d1_rect_window = D2D1::RectF(0, 0, static_cast<FLOAT>(rect_window.right), static_cast<FLOAT>(rect_window.bottom));
                 D2D1_RECT_F d2d1_rect_caption = D2D1::RectF(static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.left), static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.top), static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.right), static_cast<FLOAT>(g_pApp->pUIManager->miscs.rectCaption.bottom));
-                auto &d2d1_color_background = g_pApp->pUIManager->colors.background.getD2D1Color();
+                auto d2d1_color_background = g_pApp->pUIManager->colors.background.getD2D1Color();
                 auto &p_d2d1_solidcolorbrush_caption = *g_pApp->pUIManager->pSolidColorBrushCaptionBackground;
                 auto &p_d2d1_solidcolorbrush_border = (g_pApp->isWindowActive ? *g_pApp->pUIManager->pSolidColorBrushBorderActive : *g_pApp->pUIManager->pSolidColorBrushBorderInactive);
 
@@ -296,26 +344,26 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
     }
     case WM_CTLCOLORSTATIC:
     {
-        const HBRUSH *p_background_brush = nullptr;
+        HBRUSH background_brush = nullptr;
         HDC hdc = reinterpret_cast<HDC>(wParam);
         HWND window = reinterpret_cast<HWND>(lParam);
         // INT window_id = GetDlgCtrlID(window);
 
         if (MyStandardTextSubclass::getSubclassPointer(window))
         {
-            p_background_brush = &g_pApp->pUIManager->colors.nullBrush;
+            background_brush = g_pApp->pUIManager->colors.nullBrush;
         }
         else
         {
             // Default processing.
             SetBkColor(hdc, g_pApp->pUIManager->colors.background.getCOLORREF());
             SetTextColor(hdc, g_pApp->pUIManager->colors.textActive.getCOLORREF());
-            p_background_brush = &g_pApp->pUIManager->colors.background.getSolidBrush();
+            background_brush = g_pApp->pUIManager->colors.background.getSolidBrush();
         }
 
-        if (!p_background_brush)
+        if (!background_brush)
             break;
-        return reinterpret_cast<LRESULT>(*p_background_brush);
+        return reinterpret_cast<LRESULT>(background_brush);
     }
     case WM_CTLCOLORBTN:
     {
@@ -623,6 +671,9 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
         RedrawWindow(hWnd, NULL, NULL, RDW_INVALIDATE | RDW_UPDATENOW);
         SetWindowPos(hWnd, NULL, 0, 0, 0, 0, SWP_NOMOVE | SWP_NOSIZE | SWP_NOZORDER);
 
+        // Keep the performance HUD in the top-right corner.
+        g_pApp->updatePerformanceHudPosition();
+
         return 0;
     }
     case WM_WINDOWPOSCHANGING:
@@ -885,6 +936,80 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
 
             return 0;
         }
+        // Toggle the performance HUD.
+        case VK_F3:
+        {
+            // The configuration change shows or hides the HUD.
+            if (!g_pApp->updateConfigurationFile("PerformanceHud", (g_pApp->hPerformanceHudWindow ? "Off" : "On")))
+                g_pApp->logger.writeLog("Failed to update the settings file.", "[MESSAGE: 'WM_KEYUP/F3' | CALLBACK: 'ApplicationWindowProcedure()']", MyLogType::Error);
+
+            return 0;
+        }
+        }
+        break;
+    }
+    case WM_TIMER:
+    {
+        switch (wParam)
+        {
+        // Reload the theme file if it has changed.
+        case MyApp::IDT_THEME_FILE_WATCHER:
+        {
+            if (g_pApp->themeFileWatcher.hasChanged())
+            {
+                if (!g_pApp->reloadThemeFile())
+                    g_pApp->logger.writeLimitedLog("Failed to reload the theme file.", "[MESSAGE: 'WM_TIMER/IDT_THEME_FILE_WATCHER' | CALLBACK: 'ApplicationWindowProcedure()']", MyLogType::Error);
+            }
+
+            return 0;
+        }
+        // Reload the configuration file if it has changed.
+        case MyApp::IDT_CONFIGURATION_FILE_WATCHER:
+        {
+            if (g_pApp->configurationFileWatcher.hasChanged())
+            {
+                if (!g_pApp->reloadConfigurationFile())
+                    g_pApp->logger.writeLimitedLog("Failed to reload the configuration file.", "[MESSAGE: 'WM_TIMER/IDT_CONFIGURATION_FILE_WATCHER' | CALLBACK: 'ApplicationWindowProcedure()']", MyLogType::Error);
+            }
+
+            return 0;
+        }
+        // Advance the theme transition.
+        case MyApp::IDT_THEME_TRANSITION:
+        {
+            MY_PROFILE_SCOPE(g_pApp->profiler, 0, "WM_TIMER/IDT_THEME_TRANSITION");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, 0, "WM_TIMER/IDT_THEME_TRANSITION/Interval");
+            g_pApp->pUIManager->performanceHud.recordAnimationTick();
+
+            if (!g_pApp->stepThemeTransition())
+                g_pApp->logger.writeLimitedLog("Failed to advance the theme transition.", "[MESSAGE: 'WM_TIMER/IDT_THEME_TRANSITION' | CALLBACK: 'ApplicationWindowProcedure()']", MyLogType::Error);
+
+            return 0;
+        }
+        // Log the allocation rates since the previous report.
+        case MyApp::IDT_ALLOCATION_REPORT:
+        {
+            MyAllocationTracker::writeReport(g_pApp->logger);
+
+            return 0;
+        }
+        // Replay the next input replay frame.
+        case MyApp::IDT_INPUT_REPLAY:
+        {
+            if (!g_pApp->stepInputReplay())
+                g_pApp->logger.writeLimitedLog("Failed to replay the input replay frame.", "[MESSAGE: 'WM_TIMER/IDT_INPUT_REPLAY' | CALLBACK: 'ApplicationWindowProcedure()']", MyLogType::Error);
+
+            return 0;
+        }
+        // Sample the performance statistics and repaint the HUD.
+        case MyApp::IDT_PERFORMANCE_HUD:
+        {
+            g_pApp->pUIManager->performanceHud.sample();
+            if (g_pApp->hPerformanceHudWindow)
+                InvalidateRect(g_pApp->hPerformanceHudWindow, NULL, FALSE);
+
+            return 0;
+        }
         }
         break;
     }
@@ -918,13 +1043,21 @@ LRESULT CALLBACK ApplicationWindowProcedure(HWND hWnd, UINT message, WPARAM wPar
  */
 LRESULT CALLBACK DefaultContainerProcedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam, UINT_PTR idSubclass, DWORD_PTR refData)
 {
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(message, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, message, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     switch (message)
     {
     case WM_ERASEBKGND:
         return 1;
     case WM_CTLCOLORSTATIC:
     {
-        const HBRUSH *p_background_brush = nullptr;
+        HBRUSH background_brush = nullptr;
         HDC hdc = reinterpret_cast<HDC>(wParam);
         HWND window = reinterpret_cast<HWND>(lParam);
         // INT window_id = GetDlgCtrlID(window);
@@ -933,22 +1066,22 @@ LRESULT CALLBACK DefaultContainerProcedure(HWND hWnd, UINT message, WPARAM wPara
         {
             SetBkColor(hdc, g_pApp->pUIManager->colors.background.getCOLORREF());
             SetTextColor(hdc, g_pApp->pUIManager->colors.textInactive.getCOLORREF());
-            p_background_brush = &g_pApp->pUIManager->colors.background.getSolidBrush();
+            background_brush = g_pApp->pUIManager->colors.background.getSolidBrush();
         }
         else if (MyStandardTextSubclass::getSubclassPointer(window))
         {
-            p_background_brush = &g_pApp->pUIManager->colors.nullBrush;
+            background_brush = g_pApp->pUIManager->colors.nullBrush;
         }
         else
         {
             SetBkColor(hdc, g_pApp->pUIManager->colors.background.getCOLORREF());
             SetTextColor(hdc, g_pApp->pUIManager->colors.textActive.getCOLORREF());
-            p_background_brush = &g_pApp->pUIManager->colors.background.getSolidBrush();
+            background_brush = g_pApp->pUIManager->colors.background.getSolidBrush();
         }
 
-        if (!p_background_brush)
+        if (!background_brush)
             break;
-        return reinterpret_cast<LRESULT>(*p_background_brush);
+        return reinterpret_cast<LRESULT>(background_brush);
     }
     case WM_MEASUREITEM:
     {
@@ -1746,5 +1879,44 @@ LRESULT CALLBACK DefaultContainerProcedure(HWND hWnd, UINT message, WPARAM wPara
     }
     }
 
+    return DefSubclassProc(hWnd, message, wParam, lParam);
+}
+
+/**
+ * @brief Performance HUD window procedure.
+ * @param hWnd The handle to the window.
+ * @param message The message identifier.
+ * @param wParam The first message parameter.
+ * @param lParam The second message parameter.
+ * @param idSubclass The subclass id.
+ * @param refData The reference data.
+ * @return The result of the message processing.
+ */
+LRESULT CALLBACK PerformanceHudProcedure(HWND hWnd, UINT message, WPARAM wParam, LPARAM lParam, UINT_PTR idSubclass, DWORD_PTR refData)
+{
+    switch (message)
+    {
+    case WM_ERASEBKGND:
+        return 1;
+    case WM_PAINT:
+    {
+        PAINTSTRUCT ps;
+        HDC hdc = BeginPaint(hWnd, &ps);
+
+        RECT rect_window;
+        if (!GetClientRect(hWnd, &rect_window) || !g_pApp->pUIManager->performanceHud.draw(hdc, rect_window))
+            g_pApp->logger.writeLimitedLog("Failed to draw the performance HUD.", "[MESSAGE: 'WM_PAINT' | CALLBACK: 'PerformanceHudProcedure()']", MyLogType::Error);
+
+        EndPaint(hWnd, &ps);
+        return 0;
+    }
+    case WM_DESTROY:
+    {
+        if (!RemoveWindowSubclass(hWnd, &PerformanceHudProcedure, idSubclass))
+            g_pApp->logger.writeLog("Failed to remove the window subclass callback.", "[MESSAGE: 'WM_DESTROY' | FUNC: 'PerformanceHudProcedure()']", MyLogType::Error);
+        return 0;
+    }
+    }
+
     return DefSubclassProc(hWnd, message, wParam, lParam);
 }
\ No newline at end of file
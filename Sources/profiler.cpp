@@ -0,0 +1,233 @@
+/**
+ * @file profiler.cpp
+ * @brief Implementation of the user-defined types defined in profiler.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/************************************
+ * Profiler classes implementations *
+ ************************************/
+
+// [MyProfiler] class implementations:
+
+MyProfiler::MyProfiler()
+    : instanceId(++MyProfiler::totalInstances)
+{
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    this->counterFrequency = frequency.QuadPart;
+    this->baseTime = counter.QuadPart;
+}
+void MyProfiler::setEnabled(bool isEnabled)
+{
+    this->isRecording.store(isEnabled, std::memory_order_relaxed);
+}
+LONGLONG MyProfiler::getTime()
+{
+    LARGE_INTEGER counter;
+    QueryPerformanceCounter(&counter);
+    return counter.QuadPart;
+}
+void MyProfiler::recordSpan(UINT controlId, const char *name, LONGLONG startTime, LONGLONG endTime)
+{
+    MYPROFILETHREAD *p_thread = this->getThreadRecords();
+    AcquireSRWLockExclusive(&p_thread->lock);
+    this->addSpan(p_thread, {name, controlId, false, startTime, endTime});
+    ReleaseSRWLockExclusive(&p_thread->lock);
+}
+void MyProfiler::recordInterval(UINT controlId, const char *name)
+{
+    LONGLONG time = MyProfiler::getTime();
+    MYPROFILETHREAD *p_thread = this->getThreadRecords();
+    AcquireSRWLockExclusive(&p_thread->lock);
+    LONGLONG &last_tick_time = p_thread->lastTickTimes[{controlId, name}];
+    if (last_tick_time && (time - last_tick_time) * 1000 <= MyProfiler::maximumTickInterval * this->counterFrequency)
+        this->addSpan(p_thread, {name, controlId, true, last_tick_time, time});
+    last_tick_time = time;
+    ReleaseSRWLockExclusive(&p_thread->lock);
+}
+void MyProfiler::reset()
+{
+    AcquireSRWLockShared(&this->threadLock);
+    for (const auto &p_thread : this->threads)
+    {
+        AcquireSRWLockExclusive(&p_thread->lock);
+        p_thread->totalSpans = 0;
+        p_thread->histograms.clear();
+        p_thread->lastTickTimes.clear();
+        ReleaseSRWLockExclusive(&p_thread->lock);
+    }
+    ReleaseSRWLockShared(&this->threadLock);
+}
+bool MyProfiler::exportChromeTrace(const std::wstring &filePath)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        std::ofstream trace_file(filePath.c_str(), std::ios::binary | std::ios::trunc);
+        if (!trace_file.is_open())
+        {
+            error_message = "Failed to open the trace file.";
+            break;
+        }
+
+        // Every string written is a static span name or a number, the names are not escaped.
+        DWORD process_id = GetCurrentProcessId();
+        std::string events = "{\"traceEvents\":[\n";
+        events += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(process_id) + ",\"tid\":0,\"args\":{\"name\":\"Win32GUISample\"}}";
+        char event_buffer[256];
+        AcquireSRWLockShared(&this->threadLock);
+        for (const auto &p_thread : this->threads)
+        {
+            AcquireSRWLockShared(&p_thread->lock);
+            snprintf(event_buffer, sizeof(event_buffer), ",\n{\"name\":\"thread_name\",\"ph\":\"M\",\"pid\":%lu,\"tid\":%lu,\"args\":{\"name\":\"Thread %lu\"}}",
+                     process_id, p_thread->threadId, p_thread->threadId);
+            events += event_buffer;
+
+            // Oldest span first, the overwritten spans are skipped.
+            ULONGLONG first_span = (p_thread->totalSpans > MyProfiler::spansPerThread ? p_thread->totalSpans - MyProfiler::spansPerThread : 0);
+            for (ULONGLONG i = first_span; i < p_thread->totalSpans; i++)
+            {
+                const MYPROFILESPAN &span = p_thread->pSpans[static_cast<size_t>(i & (MyProfiler::spansPerThread - 1))];
+                if (span.isInterval)
+                    snprintf(event_buffer, sizeof(event_buffer), ",\n{\"name\":\"%s (%u)\",\"cat\":\"interval\",\"ph\":\"C\",\"ts\":%.3f,\"pid\":%lu,\"tid\":%lu,\"args\":{\"ms\":%.3f}}",
+                             span.name, span.controlId, this->toMicroseconds(span.endTime - this->baseTime), process_id, p_thread->threadId, this->toMicroseconds(span.endTime - span.startTime) / 1000.0);
+                else
+                    snprintf(event_buffer, sizeof(event_buffer), ",\n{\"name\":\"%s (%u)\",\"cat\":\"span\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%lu,\"tid\":%lu,\"args\":{\"controlId\":%u}}",
+                             span.name, span.controlId, this->toMicroseconds(span.startTime - this->baseTime), this->toMicroseconds(span.endTime - span.startTime), process_id, p_thread->threadId, span.controlId);
+                events += event_buffer;
+            }
+            ReleaseSRWLockShared(&p_thread->lock);
+        }
+        ReleaseSRWLockShared(&this->threadLock);
+        events += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+        trace_file.write(events.data(), static_cast<std::streamsize>(events.size()));
+        if (!trace_file.good())
+        {
+            error_message = "Failed to write the trace file.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyProfiler' | FUNC: 'exportChromeTrace()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+size_t MyProfiler::writeSummary(MyLogger &logger, size_t maximumRows)
+{
+    // Merge the histograms of every thread, the same span name may be a different string instance in each source file.
+    std::map<std::pair<UINT, std::string>, MYPROFILEHISTOGRAM> histograms;
+    AcquireSRWLockShared(&this->threadLock);
+    for (const auto &p_thread : this->threads)
+    {
+        AcquireSRWLockShared(&p_thread->lock);
+        for (const auto &[key, histogram] : p_thread->histograms)
+        {
+            auto [it, is_inserted] = histograms.try_emplace({key.first, key.second}, histogram);
+            if (is_inserted)
+                continue;
+
+            MYPROFILEHISTOGRAM &merged_histogram = it->second;
+            merged_histogram.totalSpans += histogram.totalSpans;
+            merged_histogram.totalTime += histogram.totalTime;
+            merged_histogram.maximumTime = (histogram.maximumTime > merged_histogram.maximumTime ? histogram.maximumTime : merged_histogram.maximumTime);
+            for (size_t i = 0; i < sizeof(histogram.buckets) / sizeof(histogram.buckets[0]); i++)
+                merged_histogram.buckets[i] += histogram.buckets[i];
+        }
+        ReleaseSRWLockShared(&p_thread->lock);
+    }
+    ReleaseSRWLockShared(&this->threadLock);
+
+    // The intervals are listed after the spans, the time between ticks is not time spent.
+    std::vector<const MYPROFILEHISTOGRAM *> sorted_histograms;
+    for (const auto &[key, histogram] : histograms)
+        sorted_histograms.push_back(&histogram);
+    std::sort(sorted_histograms.begin(), sorted_histograms.end(), [](const MYPROFILEHISTOGRAM *pLeft, const MYPROFILEHISTOGRAM *pRight)
+              { return (pLeft->isInterval != pRight->isInterval ? pRight->isInterval : pLeft->totalTime > pRight->totalTime); });
+    if (sorted_histograms.size() > maximumRows)
+        sorted_histograms.resize(maximumRows);
+
+    for (const MYPROFILEHISTOGRAM *p_histogram : sorted_histograms)
+    {
+        // The percentiles are the upper bounds of their buckets.
+        ULONGLONG percentile_bounds[2] = {0, 0};
+        const ULONGLONG percentile_ranks[2] = {(p_histogram->totalSpans + 1) / 2, p_histogram->totalSpans - p_histogram->totalSpans / 100};
+        for (size_t p = 0; p < 2; p++)
+        {
+            ULONGLONG total_counted_spans = 0;
+            for (size_t i = 0; i < sizeof(p_histogram->buckets) / sizeof(p_histogram->buckets[0]); i++)
+            {
+                total_counted_spans += p_histogram->buckets[i];
+                if (total_counted_spans >= percentile_ranks[p])
+                {
+                    percentile_bounds[p] = 1ULL << i;
+                    break;
+                }
+            }
+        }
+
+        MY_LOG(logger, MyLogType::Info, "Profiler summary:", "'{} ({}): {} span(s), {} ms total, mean {} us, p50 < {} us, p99 < {} us, max {} us'",
+               p_histogram->name, p_histogram->controlId, p_histogram->totalSpans, this->toMicroseconds(p_histogram->totalTime) / 1000.0,
+               this->toMicroseconds(p_histogram->totalTime) / static_cast<DOUBLE>(p_histogram->totalSpans), percentile_bounds[0], percentile_bounds[1],
+               this->toMicroseconds(p_histogram->maximumTime));
+    }
+
+    return sorted_histograms.size();
+}
+MYPROFILETHREAD *MyProfiler::getThreadRecords()
+{
+    // Cached per thread, tagged with the instance ID so that a profiler created at the address of a destroyed one is not confused with it.
+    thread_local UINT64 cached_instance_id = 0;
+    thread_local MYPROFILETHREAD *p_cached_thread = nullptr;
+    if (cached_instance_id == this->instanceId)
+        return p_cached_thread;
+
+    std::unique_ptr<MYPROFILETHREAD> p_thread(new MYPROFILETHREAD{GetCurrentThreadId(), SRWLOCK_INIT, std::unique_ptr<MYPROFILESPAN[]>(new MYPROFILESPAN[MyProfiler::spansPerThread]), 0, {}, {}});
+    p_cached_thread = p_thread.get();
+    cached_instance_id = this->instanceId;
+    AcquireSRWLockExclusive(&this->threadLock);
+    this->threads.push_back(std::move(p_thread));
+    ReleaseSRWLockExclusive(&this->threadLock);
+
+    return p_cached_thread;
+}
+void MyProfiler::addSpan(MYPROFILETHREAD *pThread, const MYPROFILESPAN &span)
+{
+    pThread->pSpans[static_cast<size_t>(pThread->totalSpans & (MyProfiler::spansPerThread - 1))] = span;
+    pThread->totalSpans++;
+
+    LONGLONG time = span.endTime - span.startTime;
+    auto [it, is_inserted] = pThread->histograms.try_emplace({span.controlId, span.name});
+    MYPROFILEHISTOGRAM &histogram = it->second;
+    if (is_inserted)
+    {
+        histogram.name = span.name;
+        histogram.controlId = span.controlId;
+        histogram.isInterval = span.isInterval;
+    }
+    histogram.totalSpans++;
+    histogram.totalTime += time;
+    histogram.maximumTime = (time > histogram.maximumTime ? time : histogram.maximumTime);
+
+    // Bucket N holds [2^(N-1), 2^N) microseconds, the number of significant bits of the time in microseconds.
+    ULONGLONG microseconds = static_cast<ULONGLONG>(this->toMicroseconds(time > 0 ? time : 0));
+    size_t bucket = 0;
+    while (microseconds && bucket < sizeof(histogram.buckets) / sizeof(histogram.buckets[0]) - 1)
+    {
+        microseconds >>= 1;
+        bucket++;
+    }
+    histogram.buckets[bucket]++;
+}
+DOUBLE MyProfiler::toMicroseconds(LONGLONG ticks) const
+{
+    return static_cast<DOUBLE>(ticks) * 1000000.0 / static_cast<DOUBLE>(this->counterFrequency);
+}
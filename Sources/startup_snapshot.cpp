@@ -0,0 +1,216 @@
+/**
+ * @file startup_snapshot.cpp
+ * @brief Implementation of the user-defined types defined in startup_snapshot.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/********************************************
+ * Startup snapshot classes implementations *
+ ********************************************/
+
+// [MyStartupSnapshot] class implementations:
+
+MyStartupSnapshot::MyStartupSnapshot() {}
+MyStartupSnapshot::~MyStartupSnapshot()
+{
+    this->close();
+}
+UINT64 MyStartupSnapshot::getValidationStamp()
+{
+    WCHAR module_path[MAX_PATH];
+    DWORD module_path_length = GetModuleFileNameW(NULL, module_path, MAX_PATH);
+    if (!module_path_length || module_path_length >= MAX_PATH)
+        return 0;
+
+    WIN32_FILE_ATTRIBUTE_DATA attributes;
+    if (!GetFileAttributesExW(module_path, GetFileExInfoStandard, &attributes))
+        return 0;
+
+    UINT64 last_write_time = (static_cast<UINT64>(attributes.ftLastWriteTime.dwHighDateTime) << 32) | attributes.ftLastWriteTime.dwLowDateTime;
+    UINT64 file_size = (static_cast<UINT64>(attributes.nFileSizeHigh) << 32) | attributes.nFileSizeLow;
+    return last_write_time ^ (file_size * 0x9E3779B97F4A7C15ULL);
+}
+bool MyStartupSnapshot::open(const std::wstring &filePath, UINT64 validationStamp)
+{
+    this->close();
+
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        this->hFile = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (this->hFile == INVALID_HANDLE_VALUE)
+        {
+            error_message = "The snapshot file does not exist.";
+            break;
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(this->hFile, &file_size) || file_size.QuadPart < static_cast<LONGLONG>(sizeof(MYSTARTUPSNAPSHOTHEADER)))
+        {
+            error_message = "The snapshot file size is invalid.";
+            break;
+        }
+
+        this->hFileMapping = CreateFileMappingW(this->hFile, NULL, PAGE_READONLY, 0, 0, NULL);
+        if (!this->hFileMapping)
+        {
+            error_message = "Failed to create the snapshot file mapping.";
+            break;
+        }
+        this->pView = static_cast<const BYTE *>(MapViewOfFile(this->hFileMapping, FILE_MAP_READ, 0, 0, 0));
+        if (!this->pView)
+        {
+            error_message = "Failed to map the snapshot file.";
+            break;
+        }
+
+        const MYSTARTUPSNAPSHOTHEADER *p_header = reinterpret_cast<const MYSTARTUPSNAPSHOTHEADER *>(this->pView);
+        if (p_header->signature != STARTUP_SNAPSHOT_SIGNATURE || p_header->version != STARTUP_SNAPSHOT_VERSION)
+        {
+            error_message = "The file is not a supported snapshot file.";
+            break;
+        }
+        if (!validationStamp || p_header->validationStamp != validationStamp)
+        {
+            error_message = "The snapshot file is stale.";
+            break;
+        }
+
+        // Validate every entry once, `find()` reads them without checks.
+        UINT64 view_size = static_cast<UINT64>(file_size.QuadPart);
+        if (p_header->totalEntries > (view_size - sizeof(MYSTARTUPSNAPSHOTHEADER)) / sizeof(MYSTARTUPSNAPSHOTENTRY))
+        {
+            error_message = "The snapshot file entry count is invalid.";
+            break;
+        }
+        const MYSTARTUPSNAPSHOTENTRY *p_entries = reinterpret_cast<const MYSTARTUPSNAPSHOTENTRY *>(this->pView + sizeof(MYSTARTUPSNAPSHOTHEADER));
+        bool are_entries_valid = true;
+        for (UINT i = 0; i < p_header->totalEntries && are_entries_valid; ++i)
+        {
+            are_entries_valid = (p_entries[i].offset <= view_size && p_entries[i].size <= view_size - p_entries[i].offset &&
+                                 (!i || p_entries[i - 1].key < p_entries[i].key));
+        }
+        if (!are_entries_valid)
+        {
+            error_message = "The snapshot file entries are invalid.";
+            break;
+        }
+
+        this->pEntries = p_entries;
+        this->totalEntries = p_header->totalEntries;
+        this->totalHits.store(0, std::memory_order_relaxed);
+
+        are_all_operation_success = true;
+    }
+
+    // A missing or stale snapshot is expected, it is rewritten on exit.
+    if (!are_all_operation_success)
+    {
+        this->close();
+        MY_LOG(g_pApp->logger, MyLogType::Debug, "Startup snapshot rejected:", "'{}'", error_message);
+    }
+
+    return are_all_operation_success;
+}
+void MyStartupSnapshot::close()
+{
+    if (this->pView)
+        UnmapViewOfFile(this->pView);
+    if (this->hFileMapping)
+        CloseHandle(this->hFileMapping);
+    if (this->hFile != INVALID_HANDLE_VALUE)
+        CloseHandle(this->hFile);
+
+    this->hFile = INVALID_HANDLE_VALUE;
+    this->hFileMapping = nullptr;
+    this->pView = nullptr;
+    this->pEntries = nullptr;
+    this->totalEntries = 0;
+}
+bool MyStartupSnapshot::find(UINT64 key, const BYTE *&pData, size_t &dataSize)
+{
+    if (!this->pView)
+        return false;
+
+    const MYSTARTUPSNAPSHOTENTRY *p_entries_end = this->pEntries + this->totalEntries;
+    const MYSTARTUPSNAPSHOTENTRY *p_entry = std::lower_bound(this->pEntries, p_entries_end, key, [](const MYSTARTUPSNAPSHOTENTRY &entry, UINT64 key)
+                                                             { return entry.key < key; });
+    if (p_entry == p_entries_end || p_entry->key != key)
+        return false;
+
+    pData = this->pView + p_entry->offset;
+    dataSize = static_cast<size_t>(p_entry->size);
+    this->totalHits.fetch_add(1, std::memory_order_relaxed);
+    return true;
+}
+void MyStartupSnapshot::addEntry(UINT64 key, std::string data)
+{
+    this->addedEntries[key] = std::move(data);
+}
+UINT MyStartupSnapshot::addMappedEntries()
+{
+    if (!this->pView)
+        return 0;
+
+    UINT total_added_entries = 0;
+    for (UINT i = 0; i < this->totalEntries; i++)
+    {
+        const MYSTARTUPSNAPSHOTENTRY &entry = this->pEntries[i];
+        if (this->addedEntries.emplace(entry.key, std::string(reinterpret_cast<const char *>(this->pView + entry.offset), static_cast<size_t>(entry.size))).second)
+            total_added_entries++;
+    }
+
+    return total_added_entries;
+}
+bool MyStartupSnapshot::write(const std::wstring &filePath, UINT64 validationStamp)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (!validationStamp)
+        {
+            error_message = "The validation stamp is invalid.";
+            break;
+        }
+
+        std::ofstream snapshot_file(filePath.c_str(), std::ios::binary | std::ios::trunc);
+        if (!snapshot_file.is_open())
+        {
+            error_message = "Failed to open the snapshot file.";
+            break;
+        }
+
+        MYSTARTUPSNAPSHOTHEADER header = {STARTUP_SNAPSHOT_SIGNATURE, STARTUP_SNAPSHOT_VERSION, validationStamp, static_cast<UINT32>(this->addedEntries.size()), 0};
+        std::vector<MYSTARTUPSNAPSHOTENTRY> entries;
+        entries.reserve(this->addedEntries.size());
+        UINT64 data_offset = sizeof(MYSTARTUPSNAPSHOTHEADER) + this->addedEntries.size() * sizeof(MYSTARTUPSNAPSHOTENTRY);
+        for (const auto &[key, data] : this->addedEntries)
+        {
+            entries.push_back({key, data_offset, data.size()});
+            data_offset += data.size();
+        }
+
+        snapshot_file.write(reinterpret_cast<const char *>(&header), sizeof(MYSTARTUPSNAPSHOTHEADER));
+        snapshot_file.write(reinterpret_cast<const char *>(entries.data()), static_cast<std::streamsize>(entries.size() * sizeof(MYSTARTUPSNAPSHOTENTRY)));
+        for (const auto &[key, data] : this->addedEntries)
+            snapshot_file.write(data.data(), static_cast<std::streamsize>(data.size()));
+        if (!snapshot_file.good())
+        {
+            error_message = "Failed to write the snapshot file.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    this->addedEntries.clear();
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyStartupSnapshot' | FUNC: 'write()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
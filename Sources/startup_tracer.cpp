@@ -0,0 +1,155 @@
+/**
+ * @file startup_tracer.cpp
+ * @brief Implementation of the user-defined types defined in startup_tracer.h.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+
+/******************************************
+ * Startup tracer classes implementations *
+ ******************************************/
+
+// [MyStartupTracer] class implementations:
+
+MyStartupTracer::MyStartupTracer()
+{
+    LARGE_INTEGER frequency, counter;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&counter);
+    this->counterFrequency = frequency.QuadPart;
+    this->baseTime = counter.QuadPart;
+}
+size_t MyStartupTracer::beginPhase(const char *name)
+{
+    if (!this->isActive.load(std::memory_order_relaxed))
+        return MyStartupTracer::invalidPhase;
+
+    MYSTARTUPPHASE phase = {name, MyStartupTracer::threadDepth++, GetCurrentThreadId(), MyProfiler::getTime(), 0};
+    AcquireSRWLockExclusive(&this->lock);
+    size_t phase_index = this->phases.size();
+    this->phases.push_back(phase);
+    ReleaseSRWLockExclusive(&this->lock);
+
+    return phase_index;
+}
+void MyStartupTracer::endPhase(size_t phaseIndex)
+{
+    LONGLONG end_time = MyProfiler::getTime();
+    MyStartupTracer::threadDepth--;
+
+    AcquireSRWLockExclusive(&this->lock);
+    if (phaseIndex < this->phases.size())
+        this->phases[phaseIndex].endTime = end_time;
+    ReleaseSRWLockExclusive(&this->lock);
+}
+DOUBLE MyStartupTracer::finish()
+{
+    if (this->isActive.exchange(false, std::memory_order_relaxed))
+        this->finishTime = MyProfiler::getTime();
+
+    return this->toMilliseconds(this->finishTime - this->baseTime);
+}
+std::string MyStartupTracer::formatSummary()
+{
+    std::string summary = "";
+    std::map<std::string, std::pair<UINT, LONGLONG>> other_thread_phases;
+    DWORD thread_id = GetCurrentThreadId();
+    UINT previous_depth = 0;
+    char phase_buffer[160];
+
+    // The phases still running are skipped.
+    AcquireSRWLockShared(&this->lock);
+    for (const MYSTARTUPPHASE &phase : this->phases)
+    {
+        if (!phase.endTime)
+            continue;
+        if (phase.threadId != thread_id)
+        {
+            auto &[total_phases, total_time] = other_thread_phases[phase.name];
+            total_phases++;
+            total_time += phase.endTime - phase.startTime;
+            continue;
+        }
+
+        if (!summary.empty())
+        {
+            if (phase.depth > previous_depth)
+                summary += " (";
+            else
+            {
+                summary.append(previous_depth - phase.depth, ')');
+                summary += ", ";
+            }
+        }
+        snprintf(phase_buffer, sizeof(phase_buffer), "%s %.2f ms", phase.name, this->toMilliseconds(phase.endTime - phase.startTime));
+        summary += phase_buffer;
+        previous_depth = phase.depth;
+    }
+    ReleaseSRWLockShared(&this->lock);
+    summary.append(previous_depth, ')');
+
+    for (const auto &[name, totals] : other_thread_phases)
+    {
+        snprintf(phase_buffer, sizeof(phase_buffer), "%s%s x%u %.2f ms", (summary.empty() ? "" : " | "), name.c_str(), totals.first, this->toMilliseconds(totals.second));
+        summary += phase_buffer;
+    }
+
+    return summary;
+}
+bool MyStartupTracer::exportChromeTrace(const std::wstring &filePath)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        std::ofstream trace_file(filePath.c_str(), std::ios::binary | std::ios::trunc);
+        if (!trace_file.is_open())
+        {
+            error_message = "Failed to open the trace file.";
+            break;
+        }
+
+        // Every string written is a static phase name or a number, the names are not escaped.
+        DWORD process_id = GetCurrentProcessId();
+        std::string events = "{\"traceEvents\":[\n";
+        events += "{\"name\":\"process_name\",\"ph\":\"M\",\"pid\":" + std::to_string(process_id) + ",\"tid\":0,\"args\":{\"name\":\"Win32GUISample startup\"}}";
+        char event_buffer[256];
+        AcquireSRWLockShared(&this->lock);
+        for (const MYSTARTUPPHASE &phase : this->phases)
+        {
+            if (!phase.endTime)
+                continue;
+
+            snprintf(event_buffer, sizeof(event_buffer), ",\n{\"name\":\"%s\",\"cat\":\"startup\",\"ph\":\"X\",\"ts\":%.3f,\"dur\":%.3f,\"pid\":%lu,\"tid\":%lu,\"args\":{\"depth\":%u}}",
+                     phase.name, this->toMilliseconds(phase.startTime - this->baseTime) * 1000.0, this->toMilliseconds(phase.endTime - phase.startTime) * 1000.0, process_id, phase.threadId, phase.depth);
+            events += event_buffer;
+        }
+        ReleaseSRWLockShared(&this->lock);
+        if (this->finishTime)
+        {
+            snprintf(event_buffer, sizeof(event_buffer), ",\n{\"name\":\"Finished\",\"cat\":\"startup\",\"ph\":\"i\",\"s\":\"g\",\"ts\":%.3f,\"pid\":%lu,\"tid\":0}",
+                     this->toMilliseconds(this->finishTime - this->baseTime) * 1000.0, process_id);
+            events += event_buffer;
+        }
+        events += "\n],\"displayTimeUnit\":\"ms\"}\n";
+
+        trace_file.write(events.data(), static_cast<std::streamsize>(events.size()));
+        if (!trace_file.good())
+        {
+            error_message = "Failed to write the trace file.";
+            break;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyStartupTracer' | FUNC: 'exportChromeTrace()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+DOUBLE MyStartupTracer::toMilliseconds(LONGLONG ticks) const
+{
+    return static_cast<DOUBLE>(ticks) * 1000.0 / static_cast<DOUBLE>(this->counterFrequency);
+}
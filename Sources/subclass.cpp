@@ -160,7 +160,7 @@ UIManager *MySubclass::objects()
 
 // [MyStandardButtonSubclass] class implementations:
 
-bool MyStandardButtonSubclass::refresh()
+bool MyStandardButtonSubclass::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -173,8 +173,8 @@ bool MyStandardButtonSubclass::refresh()
             break;
         }
 
-        // Create the device resources.
-        if (!this->createDeviceResources())
+        // Create the device resources, unless only the colors are updated.
+        if (!isColorOnly && !this->createDeviceResources())
         {
             error_message = "Failed to create the device resources.";
             break;
@@ -441,7 +441,7 @@ bool MyStandardButtonSubclass::startAnimation(ButtonAnimationState animationStat
     while (!are_all_operation_success)
     {
         // Create the storyboard.
-        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -455,31 +455,31 @@ bool MyStandardButtonSubclass::startAnimation(ButtonAnimationState animationStat
         case ButtonAnimationState::Default:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonDefault.getRed(), 0.5, 0.5, &*p_transition_button_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonDefault.getGreen(), 0.5, 0.5, &*p_transition_button_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonDefault.getBlue(), 0.5, 0.5, &*p_transition_button_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonBorderDefault.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonBorderDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonBorderDefault.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonBorderDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonBorderDefault.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.standardButtonBorderDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -521,31 +521,31 @@ bool MyStandardButtonSubclass::startAnimation(ButtonAnimationState animationStat
         case ButtonAnimationState::Hover:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonHover.getRed(), 0.5, 0.5, &*p_transition_button_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonHover.getGreen(), 0.5, 0.5, &*p_transition_button_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonHover.getBlue(), 0.5, 0.5, &*p_transition_button_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonBorderHover.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonBorderHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonBorderHover.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonBorderHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonBorderHover.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.standardButtonBorderHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -587,31 +587,31 @@ bool MyStandardButtonSubclass::startAnimation(ButtonAnimationState animationStat
         case ButtonAnimationState::Active:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonActive.getRed(), 0.5, 0.5, &*p_transition_button_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonActive.getGreen(), 0.5, 0.5, &*p_transition_button_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonActive.getBlue(), 0.5, 0.5, &*p_transition_button_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonBorderActive.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonBorderActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonBorderActive.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonBorderActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonBorderActive.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.standardButtonBorderActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.7, 0, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.7, 0, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -653,7 +653,7 @@ bool MyStandardButtonSubclass::startAnimation(ButtonAnimationState animationStat
         case ButtonAnimationState::Focus:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -668,7 +668,7 @@ bool MyStandardButtonSubclass::startAnimation(ButtonAnimationState animationStat
         case ButtonAnimationState::FocusLost:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -728,6 +728,14 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyStandardButtonSubclass *p_this = reinterpret_cast<MyStandardButtonSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -738,9 +746,12 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
     // Override paint messages.
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(p_this->objects()->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -789,7 +800,10 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
             }
 
             // Bind the render target to the window device context.
-            hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/BindDC");
+                hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            }
             if (FAILED(hr))
             {
                 error_message = "[WM_PAINT] Failed to bind the render target to the window device context.";
@@ -809,16 +823,16 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
             std::unique_ptr<ID2D1SolidColorBrush *, ID2D1SolidColorBrushDeleter> p_d2d1_solidcolorbrush_button_text(new ID2D1SolidColorBrush *(nullptr));
             {
                 error_message = "[WM_PAINT] Failed to create the resources.";
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, &*p_d2d1_solidcolorbrush_focus_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, Deleter::track(p_d2d1_solidcolorbrush_focus_border));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button, &*p_d2d1_solidcolorbrush_button);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button, Deleter::track(p_d2d1_solidcolorbrush_button));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button_border, &*p_d2d1_solidcolorbrush_button_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button_border, Deleter::track(p_d2d1_solidcolorbrush_button_border));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button_text, &*p_d2d1_solidcolorbrush_button_text);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button_text, Deleter::track(p_d2d1_solidcolorbrush_button_text));
                 if (FAILED(hr))
                     break;
                 error_message = "";
@@ -845,7 +859,10 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
             }
 
             // End drawing.
-            hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/EndDraw");
+                hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!p_this->createDeviceResources(true))
@@ -871,7 +888,7 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
         }
 
         if (!are_all_operation_success)
-            g_pApp->logger.writeLog(error_message, "[CLASS: 'MyStandardButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyStandardButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
         EndPaint(hWnd, &ps);
         return 0;
@@ -884,6 +901,10 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
         {
         case MyStandardButtonSubclass::IDT_ANIMATION_INVALIDATE:
         {
+            MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+            p_this->objects()->performanceHud.recordAnimationTick();
+
             HRESULT hr;
             bool are_all_operation_success = false;
             std::string error_message = "";
@@ -932,9 +953,9 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
             {
                 // Kill the timer if an error occurs.
                 if (!KillTimer(hWnd, MyStandardButtonSubclass::IDT_ANIMATION_INVALIDATE))
-                    g_pApp->logger.writeLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                    g_pApp->logger.writeLimitedLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
-                g_pApp->logger.writeLog(error_message, "[CLASS: 'MyStandardButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyStandardButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             }
 
             return 0;
@@ -942,7 +963,7 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
 
         default:
         {
-            g_pApp->logger.writeLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             break;
         }
         }
@@ -1133,7 +1154,7 @@ LRESULT CALLBACK MyStandardButtonSubclass::subclassProcedure(HWND hWnd, UINT uMs
 
 // [MyImageButtonSubclass] class implementations:
 
-bool MyImageButtonSubclass::refresh()
+bool MyImageButtonSubclass::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -1146,8 +1167,8 @@ bool MyImageButtonSubclass::refresh()
             break;
         }
 
-        // Create the device resources.
-        if (!this->createDeviceResources())
+        // Create the device resources, unless only the colors are updated.
+        if (!isColorOnly && !this->createDeviceResources())
         {
             error_message = "Failed to create the device resources.";
             break;
@@ -1353,16 +1374,10 @@ bool MyImageButtonSubclass::createDeviceResources(bool recreateSharedResources)
         this->pD2D1BitmapDefaultImage.reset(new ID2D1Bitmap *(nullptr));
         this->pD2D1BitmapHoverImage.reset(new ID2D1Bitmap *(nullptr));
         this->pD2D1BitmapActiveImage.reset(new ID2D1Bitmap *(nullptr));
-        hr = (*this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(this->imageConfig.pImageDefault->getBitmapSource(), &*this->pD2D1BitmapDefaultImage);
-        if (FAILED(hr))
-            break;
-        hr = (*this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(this->imageConfig.pImageHover->getBitmapSource(), &*this->pD2D1BitmapHoverImage);
+        hr = (*this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(this->imageConfig.pImageDefault->getBitmapSource(), Deleter::track(this->pD2D1BitmapDefaultImage));
         if (FAILED(hr))
             break;
-        hr = (*this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(this->imageConfig.pImageActive->getBitmapSource(), &*this->pD2D1BitmapActiveImage);
-        if (FAILED(hr))
-            break;
-        error_message = "";
+        error_message = ""; // The hover and active state image bitmaps are created on first draw.
 
         if (!ReleaseDC(this->buttonWindow, hdc))
         {
@@ -1396,7 +1411,7 @@ bool MyImageButtonSubclass::startAnimation(ButtonAnimationState animationState)
     while (!are_all_operation_success)
     {
         // Create the storyboard.
-        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -1410,22 +1425,22 @@ bool MyImageButtonSubclass::startAnimation(ButtonAnimationState animationState)
         case ButtonAnimationState::Default:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->imageConfig.pColorBackgroundDefault->getRed(), 0.5, 0.5, &*p_transition_background_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->imageConfig.pColorBackgroundDefault->getRed(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->imageConfig.pColorBackgroundDefault->getGreen(), 0.5, 0.5, &*p_transition_background_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->imageConfig.pColorBackgroundDefault->getGreen(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->imageConfig.pColorBackgroundDefault->getBlue(), 0.5, 0.5, &*p_transition_background_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->imageConfig.pColorBackgroundDefault->getBlue(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, 1.0, 0.5, 0.5, &*p_transition_default_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, 1.0, 0.5, 0.5, Deleter::track(p_transition_default_icon_opacity));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_hover_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_hover_icon_opacity));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_down_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_down_icon_opacity));
             if (FAILED(hr))
                 break;
 
@@ -1458,22 +1473,22 @@ bool MyImageButtonSubclass::startAnimation(ButtonAnimationState animationState)
         case ButtonAnimationState::Hover:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->imageConfig.pColorBackgroundHover->getRed(), 0.5, 0.5, &*p_transition_background_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->imageConfig.pColorBackgroundHover->getRed(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->imageConfig.pColorBackgroundHover->getGreen(), 0.5, 0.5, &*p_transition_background_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->imageConfig.pColorBackgroundHover->getGreen(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->imageConfig.pColorBackgroundHover->getBlue(), 0.5, 0.5, &*p_transition_background_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->imageConfig.pColorBackgroundHover->getBlue(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_default_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_default_icon_opacity));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, 1.0, 0.5, 0.5, &*p_transition_hover_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, 1.0, 0.5, 0.5, Deleter::track(p_transition_hover_icon_opacity));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_down_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_down_icon_opacity));
             if (FAILED(hr))
                 break;
 
@@ -1506,22 +1521,22 @@ bool MyImageButtonSubclass::startAnimation(ButtonAnimationState animationState)
         case ButtonAnimationState::Active:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->imageConfig.pColorBackgroundActive->getRed(), 0.5, 0.5, &*p_transition_background_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->imageConfig.pColorBackgroundActive->getRed(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->imageConfig.pColorBackgroundActive->getGreen(), 0.5, 0.5, &*p_transition_background_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->imageConfig.pColorBackgroundActive->getGreen(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->imageConfig.pColorBackgroundActive->getBlue(), 0.5, 0.5, &*p_transition_background_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->imageConfig.pColorBackgroundActive->getBlue(), 0.5, 0.5, Deleter::track(p_transition_background_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_default_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_default_icon_opacity));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_hover_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_hover_icon_opacity));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, 1.0, 0.5, 0.5, &*p_transition_down_icon_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, 1.0, 0.5, 0.5, Deleter::track(p_transition_down_icon_opacity));
             if (FAILED(hr))
                 break;
 
@@ -1554,7 +1569,7 @@ bool MyImageButtonSubclass::startAnimation(ButtonAnimationState animationState)
         case ButtonAnimationState::Focus:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -1569,7 +1584,7 @@ bool MyImageButtonSubclass::startAnimation(ButtonAnimationState animationState)
         case ButtonAnimationState::FocusLost:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -1629,6 +1644,14 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyImageButtonSubclass *p_this = reinterpret_cast<MyImageButtonSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -1639,9 +1662,12 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
     // Override paint messages.
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(p_this->objects()->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -1681,7 +1707,10 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             }
 
             // Bind the render target to the window device context.
-            hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/BindDC");
+                hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            }
             if (FAILED(hr))
             {
                 error_message = "[WM_PAINT] Failed to bind the render target to the window device context.";
@@ -1699,9 +1728,23 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             ID2D1Bitmap *&p_d2d1_bitmap_down_image = *p_this->pD2D1BitmapActiveImage;
             {
                 error_message = "[WM_PAINT] Failed to create the resources.";
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, &*p_d2d1_solidcolorbrush_focus_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, Deleter::track(p_d2d1_solidcolorbrush_focus_border));
                 if (FAILED(hr))
                     break;
+
+                // Create the hover and active state image bitmaps on first draw, the images of the states never shown are never decoded.
+                if (!p_this->config.skipHoverAnimationState && hover_image_opacity && !p_d2d1_bitmap_hover_image)
+                {
+                    hr = (*p_this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(p_this->imageConfig.pImageHover->getBitmapSource(), Deleter::track(p_this->pD2D1BitmapHoverImage));
+                    if (FAILED(hr))
+                        break;
+                }
+                if (!p_this->config.skipActiveAnimationState && active_image_opacity && !p_d2d1_bitmap_down_image)
+                {
+                    hr = (*p_this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(p_this->imageConfig.pImageActive->getBitmapSource(), Deleter::track(p_this->pD2D1BitmapActiveImage));
+                    if (FAILED(hr))
+                        break;
+                }
                 error_message = "";
             }
 
@@ -1736,7 +1779,10 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             }
 
             // End drawing.
-            hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/EndDraw");
+                hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!p_this->createDeviceResources(true))
@@ -1762,7 +1808,7 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
         }
 
         if (!are_all_operation_success)
-            g_pApp->logger.writeLog(error_message, "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
         EndPaint(hWnd, &ps);
         return 0;
@@ -1775,6 +1821,10 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
         {
         case MyImageButtonSubclass::IDT_ANIMATION_INVALIDATE:
         {
+            MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+            p_this->objects()->performanceHud.recordAnimationTick();
+
             HRESULT hr;
             bool are_all_operation_success = false;
             std::string error_message = "";
@@ -1823,9 +1873,9 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             {
                 // Kill the timer if an error occurs.
                 if (!KillTimer(hWnd, MyImageButtonSubclass::IDT_ANIMATION_INVALIDATE))
-                    g_pApp->logger.writeLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                    g_pApp->logger.writeLimitedLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
-                g_pApp->logger.writeLog(error_message, "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             }
 
             return 0;
@@ -1833,7 +1883,7 @@ LRESULT CALLBACK MyImageButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
 
         default:
         {
-            g_pApp->logger.writeLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             break;
         }
         }
@@ -2045,7 +2095,7 @@ void MyRadioButtonSubclass::updateSelectionState(bool state)
         this->isSelected = true;
     }
 }
-bool MyRadioButtonSubclass::refresh()
+bool MyRadioButtonSubclass::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -2058,8 +2108,8 @@ bool MyRadioButtonSubclass::refresh()
             break;
         }
 
-        // Create the device resources.
-        if (!this->createDeviceResources())
+        // Create the device resources, unless only the colors are updated.
+        if (!isColorOnly && !this->createDeviceResources())
         {
             error_message = "Failed to create the device resources.";
             break;
@@ -2347,7 +2397,7 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
     while (!are_all_operation_success)
     {
         // Create the storyboard.
-        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -2361,40 +2411,40 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::Default:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonPrimaryDefault.getRed(), 0.5, 0.5, &*p_transition_button_primary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonPrimaryDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonPrimaryDefault.getGreen(), 0.5, 0.5, &*p_transition_button_primary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonPrimaryDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonPrimaryDefault.getBlue(), 0.5, 0.5, &*p_transition_button_primary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonPrimaryDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonSecondaryDefault.getRed(), 0.5, 0.5, &*p_transition_button_secondary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonSecondaryDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonSecondaryDefault.getGreen(), 0.5, 0.5, &*p_transition_button_secondary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonSecondaryDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonSecondaryDefault.getBlue(), 0.5, 0.5, &*p_transition_button_secondary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonSecondaryDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonBorderDefault.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonBorderDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonBorderDefault.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonBorderDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonBorderDefault.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.radioButtonBorderDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -2445,40 +2495,40 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::Hover:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonPrimaryHover.getRed(), 0.5, 0.5, &*p_transition_button_primary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonPrimaryHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonPrimaryHover.getGreen(), 0.5, 0.5, &*p_transition_button_primary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonPrimaryHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonPrimaryHover.getBlue(), 0.5, 0.5, &*p_transition_button_primary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonPrimaryHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonSecondaryHover.getRed(), 0.5, 0.5, &*p_transition_button_secondary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonSecondaryHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonSecondaryHover.getGreen(), 0.5, 0.5, &*p_transition_button_secondary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonSecondaryHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonSecondaryHover.getBlue(), 0.5, 0.5, &*p_transition_button_secondary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonSecondaryHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonBorderHover.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonBorderHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonBorderHover.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonBorderHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonBorderHover.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.radioButtonBorderHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -2529,40 +2579,40 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::Down:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonPrimaryActive.getRed(), 0.5, 0.5, &*p_transition_button_primary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonPrimaryActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonPrimaryActive.getGreen(), 0.5, 0.5, &*p_transition_button_primary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonPrimaryActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonPrimaryActive.getBlue(), 0.5, 0.5, &*p_transition_button_primary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonPrimaryActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonSecondaryActive.getRed(), 0.5, 0.5, &*p_transition_button_secondary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonSecondaryActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonSecondaryActive.getGreen(), 0.5, 0.5, &*p_transition_button_secondary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonSecondaryActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonSecondaryActive.getBlue(), 0.5, 0.5, &*p_transition_button_secondary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonSecondaryActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonBorderActive.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonBorderActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonBorderActive.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonBorderActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonBorderActive.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.radioButtonBorderActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -2613,40 +2663,40 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::Selected:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryDefault.getRed(), 0.5, 0.5, &*p_transition_button_primary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryDefault.getGreen(), 0.5, 0.5, &*p_transition_button_primary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryDefault.getBlue(), 0.5, 0.5, &*p_transition_button_primary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryDefault.getRed(), 0.5, 0.5, &*p_transition_button_secondary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryDefault.getGreen(), 0.5, 0.5, &*p_transition_button_secondary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryDefault.getBlue(), 0.5, 0.5, &*p_transition_button_secondary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonBorderDefault.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonBorderDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonBorderDefault.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonBorderDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonBorderDefault.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.selectedRadioButtonBorderDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -2697,40 +2747,40 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::SelectedHover:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryHover.getRed(), 0.5, 0.5, &*p_transition_button_primary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryHover.getGreen(), 0.5, 0.5, &*p_transition_button_primary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryHover.getBlue(), 0.5, 0.5, &*p_transition_button_primary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryHover.getRed(), 0.5, 0.5, &*p_transition_button_secondary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryHover.getGreen(), 0.5, 0.5, &*p_transition_button_secondary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryHover.getBlue(), 0.5, 0.5, &*p_transition_button_secondary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonBorderHover.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonBorderHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonBorderHover.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonBorderHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonBorderHover.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.selectedRadioButtonBorderHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -2781,40 +2831,40 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::SelectedDown:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryActive.getRed(), 0.5, 0.5, &*p_transition_button_primary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryActive.getGreen(), 0.5, 0.5, &*p_transition_button_primary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryActive.getBlue(), 0.5, 0.5, &*p_transition_button_primary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonPrimaryActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_primary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryActive.getRed(), 0.5, 0.5, &*p_transition_button_secondary_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryActive.getGreen(), 0.5, 0.5, &*p_transition_button_secondary_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryActive.getBlue(), 0.5, 0.5, &*p_transition_button_secondary_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonSecondaryActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_secondary_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonBorderActive.getRed(), 0.5, 0.5, &*p_transition_button_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonBorderActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonBorderActive.getGreen(), 0.5, 0.5, &*p_transition_button_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonBorderActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonBorderActive.getBlue(), 0.5, 0.5, &*p_transition_button_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.selectedRadioButtonBorderActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, &*p_transition_button_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, &*p_transition_button_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, &*p_transition_button_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, Deleter::track(p_transition_button_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -2865,7 +2915,7 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::Focus:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -2880,7 +2930,7 @@ bool MyRadioButtonSubclass::startAnimation(RadioButtonAnimationState animationSt
         case RadioButtonAnimationState::FocusLost:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -2940,6 +2990,14 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyRadioButtonSubclass *p_this = reinterpret_cast<MyRadioButtonSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -2950,9 +3008,12 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
     // Override paint messages.
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(p_this->objects()->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -3003,7 +3064,10 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             }
 
             // Bind the render target to the window device context.
-            hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/BindDC");
+                hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            }
             if (FAILED(hr))
             {
                 error_message = "[WM_PAINT] Failed to bind the render target to the window device context.";
@@ -3026,19 +3090,19 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             std::unique_ptr<ID2D1SolidColorBrush *, ID2D1SolidColorBrushDeleter> p_d2d1_solidcolorbrush_ellipse_border(new ID2D1SolidColorBrush *(nullptr));
             {
                 error_message = "[WM_PAINT] Failed to create the resources.";
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, &*p_d2d1_solidcolorbrush_focus_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, Deleter::track(p_d2d1_solidcolorbrush_focus_border));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button_text, &*p_d2d1_solidcolorbrush_button_text);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_button_text, Deleter::track(p_d2d1_solidcolorbrush_button_text));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_ellipse, &*p_d2d1_solidcolorbrush_ellipse);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_ellipse, Deleter::track(p_d2d1_solidcolorbrush_ellipse));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_ellipse_inner, &*p_d2d1_solidcolorbrush_ellipse_inner);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_ellipse_inner, Deleter::track(p_d2d1_solidcolorbrush_ellipse_inner));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_ellipse_border, &*p_d2d1_solidcolorbrush_ellipse_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_ellipse_border, Deleter::track(p_d2d1_solidcolorbrush_ellipse_border));
                 if (FAILED(hr))
                     break;
                 error_message = "";
@@ -3076,7 +3140,10 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             }
 
             // End drawing.
-            hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/EndDraw");
+                hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!p_this->createDeviceResources(true))
@@ -3102,7 +3169,7 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
         }
 
         if (!are_all_operation_success)
-            g_pApp->logger.writeLog(error_message, "[CLASS: 'MyRadioButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyRadioButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
         EndPaint(hWnd, &ps);
         return 0;
@@ -3115,6 +3182,10 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
         {
         case MyRadioButtonSubclass::IDT_ANIMATION_INVALIDATE:
         {
+            MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+            p_this->objects()->performanceHud.recordAnimationTick();
+
             HRESULT hr;
             bool are_all_operation_success = false;
             std::string error_message = "";
@@ -3163,9 +3234,9 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             {
                 // Kill the timer if an error occurs.
                 if (!KillTimer(hWnd, MyRadioButtonSubclass::IDT_ANIMATION_INVALIDATE))
-                    g_pApp->logger.writeLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                    g_pApp->logger.writeLimitedLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
-                g_pApp->logger.writeLog(error_message, "[CLASS: 'MyRadioButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyRadioButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             }
 
             return 0;
@@ -3173,7 +3244,7 @@ LRESULT CALLBACK MyRadioButtonSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
 
         default:
         {
-            g_pApp->logger.writeLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             break;
         }
         }
@@ -3558,7 +3629,7 @@ HWND &MyEditboxSubclass::getStaticHandleRef()
 {
     return this->staticWindow;
 }
-bool MyEditboxSubclass::refresh()
+bool MyEditboxSubclass::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -3571,41 +3642,45 @@ bool MyEditboxSubclass::refresh()
             break;
         }
 
-        // Calculate the font size and create the font object.
-        RECT rect_window{0};
-        if (!GetClientRect(this->editboxWindow, &rect_window))
-        {
-            error_message = "Failed to retrieve the window client rect.";
-            break;
-        }
-        DWORD editbox_style = GetWindowLongW(this->editboxWindow, GWL_STYLE);
-        FLOAT font_size;
-        this->editboxFont.reset(new HFONT(nullptr));
-        if (editbox_style & ES_MULTILINE)
-        {
-            if (this->editConfig.fontSize)
-                font_size = this->editConfig.fontSize;
-            else
-                font_size = 29.0f;
-        }
-        else
+        // Calculate the font size and create the font object, unless only the colors are updated.
+        if (!isColorOnly)
         {
-            if (this->editConfig.fontSize)
-                font_size = this->editConfig.fontSize;
+            RECT rect_window{0};
+            if (!GetClientRect(this->editboxWindow, &rect_window))
+            {
+                error_message = "Failed to retrieve the window client rect.";
+                break;
+            }
+            DWORD editbox_style = GetWindowLongW(this->editboxWindow, GWL_STYLE);
+            FLOAT font_size;
+            this->editboxFont.reset(new HFONT(nullptr));
+            if (editbox_style & ES_MULTILINE)
+            {
+                if (this->editConfig.fontSize)
+                    font_size = this->editConfig.fontSize;
+                else
+                    font_size = 29.0f;
+            }
             else
-                font_size = static_cast<FLOAT>(rect_window.bottom - rect_window.top);
-        }
-        *this->editboxFont = CreateFontW(static_cast<int>(font_size), 0, 0, 0, FW_NORMAL, 0, 0, 0, DEFAULT_CHARSET, OUT_DEFAULT_PRECIS,
-                                         CLIP_DEFAULT_PRECIS, CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_DONTCARE,
-                                         (!this->editConfig.editboxWindowFontFamilyName.empty() ? this->editConfig.editboxWindowFontFamilyName.c_str() : this->objects()->fonts.defaultFamily.c_str()));
-        if (!*this->editboxFont)
-        {
-            error_message = "Failed to create the font object.";
-            break;
+            {
+                if (this->editConfig.fontSize)
+                    font_size = this->editConfig.fontSize;
+                else
+                    font_size = static_cast<FLOAT>(rect_window.bottom - rect_window.top);
+            }
+            *this->editboxFont = CreateFontW(static_cast<int>(font_size), 0, 0, 0, FW_NORMAL, 0, 0, 0, DEFAULT_CHARSET, OUT_DEFAULT_PRECIS,
+                                             CLIP_DEFAULT_PRECIS, CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_DONTCARE,
+                                             (!this->editConfig.editboxWindowFontFamilyName.empty() ? this->editConfig.editboxWindowFontFamilyName.c_str() : this->objects()->fonts.defaultFamily.c_str()));
+            if (!*this->editboxFont)
+            {
+                error_message = "Failed to create the font object.";
+                break;
+            }
+            Deleter::onResourceCreated(MyResourceType::Font);
+            SendMessageW(this->editboxWindow, WM_SETFONT, (WPARAM) * this->editboxFont, FALSE);
         }
 
         // Update the edit window character formats.
-        SendMessageW(this->editboxWindow, WM_SETFONT, (WPARAM) * this->editboxFont, FALSE);
         this->editDefaultCharFormat.cbSize = sizeof(CHARFORMAT2);
         this->editDefaultCharFormat.dwMask = CFM_COLOR | CFM_BACKCOLOR;
         this->editDefaultCharFormat.crTextColor = this->objects()->colors.textActive.getCOLORREF();
@@ -3617,8 +3692,8 @@ bool MyEditboxSubclass::refresh()
             break;
         }
 
-        // Create the device resources.
-        if (!this->createDeviceResources())
+        // Create the device resources, unless only the colors are updated.
+        if (!isColorOnly && !this->createDeviceResources())
         {
             error_message = "Failed to create the device resources.";
             break;
@@ -3647,6 +3722,13 @@ void MyEditboxSubclass::releaseSharedDeviceResources()
     MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox.reset();
     MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground.reset();
 }
+void MyEditboxSubclass::recolorSharedDeviceResources(UIColors &colors)
+{
+    if (MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox && *MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox)
+        (*MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox)->SetColor(colors.editbox.getD2D1Color());
+    if (MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground && *MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground)
+        (*MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground)->SetColor(colors.background.getD2D1Color());
+}
 void MyEditboxSubclass::setAnimationDuration(EditAnimationState animateState, FLOAT milliseconds)
 {
     switch (animateState)
@@ -3720,6 +3802,7 @@ bool MyEditboxSubclass::setWindow(HWND hWnd, MyEditboxSubclassConfig *pConfig)
             error_message = "Failed to create the font object.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Font);
 
         // Set the edit window character formats.
         SendMessageW(this->editboxWindow, WM_SETFONT, (WPARAM) * this->editboxFont, FALSE);
@@ -3806,14 +3889,14 @@ bool MyEditboxSubclass::createSharedDeviceResources()
         if (!MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox)
         {
             MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox.reset(new ID2D1SolidColorBrush *(nullptr));
-            hr = (*this->pD2D1DCRenderTarget)->CreateSolidColorBrush(this->objects()->colors.editbox.getD2D1Color(), &*MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox);
+            hr = (*this->pD2D1DCRenderTarget)->CreateSolidColorBrush(this->objects()->colors.editbox.getD2D1Color(), Deleter::track(MyEditboxSubclass::pSharedD2D1SolidColorBrushEditbox));
             if (FAILED(hr))
                 break;
         }
         if (!MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground)
         {
             MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground.reset(new ID2D1SolidColorBrush *(nullptr));
-            hr = (*this->pD2D1DCRenderTarget)->CreateSolidColorBrush(this->objects()->colors.background.getD2D1Color(), &*MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground);
+            hr = (*this->pD2D1DCRenderTarget)->CreateSolidColorBrush(this->objects()->colors.background.getD2D1Color(), Deleter::track(MyEditboxSubclass::pSharedD2D1SolidColorBrushEditboxBackground));
             if (FAILED(hr))
                 break;
         }
@@ -3903,7 +3986,7 @@ bool MyEditboxSubclass::startAnimation(EditAnimationState animationState)
     while (!are_all_operation_success)
     {
         // Create the storyboard.
-        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -3917,13 +4000,13 @@ bool MyEditboxSubclass::startAnimation(EditAnimationState animationState)
         case EditAnimationState::Default:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.editboxBorderDefault.getRed(), 0.5, 0.5, &*p_transition_editbox_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.editboxBorderDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_editbox_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.editboxBorderDefault.getGreen(), 0.5, 0.5, &*p_transition_editbox_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.editboxBorderDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_editbox_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.editboxBorderDefault.getBlue(), 0.5, 0.5, &*p_transition_editbox_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.editboxBorderDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_editbox_border_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -3947,13 +4030,13 @@ bool MyEditboxSubclass::startAnimation(EditAnimationState animationState)
         case EditAnimationState::Selected:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->selectedAnimationDuration, this->objects()->colors.editboxBorderSelected.getRed(), 0.5, 0.5, &*p_transition_editbox_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->selectedAnimationDuration, this->objects()->colors.editboxBorderSelected.getRed(), 0.5, 0.5, Deleter::track(p_transition_editbox_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->selectedAnimationDuration, this->objects()->colors.editboxBorderSelected.getGreen(), 0.5, 0.5, &*p_transition_editbox_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->selectedAnimationDuration, this->objects()->colors.editboxBorderSelected.getGreen(), 0.5, 0.5, Deleter::track(p_transition_editbox_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->selectedAnimationDuration, this->objects()->colors.editboxBorderSelected.getBlue(), 0.5, 0.5, &*p_transition_editbox_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->selectedAnimationDuration, this->objects()->colors.editboxBorderSelected.getBlue(), 0.5, 0.5, Deleter::track(p_transition_editbox_border_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -4022,6 +4105,14 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureEdit(HWND hWnd, UINT uMsg,
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyEditboxSubclass *p_this = reinterpret_cast<MyEditboxSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -4127,6 +4218,14 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyEditboxSubclass *p_this = reinterpret_cast<MyEditboxSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -4137,9 +4236,12 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
     // Override paint messages.
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(p_this->objects()->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -4168,7 +4270,10 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
             rect_window_2.bottom -= 1;
 
             // Bind the render target to the window device context.
-            hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window_1);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/BindDC");
+                hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window_1);
+            }
             if (FAILED(hr))
             {
                 error_message = "[WM_PAINT] Failed to bind the render target to the window device context.";
@@ -4185,12 +4290,12 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
             std::unique_ptr<ID2D1SolidColorBrush *, ID2D1SolidColorBrushDeleter> p_d2d1_solidcolorbrush_border(new ID2D1SolidColorBrush *(nullptr));
             {
                 error_message = "[WM_PAINT] Failed to create the resources.";
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_border, &*p_d2d1_solidcolorbrush_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_border, Deleter::track(p_d2d1_solidcolorbrush_border));
                 if (FAILED(hr))
                     break;
-                if (!p_d2d1_solidcolorbrush_background)
+                if (p_this->config.pBackground)
                 {
-                    hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(p_this->config.pBackground->getD2D1Color(), &p_d2d1_solidcolorbrush_background);
+                    hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(p_this->config.pBackground->getD2D1Color(), Deleter::track(p_d2d1_solidcolorbrush_background_custom));
                     if (FAILED(hr))
                         break;
                 }
@@ -4210,7 +4315,10 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
             p_this->graphics()->d2d1Engine().drawRoundRectangle((*p_this->pD2D1DCRenderTarget), d2d1_rect_window_1, 4, 4, *p_d2d1_solidcolorbrush_border);
 
             // End drawing.
-            hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/EndDraw");
+                hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!p_this->createDeviceResources(true))
@@ -4236,7 +4344,7 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
         }
 
         if (!are_all_operation_success)
-            g_pApp->logger.writeLog(error_message, "[CLASS: 'MyEditboxSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyEditboxSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
 
         EndPaint(hWnd, &ps);
         return 0;
@@ -4249,6 +4357,10 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
         {
         case MyEditboxSubclass::IDT_ANIMATION_INVALIDATE:
         {
+            MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+            p_this->objects()->performanceHud.recordAnimationTick();
+
             HRESULT hr;
             bool are_all_operation_success = false;
             std::string error_message = "";
@@ -4297,9 +4409,9 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
             {
                 // Kill the timer if an error occurs.
                 if (!KillTimer(hWnd, MyEditboxSubclass::IDT_ANIMATION_INVALIDATE))
-                    g_pApp->logger.writeLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                    g_pApp->logger.writeLimitedLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
-                g_pApp->logger.writeLog(error_message, "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             }
 
             return 0;
@@ -4307,7 +4419,7 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
 
         default:
         {
-            g_pApp->logger.writeLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyEditboxSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyEditboxSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             break;
         }
         }
@@ -4330,7 +4442,7 @@ LRESULT CALLBACK MyEditboxSubclass::subclassProcedureStatic(HWND hWnd, UINT uMsg
 
 // [MyDDLComboboxSubclass] class implementations:
 
-bool MyDDLComboboxSubclass::refresh()
+bool MyDDLComboboxSubclass::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -4343,20 +4455,23 @@ bool MyDDLComboboxSubclass::refresh()
             break;
         }
 
-        // Create the device resources.
-        if (!this->createDeviceResources())
+        // Create the device resources, unless only the colors are updated.
+        if (!isColorOnly && !this->createDeviceResources())
         {
             error_message = "Failed to create the device resources.";
             break;
         }
 
-        // Perform additional touches to the combobox.
+        // Perform additional touches to the combobox, unless only the colors are updated.
+        if (!isColorOnly)
         {
             // Create compatible font for the drop-down list window.
             this->ddlFont.reset(new HFONT(nullptr));
             *this->ddlFont = CreateFontW(static_cast<int>(-((*this->pTextFormat)->GetFontSize())), 0, 0, 0, FW_NORMAL, 0, 0, 0, DEFAULT_CHARSET, OUT_DEFAULT_PRECIS,
                                          CLIP_DEFAULT_PRECIS, CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_DONTCARE,
                                          this->objects()->fonts.defaultFamily.c_str());
+            if (*this->ddlFont)
+                Deleter::onResourceCreated(MyResourceType::Font);
 
             // If the combobox drop down is opening during the refresh, close the drop down and mark it for reopen.
             bool reopen_combobox = false;
@@ -4565,6 +4680,8 @@ bool MyDDLComboboxSubclass::setWindow(HWND hWnd, INT comboboxHeight)
             *this->ddlFont = CreateFontW(static_cast<int>(-((*this->pTextFormat)->GetFontSize())), 0, 0, 0, FW_NORMAL, 0, 0, 0, DEFAULT_CHARSET, OUT_DEFAULT_PRECIS,
                                          CLIP_DEFAULT_PRECIS, CLEARTYPE_QUALITY, DEFAULT_PITCH | FF_DONTCARE,
                                          this->objects()->fonts.defaultFamily.c_str());
+            if (*this->ddlFont)
+                Deleter::onResourceCreated(MyResourceType::Font);
 
             // Set the combobox height.
             ComboBox_SetItemHeight(this->comboboxWindow, -1, comboboxHeight - 6);
@@ -4624,7 +4741,7 @@ bool MyDDLComboboxSubclass::createSharedDeviceResources()
         if (!MyDDLComboboxSubclass::pSharedD2D1BitmapArrow)
         {
             MyDDLComboboxSubclass::pSharedD2D1BitmapArrow.reset(new ID2D1Bitmap *(nullptr));
-            hr = (*this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(this->objects()->images.pWicBitmapDDLComboboxArrow->getBitmapSource(), &*MyDDLComboboxSubclass::pSharedD2D1BitmapArrow);
+            hr = (*this->pD2D1DCRenderTarget)->CreateBitmapFromWicBitmap(this->objects()->images.pWicBitmapDDLComboboxArrow->getBitmapSource(), Deleter::track(MyDDLComboboxSubclass::pSharedD2D1BitmapArrow));
             if (FAILED(hr))
                 break;
         }
@@ -4736,7 +4853,7 @@ bool MyDDLComboboxSubclass::startAnimation(DDLComboboxAnimationState animationSt
     while (!are_all_operation_success)
     {
         // Create the storyboard.
-        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -4750,31 +4867,31 @@ bool MyDDLComboboxSubclass::startAnimation(DDLComboboxAnimationState animationSt
         case DDLComboboxAnimationState::Default:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxDefault.getRed(), 0.5, 0.5, &*p_transition_combobox_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_combobox_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxDefault.getGreen(), 0.5, 0.5, &*p_transition_combobox_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_combobox_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxDefault.getBlue(), 0.5, 0.5, &*p_transition_combobox_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_combobox_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxBorder.getRed(), 0.5, 0.5, &*p_transition_combobox_border_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxBorder.getRed(), 0.5, 0.5, Deleter::track(p_transition_combobox_border_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxBorder.getGreen(), 0.5, 0.5, &*p_transition_combobox_border_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxBorder.getGreen(), 0.5, 0.5, Deleter::track(p_transition_combobox_border_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxBorder.getBlue(), 0.5, 0.5, &*p_transition_combobox_border_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.ddlComboboxBorder.getBlue(), 0.5, 0.5, Deleter::track(p_transition_combobox_border_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, &*p_transition_combobox_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_combobox_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, &*p_transition_combobox_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_combobox_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, &*p_transition_combobox_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.textActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_combobox_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -4816,22 +4933,22 @@ bool MyDDLComboboxSubclass::startAnimation(DDLComboboxAnimationState animationSt
         case DDLComboboxAnimationState::Active:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.ddlComboboxActive.getRed(), 0.5, 0.5, &*p_transition_combobox_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.ddlComboboxActive.getRed(), 0.5, 0.5, Deleter::track(p_transition_combobox_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.ddlComboboxActive.getGreen(), 0.5, 0.5, &*p_transition_combobox_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.ddlComboboxActive.getGreen(), 0.5, 0.5, Deleter::track(p_transition_combobox_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.ddlComboboxActive.getBlue(), 0.5, 0.5, &*p_transition_combobox_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.ddlComboboxActive.getBlue(), 0.5, 0.5, Deleter::track(p_transition_combobox_rgb[2]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, &*p_transition_combobox_text_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getRed(), 0.5, 0.5, Deleter::track(p_transition_combobox_text_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, &*p_transition_combobox_text_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getGreen(), 0.5, 0.5, Deleter::track(p_transition_combobox_text_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, &*p_transition_combobox_text_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->activeAnimationDuration, this->objects()->colors.textHighlight.getBlue(), 0.5, 0.5, Deleter::track(p_transition_combobox_text_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -4864,7 +4981,7 @@ bool MyDDLComboboxSubclass::startAnimation(DDLComboboxAnimationState animationSt
         case DDLComboboxAnimationState::Focus:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 1.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -4879,7 +4996,7 @@ bool MyDDLComboboxSubclass::startAnimation(DDLComboboxAnimationState animationSt
         case DDLComboboxAnimationState::FocusLost:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, &*p_transition_focus_border_opacity);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->focusAnimationDuration, 0.0, 0.5, 0.5, Deleter::track(p_transition_focus_border_opacity));
             if (FAILED(hr))
                 break;
 
@@ -4939,6 +5056,14 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyDDLComboboxSubclass *p_this = reinterpret_cast<MyDDLComboboxSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -4949,9 +5074,12 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
     // Override paint messages.
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(p_this->objects()->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -5000,7 +5128,10 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
             }
 
             // Bind the render target to the window device context.
-            hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/BindDC");
+                hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            }
             if (FAILED(hr))
             {
                 error_message = "[WM_PAINT] Failed to bind the render target to the window device context.";
@@ -5021,16 +5152,16 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
             std::unique_ptr<ID2D1SolidColorBrush *, ID2D1SolidColorBrushDeleter> p_d2d1_solidcolorbrush_combobox_text(new ID2D1SolidColorBrush *(nullptr));
             {
                 error_message = "[WM_PAINT] Failed to create the resources.";
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, &*p_d2d1_solidcolorbrush_focus_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_focus_border, Deleter::track(p_d2d1_solidcolorbrush_focus_border));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_combobox, &*p_d2d1_solidcolorbrush_combobox);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_combobox, Deleter::track(p_d2d1_solidcolorbrush_combobox));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_combobox_border, &*p_d2d1_solidcolorbrush_combobox_border);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_combobox_border, Deleter::track(p_d2d1_solidcolorbrush_combobox_border));
                 if (FAILED(hr))
                     break;
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_combobox_text, &*p_d2d1_solidcolorbrush_combobox_text);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_combobox_text, Deleter::track(p_d2d1_solidcolorbrush_combobox_text));
                 if (FAILED(hr))
                     break;
                 error_message = "";
@@ -5063,7 +5194,10 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
             }
 
             // End drawing.
-            hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/EndDraw");
+                hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!p_this->createDeviceResources(true))
@@ -5089,7 +5223,7 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
         }
 
         if (!are_all_operation_success)
-            g_pApp->logger.writeLog(error_message, "[CLASS: 'MyDDLComboboxSubclass' | FUNC: 'subclassProcedureCombobox()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyDDLComboboxSubclass' | FUNC: 'subclassProcedureCombobox()']", MyLogType::Error);
 
         EndPaint(hWnd, &ps);
         break;
@@ -5106,6 +5240,10 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
         {
         case MyDDLComboboxSubclass::IDT_ANIMATION_INVALIDATE:
         {
+            MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+            p_this->objects()->performanceHud.recordAnimationTick();
+
             HRESULT hr;
             bool are_all_operation_success = false;
             std::string error_message = "";
@@ -5154,9 +5292,9 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
             {
                 // Kill the timer if an error occurs.
                 if (!KillTimer(hWnd, MyDDLComboboxSubclass::IDT_ANIMATION_INVALIDATE))
-                    g_pApp->logger.writeLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                    g_pApp->logger.writeLimitedLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
-                g_pApp->logger.writeLog(error_message, "[CLASS: 'MyDDLComboboxSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+                g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyDDLComboboxSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             }
 
             return 0;
@@ -5164,7 +5302,7 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureCombobox(HWND hWnd, UIN
 
         default:
         {
-            g_pApp->logger.writeLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyImageButtonSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
             break;
         }
         }
@@ -5261,6 +5399,14 @@ LRESULT CALLBACK MyDDLComboboxSubclass::subclassProcedureComboboxDDL(HWND hWnd,
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyDDLComboboxSubclass *p_this = reinterpret_cast<MyDDLComboboxSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -5569,7 +5715,7 @@ bool MyVerticalScrollbarSubclass::scrollWindowByAmountSmooth(INT scrollAmount)
         std::unique_ptr<IUIAnimationTransition *, IUIAnimationTransitionDeleter> p_transition_last_scroll_pos(new IUIAnimationTransition *(nullptr));
         std::unique_ptr<IUIAnimationTransition *, IUIAnimationTransitionDeleter> p_transition_target_scroll_pos(new IUIAnimationTransition *(nullptr));
 
-        HRESULT hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        HRESULT hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -5577,10 +5723,10 @@ bool MyVerticalScrollbarSubclass::scrollWindowByAmountSmooth(INT scrollAmount)
         }
 
         error_message = "Failed to create the animation transitions.";
-        hr = this->graphics()->wamEngine().transitionLibrary()->CreateInstantaneousTransition(current_scroll_pos, &*p_transition_last_scroll_pos);
+        hr = this->graphics()->wamEngine().transitionLibrary()->CreateInstantaneousTransition(current_scroll_pos, Deleter::track(p_transition_last_scroll_pos));
         if (FAILED(hr))
             break;
-        hr = this->graphics()->wamEngine().transitionLibrary()->CreateLinearTransitionFromSpeed(scroll_speed, this->lastScrollPos, &*p_transition_target_scroll_pos);
+        hr = this->graphics()->wamEngine().transitionLibrary()->CreateLinearTransitionFromSpeed(scroll_speed, this->lastScrollPos, Deleter::track(p_transition_target_scroll_pos));
         if (FAILED(hr))
             break;
         error_message = "";
@@ -5664,7 +5810,7 @@ bool MyVerticalScrollbarSubclass::scrollWindowByPosSmooth(INT scrollPos, FLOAT m
         std::unique_ptr<IUIAnimationTransition *, IUIAnimationTransitionDeleter> p_transition_last_scroll_pos(new IUIAnimationTransition *(nullptr));
         std::unique_ptr<IUIAnimationTransition *, IUIAnimationTransitionDeleter> p_transition_target_scroll_pos(new IUIAnimationTransition *(nullptr));
 
-        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -5672,10 +5818,10 @@ bool MyVerticalScrollbarSubclass::scrollWindowByPosSmooth(INT scrollPos, FLOAT m
         }
 
         error_message = "Failed to create the animation transitions.";
-        hr = this->graphics()->wamEngine().transitionLibrary()->CreateInstantaneousTransition(current_scroll_pos, &*p_transition_last_scroll_pos);
+        hr = this->graphics()->wamEngine().transitionLibrary()->CreateInstantaneousTransition(current_scroll_pos, Deleter::track(p_transition_last_scroll_pos));
         if (FAILED(hr))
             break;
-        hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(milliseconds, scrollPos, 0.5, 0.5, &*p_transition_target_scroll_pos);
+        hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(milliseconds, scrollPos, 0.5, 0.5, Deleter::track(p_transition_target_scroll_pos));
         if (FAILED(hr))
             break;
         error_message = "";
@@ -5767,7 +5913,7 @@ HWND &MyVerticalScrollbarSubclass::getStaticHandleRef()
 {
     return this->staticWindow;
 }
-bool MyVerticalScrollbarSubclass::refresh()
+bool MyVerticalScrollbarSubclass::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -5780,8 +5926,8 @@ bool MyVerticalScrollbarSubclass::refresh()
             break;
         }
 
-        // Create the device resources.
-        if (!this->createDeviceResources())
+        // Create the device resources, unless only the colors are updated.
+        if (!isColorOnly && !this->createDeviceResources())
         {
             error_message = "Failed to create the device resources.";
             break;
@@ -6004,7 +6150,7 @@ bool MyVerticalScrollbarSubclass::startAnimation(ScrollbarAnimationState animati
     while (!are_all_operation_success)
     {
         // Create the storyboard.
-        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(&*p_storyboard);
+        hr = this->graphics()->wamEngine().manager()->CreateStoryboard(Deleter::track(p_storyboard));
         if (FAILED(hr))
         {
             error_message = "Failed to create the animation storyboard.";
@@ -6018,13 +6164,13 @@ bool MyVerticalScrollbarSubclass::startAnimation(ScrollbarAnimationState animati
         case ScrollbarAnimationState::Default:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.scrollbarThumbDefault.getRed(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.scrollbarThumbDefault.getRed(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.scrollbarThumbDefault.getGreen(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.scrollbarThumbDefault.getGreen(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.scrollbarThumbDefault.getBlue(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->defaultAnimationDuration, this->objects()->colors.scrollbarThumbDefault.getBlue(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -6048,13 +6194,13 @@ bool MyVerticalScrollbarSubclass::startAnimation(ScrollbarAnimationState animati
         case ScrollbarAnimationState::Hover:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.scrollbarThumbHover.getRed(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.scrollbarThumbHover.getRed(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.scrollbarThumbHover.getGreen(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.scrollbarThumbHover.getGreen(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.scrollbarThumbHover.getBlue(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->hoverAnimationDuration, this->objects()->colors.scrollbarThumbHover.getBlue(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -6078,13 +6224,13 @@ bool MyVerticalScrollbarSubclass::startAnimation(ScrollbarAnimationState animati
         case ScrollbarAnimationState::Dragging:
         {
             // Create the animation transitions.
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->draggingAnimationDuration, this->objects()->colors.scrollbarThumbDragging.getRed(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[0]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->draggingAnimationDuration, this->objects()->colors.scrollbarThumbDragging.getRed(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[0]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->draggingAnimationDuration, this->objects()->colors.scrollbarThumbDragging.getGreen(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[1]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->draggingAnimationDuration, this->objects()->colors.scrollbarThumbDragging.getGreen(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[1]));
             if (FAILED(hr))
                 break;
-            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->draggingAnimationDuration, this->objects()->colors.scrollbarThumbDragging.getBlue(), 0.5, 0.5, &*p_transition_scrollbar_thumb_rgb[2]);
+            hr = this->graphics()->wamEngine().transitionLibrary()->CreateAccelerateDecelerateTransition(this->draggingAnimationDuration, this->objects()->colors.scrollbarThumbDragging.getBlue(), 0.5, 0.5, Deleter::track(p_transition_scrollbar_thumb_rgb[2]));
             if (FAILED(hr))
                 break;
 
@@ -6153,6 +6299,14 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureScrollbar(HWND hW
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyVerticalScrollbarSubclass *p_this = reinterpret_cast<MyVerticalScrollbarSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -6167,6 +6321,10 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureScrollbar(HWND hW
         {
         case IDT_ANIMATION_SCROLLBAR:
         {
+            MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+            p_this->objects()->performanceHud.recordAnimationTick();
+
             HRESULT hr;
             bool are_all_operation_success = false;
             std::string error_message = "";
@@ -6228,9 +6386,9 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureScrollbar(HWND hW
             {
                 // Kill the timer if an error occurs.
                 if (!KillTimer(hWnd, IDT_ANIMATION_SCROLLBAR))
-                    g_pApp->logger.writeLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureScrollbar()']", MyLogType::Error);
+                    g_pApp->logger.writeLimitedLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureScrollbar()']", MyLogType::Error);
                 p_this->scrollInProgress = false;
-                g_pApp->logger.writeLog(error_message, "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureScrollbar()']", MyLogType::Error);
+                g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureScrollbar()']", MyLogType::Error);
             }
 
             return 0;
@@ -6238,7 +6396,7 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureScrollbar(HWND hW
 
         default:
         {
-            g_pApp->logger.writeLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureScrollbar()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureScrollbar()']", MyLogType::Error);
             break;
         }
         }
@@ -6263,6 +6421,14 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyVerticalScrollbarSubclass *p_this = reinterpret_cast<MyVerticalScrollbarSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -6273,9 +6439,12 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
     // Override paint messages.
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(p_this->objects()->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -6322,7 +6491,10 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
             rect_thumb.bottom = rect_thumb.top + thumb_height;
 
             // Bind the render target to the window device context.
-            hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/BindDC");
+                hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            }
             if (FAILED(hr))
             {
                 error_message = "[WM_PAINT] Failed to bind the render target to the window device context.";
@@ -6338,7 +6510,7 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
             std::unique_ptr<ID2D1SolidColorBrush *, ID2D1SolidColorBrushDeleter> p_d2d1_solidcolorbrush_scrollbar_thumb(new ID2D1SolidColorBrush *(nullptr));
             {
                 error_message = "[WM_PAINT] Failed to create the resources.";
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_scrollbar_thumb, &*p_d2d1_solidcolorbrush_scrollbar_thumb);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_scrollbar_thumb, Deleter::track(p_d2d1_solidcolorbrush_scrollbar_thumb));
                 if (FAILED(hr))
                     break;
                 error_message = "";
@@ -6357,7 +6529,10 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
             }
 
             // End drawing.
-            hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/EndDraw");
+                hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!p_this->createDeviceResources(true))
@@ -6383,7 +6558,7 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
         }
 
         if (!are_all_operation_success)
-            g_pApp->logger.writeLog(error_message, "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
 
         EndPaint(hWnd, &ps);
         return 0;
@@ -6396,6 +6571,10 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
         {
         case MyVerticalScrollbarSubclass::IDT_ANIMATION_INVALIDATE:
         {
+            MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER");
+            MY_PROFILE_INTERVAL(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_TIMER/Interval");
+            p_this->objects()->performanceHud.recordAnimationTick();
+
             HRESULT hr;
             bool are_all_operation_success = false;
             std::string error_message = "";
@@ -6444,9 +6623,9 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
             {
                 // Kill the timer if an error occurs.
                 if (!KillTimer(hWnd, MyVerticalScrollbarSubclass::IDT_ANIMATION_INVALIDATE))
-                    g_pApp->logger.writeLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
+                    g_pApp->logger.writeLimitedLog("[WM_TIMER] Failed to kill the timer.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
 
-                g_pApp->logger.writeLog(error_message, "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
+                g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
             }
 
             return 0;
@@ -6454,7 +6633,7 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
 
         default:
         {
-            g_pApp->logger.writeLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog("[WM_TIMER] Unprocessed timer message.", "[CLASS: 'MyVerticalScrollbarSubclass' | FUNC: 'subclassProcedureStatic()']", MyLogType::Error);
             break;
         }
         }
@@ -6750,7 +6929,7 @@ LRESULT CALLBACK MyVerticalScrollbarSubclass::subclassProcedureStatic(HWND hWnd,
 
 // [MyStandardTextSubclass] class implementations:
 
-bool MyStandardTextSubclass::refresh()
+bool MyStandardTextSubclass::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -6763,8 +6942,8 @@ bool MyStandardTextSubclass::refresh()
             break;
         }
 
-        // Create the device resources.
-        if (!this->createDeviceResources())
+        // Create the device resources, unless only the colors are updated.
+        if (!isColorOnly && !this->createDeviceResources())
         {
             error_message = "Failed to create the device resources.";
             break;
@@ -6942,6 +7121,14 @@ LRESULT CALLBACK MyStandardTextSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
     // Extract the subclass object pointer from reference data and use it to access non-static members.
     MyStandardTextSubclass *p_this = reinterpret_cast<MyStandardTextSubclass *>(dwRefData);
 
+    // Attribute the allocations to the message.
+    MY_ALLOCATION_SCOPE(uMsg, GetDlgCtrlID(hWnd));
+
+    // Record the input message, the live input is dropped during a replay.
+    MyInputScope input_scope(g_pApp->inputRecorder, hWnd, uMsg, wParam, lParam);
+    if (input_scope.isDropped())
+        return 0;
+
     // Process the message.
     switch (uMsg)
     {
@@ -6952,9 +7139,12 @@ LRESULT CALLBACK MyStandardTextSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
     // Override paint messages.
     case WM_PAINT:
     {
+        MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT");
+
         USHORT paint_attempts = 1;
         PAINTSTRUCT ps;
         HDC hdc = BeginPaint(hWnd, &ps);
+        MyPerformanceHudPaintScope hud_paint_scope(p_this->objects()->performanceHud, ps.rcPaint);
 
         bool are_all_operation_success = false;
         std::string error_message = "";
@@ -6988,7 +7178,10 @@ LRESULT CALLBACK MyStandardTextSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             }
 
             // Bind the render target to the window device context.
-            hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/BindDC");
+                hr = (*p_this->pD2D1DCRenderTarget)->BindDC(hdc, &rect_window);
+            }
             if (FAILED(hr))
             {
                 error_message = "[WM_PAINT] Failed to bind the render target to the window device context.";
@@ -7001,7 +7194,7 @@ LRESULT CALLBACK MyStandardTextSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             std::unique_ptr<ID2D1SolidColorBrush *, ID2D1SolidColorBrushDeleter> p_d2d1_solidcolorbrush_text(new ID2D1SolidColorBrush *(nullptr));
             {
                 error_message = "[WM_PAINT] Failed to create the resources.";
-                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_text, &*p_d2d1_solidcolorbrush_text);
+                hr = (*p_this->pD2D1DCRenderTarget)->CreateSolidColorBrush(d2d1_color_text, Deleter::track(p_d2d1_solidcolorbrush_text));
                 if (FAILED(hr))
                     break;
                 error_message = "";
@@ -7021,7 +7214,10 @@ LRESULT CALLBACK MyStandardTextSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
             }
 
             // End drawing.
-            hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            {
+                MY_PROFILE_SCOPE(g_pApp->profiler, GetDlgCtrlID(hWnd), "WM_PAINT/EndDraw");
+                hr = (*p_this->pD2D1DCRenderTarget)->EndDraw();
+            }
             if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
                 if (!p_this->createDeviceResources(true))
@@ -7047,7 +7243,7 @@ LRESULT CALLBACK MyStandardTextSubclass::subclassProcedure(HWND hWnd, UINT uMsg,
         }
 
         if (!are_all_operation_success)
-            g_pApp->logger.writeLog(error_message, "[CLASS: 'MyStandardTextSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
+            g_pApp->logger.writeLimitedLog(error_message, "[CLASS: 'MyStandardTextSubclass' | FUNC: 'subclassProcedure()']", MyLogType::Error);
 
         EndPaint(hWnd, &ps);
         return 0;
@@ -0,0 +1,203 @@
+/**
+ * @file text.cpp
+ * @brief Implementation of the portable text helpers defined in text.h.
+ * @note Windows-free, only includes the portable headers. Built into the application and the headless tools.
+ */
+
+#include "../Headers/portable_includes.h" // Include the portable types.
+#include "../Headers/text.h"              // Include the portable text helpers.
+
+/*******************************************************
+ * Character class helpers (`FilterCharacters()`, ...) *
+ *******************************************************/
+
+/**
+ * @brief Check if a character is in a character class.
+ */
+template <typename Char>
+static inline bool IsInCharacterClass(Char character, const MYCHARCLASS &charClass)
+{
+    return charClass.contains(static_cast<char32_t>(static_cast<std::make_unsigned_t<Char>>(character)));
+}
+
+/**
+ * @brief Match 16 characters against a character class.
+ * @note The ranges are checked with one unsigned comparison each: (character - first) <= (last - first).
+ * @return Returns the match mask, bit i is set if the character i is in the class.
+ */
+template <typename Char>
+static inline UINT MatchCharacterBlock(const Char *pBlock, const MYCHARCLASS &charClass)
+{
+#if defined(SIMD_SSE2)
+    if constexpr (sizeof(Char) == 1)
+    {
+        __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pBlock));
+        __m128i matches = _mm_setzero_si128();
+        for (size_t i = 0; i < charClass.totalRanges; i++)
+        {
+            __m128i offsets = _mm_sub_epi8(block, _mm_set1_epi8(static_cast<CHAR>(charClass.ranges[i][0])));
+            __m128i excesses = _mm_subs_epu8(offsets, _mm_set1_epi8(static_cast<CHAR>(charClass.ranges[i][1] - charClass.ranges[i][0])));
+            matches = _mm_or_si128(matches, _mm_cmpeq_epi8(excesses, _mm_setzero_si128()));
+        }
+        return static_cast<UINT>(_mm_movemask_epi8(matches));
+    }
+    else if constexpr (sizeof(Char) == 2)
+    {
+        __m128i low_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pBlock));
+        __m128i high_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(pBlock + 8));
+        __m128i low_matches = _mm_setzero_si128(), high_matches = _mm_setzero_si128();
+        for (size_t i = 0; i < charClass.totalRanges; i++)
+        {
+            __m128i first = _mm_set1_epi16(static_cast<SHORT>(charClass.ranges[i][0]));
+            __m128i span = _mm_set1_epi16(static_cast<SHORT>(charClass.ranges[i][1] - charClass.ranges[i][0]));
+            low_matches = _mm_or_si128(low_matches, _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(low_block, first), span), _mm_setzero_si128()));
+            high_matches = _mm_or_si128(high_matches, _mm_cmpeq_epi16(_mm_subs_epu16(_mm_sub_epi16(high_block, first), span), _mm_setzero_si128()));
+        }
+        return static_cast<UINT>(_mm_movemask_epi8(_mm_packs_epi16(low_matches, high_matches)));
+    }
+#elif defined(SIMD_NEON)
+    if constexpr (sizeof(Char) == 1)
+    {
+        static const uint8_t bit_weights[16] = {1, 2, 4, 8, 16, 32, 64, 128, 1, 2, 4, 8, 16, 32, 64, 128};
+        uint8x16_t block = vld1q_u8(reinterpret_cast<const uint8_t *>(pBlock));
+        uint8x16_t matches = vdupq_n_u8(0);
+        for (size_t i = 0; i < charClass.totalRanges; i++)
+        {
+            uint8x16_t offsets = vsubq_u8(block, vdupq_n_u8(static_cast<uint8_t>(charClass.ranges[i][0])));
+            matches = vorrq_u8(matches, vcleq_u8(offsets, vdupq_n_u8(static_cast<uint8_t>(charClass.ranges[i][1] - charClass.ranges[i][0]))));
+        }
+        matches = vandq_u8(matches, vld1q_u8(bit_weights));
+        return static_cast<UINT>(vaddv_u8(vget_low_u8(matches))) | (static_cast<UINT>(vaddv_u8(vget_high_u8(matches))) << 8);
+    }
+    else if constexpr (sizeof(Char) == 2)
+    {
+        static const uint16_t bit_weights[8] = {1, 2, 4, 8, 16, 32, 64, 128};
+        uint16x8_t low_block = vld1q_u16(reinterpret_cast<const uint16_t *>(pBlock));
+        uint16x8_t high_block = vld1q_u16(reinterpret_cast<const uint16_t *>(pBlock + 8));
+        uint16x8_t low_matches = vdupq_n_u16(0), high_matches = vdupq_n_u16(0);
+        for (size_t i = 0; i < charClass.totalRanges; i++)
+        {
+            uint16x8_t first = vdupq_n_u16(static_cast<uint16_t>(charClass.ranges[i][0]));
+            uint16x8_t span = vdupq_n_u16(static_cast<uint16_t>(charClass.ranges[i][1] - charClass.ranges[i][0]));
+            low_matches = vorrq_u16(low_matches, vcleq_u16(vsubq_u16(low_block, first), span));
+            high_matches = vorrq_u16(high_matches, vcleq_u16(vsubq_u16(high_block, first), span));
+        }
+        uint16x8_t weights = vld1q_u16(bit_weights);
+        return static_cast<UINT>(vaddvq_u16(vandq_u16(low_matches, weights))) | (static_cast<UINT>(vaddvq_u16(vandq_u16(high_matches, weights))) << 8);
+    }
+#endif
+
+    UINT matches = 0;
+    for (UINT i = 0; i < 16; i++)
+    {
+        if (IsInCharacterClass(pBlock[i], charClass))
+            matches |= (1u << i);
+    }
+
+    return matches;
+}
+
+/**
+ * @brief Count the set bits of a 16-bit match mask.
+ */
+static inline UINT CountMatches(UINT matches)
+{
+    matches = matches - ((matches >> 1) & 0x5555);
+    matches = (matches & 0x3333) + ((matches >> 2) & 0x3333);
+    matches = (matches + (matches >> 4)) & 0x0F0F;
+    return (matches + (matches >> 8)) & 0x1F;
+}
+
+template <typename Char>
+static bool ContainsCharacterClass(const std::basic_string<Char> &str, const MYCHARCLASS &charClass)
+{
+    const Char *p_str = str.data();
+    size_t i = 0;
+    for (; i + 16 <= str.size(); i += 16)
+    {
+        if (MatchCharacterBlock(p_str + i, charClass))
+            return true;
+    }
+    for (; i < str.size(); i++)
+    {
+        if (IsInCharacterClass(p_str[i], charClass))
+            return true;
+    }
+
+    return false;
+}
+
+template <typename Char>
+static size_t CountCharacterClass(const std::basic_string<Char> &str, const MYCHARCLASS &charClass)
+{
+    const Char *p_str = str.data();
+    size_t i = 0, total_characters = 0;
+    for (; i + 16 <= str.size(); i += 16)
+        total_characters += CountMatches(MatchCharacterBlock(p_str + i, charClass));
+    for (; i < str.size(); i++)
+        total_characters += IsInCharacterClass(p_str[i], charClass);
+
+    return total_characters;
+}
+
+template <typename Char>
+static std::basic_string<Char> FilterCharacterClass(const std::basic_string<Char> &str, const MYCHARCLASS &charClass)
+{
+    // Filter into the result string, sized for the worst case and then shrunk in place.
+    std::basic_string<Char> result(str.size(), Char());
+    const Char *p_str = str.data();
+    Char *p_result = result.data();
+    size_t i = 0, total_characters = 0;
+    for (; i + 16 <= str.size(); i += 16)
+    {
+        UINT matches = MatchCharacterBlock(p_str + i, charClass);
+        if (matches == 0xFFFF)
+        {
+            std::memcpy(p_result + total_characters, p_str + i, 16 * sizeof(Char));
+            total_characters += 16;
+            continue;
+        }
+        for (size_t j = 0; matches; j++, matches >>= 1)
+        {
+            if (matches & 1)
+                p_result[total_characters++] = p_str[i + j];
+        }
+    }
+    for (; i < str.size(); i++)
+    {
+        if (IsInCharacterClass(p_str[i], charClass))
+            p_result[total_characters++] = p_str[i];
+    }
+    result.resize(total_characters);
+
+    return result;
+}
+
+/*******************************************
+ * Portable text functions implementations *
+ *******************************************/
+
+bool MyUtility::ContainsCharacter(const std::string &str, const MYCHARCLASS &charClass)
+{
+    return ContainsCharacterClass(str, charClass);
+}
+bool MyUtility::ContainsCharacter(const std::wstring &str, const MYCHARCLASS &charClass)
+{
+    return ContainsCharacterClass(str, charClass);
+}
+size_t MyUtility::CountCharacters(const std::string &str, const MYCHARCLASS &charClass)
+{
+    return CountCharacterClass(str, charClass);
+}
+size_t MyUtility::CountCharacters(const std::wstring &str, const MYCHARCLASS &charClass)
+{
+    return CountCharacterClass(str, charClass);
+}
+std::string MyUtility::FilterCharacters(const std::string &str, const MYCHARCLASS &charClass)
+{
+    return FilterCharacterClass(str, charClass);
+}
+std::wstring MyUtility::FilterCharacters(const std::wstring &str, const MYCHARCLASS &charClass)
+{
+    return FilterCharacterClass(str, charClass);
+}
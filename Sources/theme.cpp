@@ -0,0 +1,36 @@
+/**
+ * @file theme.cpp
+ * @brief Implementation of the portable theme types defined in theme.h.
+ * @note Windows-free, only includes the portable headers. Built into the application and the headless tools.
+ */
+
+#include "../Headers/portable_includes.h" // Include the portable types.
+#include "../Headers/marco.h"             // Include the global marcos.
+#include "../Headers/theme.h"             // Include the portable theme types.
+
+static_assert(UI_THEME_COUNT == static_cast<size_t>(MyTheme::Monokai) + 1, "UI_THEME_COUNT must match the MyTheme entries.");
+static_assert(UI_THEME_COLOR_COUNT == static_cast<size_t>(MyThemeColor::Count), "UI_THEME_COLOR_COUNT must match the MyThemeColor entries.");
+static_assert(sizeof(MYTHEMETABLE) == UI_THEME_COLOR_COUNT * 4, "The theme table must not contain padding.");
+
+/************************************
+ * Theme structures implementations *
+ ************************************/
+
+void MYTHEMETABLE::blend(const MYTHEMETABLE &from, const MYTHEMETABLE &to, UINT weight, MYTHEMETABLE &result)
+{
+    UINT from_weight = 256 - weight;
+    for (size_t i = 0; i < UI_THEME_COLOR_COUNT; i++)
+    {
+        result.red[i] = static_cast<BYTE>((from.red[i] * from_weight + to.red[i] * weight) >> 8);
+        result.green[i] = static_cast<BYTE>((from.green[i] * from_weight + to.green[i] * weight) >> 8);
+        result.blue[i] = static_cast<BYTE>((from.blue[i] * from_weight + to.blue[i] * weight) >> 8);
+        result.alpha[i] = static_cast<BYTE>((from.alpha[i] * from_weight + to.alpha[i] * weight) >> 8);
+    }
+}
+UINT MYTHEMETABLE::getTransitionWeight(DOUBLE progress)
+{
+    progress = (progress < 0.0 ? 0.0 : (progress > 1.0 ? 1.0 : progress));
+    progress = progress * progress * (3.0 - 2.0 * progress);
+
+    return static_cast<UINT>(progress * 256.0 + 0.5);
+}
@@ -6,12 +6,334 @@
 #include "../Headers/standard_includes.h" // Include standard libraries.
 #include "../Headers/my_includes.h"       // Include my user-defined type headers.
 
+/*************************
+ * Built-in theme tables *
+ *************************/
+
+// Built-in theme tables, indexed by `MyTheme`.
+constexpr MYTHEMETABLE UI_BUILTIN_THEME_TABLES[] =
+    {
+        // Light theme.
+        MYTHEMETABLE::fromRGB({
+            {255, 255, 255}, // Primary color.
+            {255, 255, 255}, // Secondary color.
+            {64, 64, 64},    // Border active color.
+            {192, 192, 192}, // Border inactive color.
+            {0, 0, 0},       // Text active color.
+            {153, 153, 153}, // Text inactive color.
+            {0, 0, 0},       // Text highlight color.
+            {0, 162, 237},   // Focus color.
+            {240, 240, 240}, // Background color.
+            {220, 220, 220}, // Caption background color.
+            {0, 0, 0},       // Caption text active color.
+            {153, 153, 153}, // Caption text inactive color.
+            {255, 89, 89},   // Caption close button hover background color.
+            {255, 89, 89},   // Caption close button down background color.
+            {205, 206, 206}, // Caption maximize button hover background color.
+            {205, 206, 206}, // Caption maximize button down background color.
+            {205, 206, 206}, // Caption minimize button hover background color.
+            {205, 206, 206}, // Caption minimize button down background color.
+            {225, 225, 225}, // Standard button default color.
+            {229, 241, 251}, // Standard button hover color.
+            {204, 228, 247}, // Standard button down color.
+            {172, 172, 172}, // Standard button border default color.
+            {0, 120, 215},   // Standard button border hover color.
+            {0, 84, 153},    // Standard button border down color.
+            {255, 255, 255}, // Radio button primary color.
+            {255, 255, 255}, // Radio button hover state primary color.
+            {204, 228, 247}, // Radio button down state primary color.
+            {255, 255, 255}, // Radio button secondary color.
+            {255, 255, 255}, // Radio button hover state secondary color.
+            {204, 228, 247}, // Radio button down state secondary color.
+            {51, 51, 51},    // Radio button border color.
+            {0, 120, 215},   // Radio button hover state border color.
+            {0, 84, 153},    // Radio button down state border color.
+            {51, 51, 51},    // Selected radio button primary color.
+            {0, 120, 215},   // Selected radio button hover state primary color.
+            {0, 84, 153},    // Selected radio button down state primary color.
+            {255, 255, 255}, // Selected radio button secondary color.
+            {255, 255, 255}, // Selected radio button hover state secondary color.
+            {204, 228, 247}, // Selected radio button down state secondary color.
+            {51, 51, 51},    // Selected radio button border color.
+            {0, 120, 215},   // Selected radio button hover state border color.
+            {0, 84, 153},    // Selected radio button down state border color.
+            {255, 255, 255}, // Editbox color.
+            {122, 122, 122}, // Editbox border default color.
+            {0, 120, 215},   // Editbox border selected color.
+            {225, 225, 225}, // DDL combobox default color.
+            {229, 241, 251}, // DDL combobox active color.
+            {172, 172, 172}, // DDL combobox border color.
+            {255, 255, 255}, // DDL combobox default item background color.
+            {0, 120, 215},   // DDL combobox selected item background color.
+            {0, 120, 215},   // DDL combobox drop-down list window border color.
+            {0, 0, 0},       // DDL combobox default item text color.
+            {255, 255, 255}, // DDL combobox selected item text color.
+            {230, 230, 230}, // Scrollbar background color.
+            {194, 195, 201}, // Scrollbar thumb default color.
+            {174, 175, 180}, // Scrollbar thumb hover color.
+            {155, 156, 160}, // Scrollbar thumb down color.
+        }),
+        // Dark theme.
+        MYTHEMETABLE::fromRGB({
+            {0, 0, 0},       // Primary color.
+            {32, 32, 32},    // Secondary color.
+            {48, 48, 48},    // Border active color.
+            {57, 57, 57},    // Border inactive color.
+            {216, 222, 233}, // Text active color.
+            {162, 162, 162}, // Text inactive color.
+            {216, 222, 233}, // Text highlight color.
+            {0, 162, 237},   // Focus color.
+            {32, 32, 32},    // Background color.
+            {0, 0, 0},       // Caption background color.
+            {216, 222, 233}, // Caption text active color.
+            {162, 162, 162}, // Caption text inactive color.
+            {232, 17, 35},   // Caption close button hover background color.
+            {232, 17, 35},   // Caption close button down background color.
+            {57, 57, 57},    // Caption maximize button hover background color.
+            {57, 57, 57},    // Caption maximize button down background color.
+            {57, 57, 57},    // Caption minimize button hover background color.
+            {57, 57, 57},    // Caption minimize button down background color.
+            {51, 51, 51},    // Standard button default color.
+            {69, 69, 69},    // Standard button hover color.
+            {102, 102, 102}, // Standard button down color.
+            {155, 155, 155}, // Standard button border default color.
+            {155, 155, 155}, // Standard button border hover color.
+            {155, 155, 155}, // Standard button border down color.
+            {51, 51, 51},    // Radio button primary color.
+            {69, 69, 69},    // Radio button hover state primary color.
+            {87, 87, 87},    // Radio button down state primary color.
+            {51, 51, 51},    // Radio button secondary color.
+            {69, 69, 69},    // Radio button hover state secondary color.
+            {87, 87, 87},    // Radio button down state secondary color.
+            {155, 155, 155}, // Radio button border color.
+            {155, 155, 155}, // Radio button hover state border color.
+            {155, 155, 155}, // Radio button down state border color.
+            {207, 207, 207}, // Selected radio button primary color.
+            {225, 225, 225}, // Selected radio button hover state primary color.
+            {250, 250, 250}, // Selected radio button down state primary color.
+            {51, 51, 51},    // Selected radio button secondary color.
+            {51, 51, 51},    // Selected radio button hover state secondary color.
+            {51, 51, 51},    // Selected radio button down state secondary color.
+            {155, 155, 155}, // Selected radio button border color.
+            {155, 155, 155}, // Selected radio button hover state border color.
+            {155, 155, 155}, // Selected radio button down state border color.
+            {48, 48, 48},    // Editbox color.
+            {79, 79, 79},    // Editbox border default color.
+            {100, 100, 100}, // Editbox border selected color.
+            {51, 51, 51},    // DDL combobox default color.
+            {69, 69, 69},    // DDL combobox active color.
+            {155, 155, 155}, // DDL combobox border color.
+            {32, 32, 32},    // DDL combobox default item background color.
+            {44, 44, 44},    // DDL combobox selected item background color.
+            {44, 44, 44},    // DDL combobox drop-down list window border color.
+            {162, 162, 162}, // DDL combobox default item text color.
+            {255, 255, 255}, // DDL combobox selected item text color.
+            {46, 46, 46},    // Scrollbar background color.
+            {77, 77, 77},    // Scrollbar thumb default color.
+            {94, 94, 94},    // Scrollbar thumb hover color.
+            {112, 112, 112}, // Scrollbar thumb down color.
+        }),
+        // Monokai theme.
+        MYTHEMETABLE::fromRGB({
+            {34, 31, 34},    // Primary color.
+            {45, 42, 46},    // Secondary color.
+            {25, 24, 26},    // Border active color.
+            {49, 47, 51},    // Border inactive color.
+            {231, 230, 229}, // Text active color.
+            {82, 76, 83},    // Text inactive color.
+            {231, 230, 229}, // Text highlight color.
+            {169, 220, 118}, // Focus color.
+            {45, 42, 46},    // Background color.
+            {34, 31, 34},    // Caption background color.
+            {147, 146, 147}, // Caption text active color.
+            {91, 89, 92},    // Caption text inactive color.
+            {232, 17, 35},   // Caption close button hover background color.
+            {152, 22, 34},   // Caption close button down background color.
+            {63, 61, 63},    // Caption maximize button hover background color.
+            {91, 89, 91},    // Caption maximize button down background color.
+            {63, 61, 63},    // Caption minimize button hover background color.
+            {91, 89, 91},    // Caption minimize button down background color.
+            {64, 62, 65},    // Standard button default color.
+            {91, 89, 92},    // Standard button hover color.
+            {101, 99, 102},  // Standard button down color.
+            {114, 112, 114}, // Standard button border default color.
+            {114, 112, 114}, // Standard button border hover color.
+            {114, 112, 114}, // Standard button border down color.
+            {64, 62, 65},    // Radio button primary color.
+            {91, 89, 92},    // Radio button hover state primary color.
+            {101, 99, 102},  // Radio button down state primary color.
+            {64, 62, 65},    // Radio button secondary color.
+            {91, 89, 92},    // Radio button hover state secondary color.
+            {101, 99, 102},  // Radio button down state secondary color.
+            {114, 112, 114}, // Radio button border color.
+            {114, 112, 114}, // Radio button hover state border color.
+            {114, 112, 114}, // Radio button down state border color.
+            {231, 230, 229}, // Selected radio button primary color.
+            {242, 241, 240}, // Selected radio button hover state primary color.
+            {255, 255, 255}, // Selected radio button down state primary color.
+            {64, 62, 65},    // Selected radio button secondary color.
+            {64, 62, 65},    // Selected radio button hover state secondary color.
+            {64, 62, 65},    // Selected radio button down state secondary color.
+            {114, 112, 114}, // Selected radio button border color.
+            {114, 112, 114}, // Selected radio button hover state border color.
+            {114, 112, 114}, // Selected radio button down state border color.
+            {64, 62, 65},    // Editbox color.
+            {64, 62, 65},    // Editbox border default color.
+            {114, 112, 114}, // Editbox border selected color.
+            {64, 62, 65},    // DDL combobox default color.
+            {91, 89, 92},    // DDL combobox active color.
+            {64, 62, 65},    // DDL combobox border color.
+            {64, 62, 65},    // DDL combobox default item background color.
+            {74, 72, 75},    // DDL combobox selected item background color.
+            {114, 112, 114}, // DDL combobox drop-down list window border color.
+            {237, 237, 235}, // DDL combobox default item text color.
+            {225, 216, 102}, // DDL combobox selected item text color.
+            {40, 37, 41},    // Scrollbar background color.
+            {59, 56, 60},    // Scrollbar thumb default color.
+            {78, 75, 79},    // Scrollbar thumb hover color.
+            {98, 95, 98},    // Scrollbar thumb down color.
+        }),
+};
+static_assert(sizeof(UI_BUILTIN_THEME_TABLES) / sizeof(MYTHEMETABLE) == UI_THEME_COUNT, "Every theme must have a built-in theme table.");
+static_assert(sizeof(MYTHEMEPACKHEADER) == 12, "The theme pack header must not contain padding.");
+
+/*********************************
+ * UI structures implementations *
+ *********************************/
+
+MYRGBA MYTHEMETABLE::getColor(MyThemeColor color) const
+{
+    size_t index = static_cast<size_t>(color);
+    return MYRGBA(this->red[index], this->green[index], this->blue[index], this->alpha[index]);
+}
 /******************************
  * UI classes implementations *
  ******************************/
 
 // [UIColors] class implementations:
 
+MyColor UIColors::*const UIColors::themeColorFields[UI_THEME_COLOR_COUNT] =
+    {
+        &UIColors::primary,
+        &UIColors::secondary,
+        &UIColors::borderActive,
+        &UIColors::borderInactive,
+        &UIColors::textActive,
+        &UIColors::textInactive,
+        &UIColors::textHighlight,
+        &UIColors::focus,
+        &UIColors::background,
+        &UIColors::captionBackground,
+        &UIColors::captionTextActive,
+        &UIColors::captionTextInactive,
+        &UIColors::closeButtonBackgroundOnHover,
+        &UIColors::closeButtonBackgroundOnActive,
+        &UIColors::maximizeButtonBackgroundOnHover,
+        &UIColors::maximizeButtonBackgroundOnActive,
+        &UIColors::minimizeButtonBackgroundOnHover,
+        &UIColors::minimizeButtonBackgroundOnActive,
+        &UIColors::standardButtonDefault,
+        &UIColors::standardButtonHover,
+        &UIColors::standardButtonActive,
+        &UIColors::standardButtonBorderDefault,
+        &UIColors::standardButtonBorderHover,
+        &UIColors::standardButtonBorderActive,
+        &UIColors::radioButtonPrimaryDefault,
+        &UIColors::radioButtonPrimaryHover,
+        &UIColors::radioButtonPrimaryActive,
+        &UIColors::radioButtonSecondaryDefault,
+        &UIColors::radioButtonSecondaryHover,
+        &UIColors::radioButtonSecondaryActive,
+        &UIColors::radioButtonBorderDefault,
+        &UIColors::radioButtonBorderHover,
+        &UIColors::radioButtonBorderActive,
+        &UIColors::selectedRadioButtonPrimaryDefault,
+        &UIColors::selectedRadioButtonPrimaryHover,
+        &UIColors::selectedRadioButtonPrimaryActive,
+        &UIColors::selectedRadioButtonSecondaryDefault,
+        &UIColors::selectedRadioButtonSecondaryHover,
+        &UIColors::selectedRadioButtonSecondaryActive,
+        &UIColors::selectedRadioButtonBorderDefault,
+        &UIColors::selectedRadioButtonBorderHover,
+        &UIColors::selectedRadioButtonBorderActive,
+        &UIColors::editbox,
+        &UIColors::editboxBorderDefault,
+        &UIColors::editboxBorderSelected,
+        &UIColors::ddlComboboxDefault,
+        &UIColors::ddlComboboxActive,
+        &UIColors::ddlComboboxBorder,
+        &UIColors::ddlComboboxItemBackground,
+        &UIColors::ddlComboboxSelectedItemBackground,
+        &UIColors::ddlComboboxDropdownlistBorder,
+        &UIColors::ddlComboboxItemTextDefault,
+        &UIColors::ddlComboboxItemTextSelected,
+        &UIColors::scrollbarBackground,
+        &UIColors::scrollbarThumbDefault,
+        &UIColors::scrollbarThumbHover,
+        &UIColors::scrollbarThumbDragging
+};
+
+const char *const UIColors::themeColorNames[UI_THEME_COLOR_COUNT] =
+    {
+        "Primary",
+        "Secondary",
+        "BorderActive",
+        "BorderInactive",
+        "TextActive",
+        "TextInactive",
+        "TextHighlight",
+        "Focus",
+        "Background",
+        "CaptionBackground",
+        "CaptionTextActive",
+        "CaptionTextInactive",
+        "CloseButtonBackgroundOnHover",
+        "CloseButtonBackgroundOnActive",
+        "MaximizeButtonBackgroundOnHover",
+        "MaximizeButtonBackgroundOnActive",
+        "MinimizeButtonBackgroundOnHover",
+        "MinimizeButtonBackgroundOnActive",
+        "StandardButtonDefault",
+        "StandardButtonHover",
+        "StandardButtonActive",
+        "StandardButtonBorderDefault",
+        "StandardButtonBorderHover",
+        "StandardButtonBorderActive",
+        "RadioButtonPrimaryDefault",
+        "RadioButtonPrimaryHover",
+        "RadioButtonPrimaryActive",
+        "RadioButtonSecondaryDefault",
+        "RadioButtonSecondaryHover",
+        "RadioButtonSecondaryActive",
+        "RadioButtonBorderDefault",
+        "RadioButtonBorderHover",
+        "RadioButtonBorderActive",
+        "SelectedRadioButtonPrimaryDefault",
+        "SelectedRadioButtonPrimaryHover",
+        "SelectedRadioButtonPrimaryActive",
+        "SelectedRadioButtonSecondaryDefault",
+        "SelectedRadioButtonSecondaryHover",
+        "SelectedRadioButtonSecondaryActive",
+        "SelectedRadioButtonBorderDefault",
+        "SelectedRadioButtonBorderHover",
+        "SelectedRadioButtonBorderActive",
+        "Editbox",
+        "EditboxBorderDefault",
+        "EditboxBorderSelected",
+        "DDLComboboxDefault",
+        "DDLComboboxActive",
+        "DDLComboboxBorder",
+        "DDLComboboxItemBackground",
+        "DDLComboboxSelectedItemBackground",
+        "DDLComboboxDropdownlistBorder",
+        "DDLComboboxItemTextDefault",
+        "DDLComboboxItemTextSelected",
+        "ScrollbarBackground",
+        "ScrollbarThumbDefault",
+        "ScrollbarThumbHover",
+        "ScrollbarThumbDragging"
+};
+
 UIColors::UIColors()
 {
     if (!UIColors::instanceExists)
@@ -26,104 +348,146 @@ UIColors::~UIColors()
 {
     UIColors::instanceExists = false;
 }
-bool UIColors::updateMainColors(MYRGBA primary, MYRGBA secondary, MYRGBA borderActive, MYRGBA borderInactive, MYRGBA textActive, MYRGBA textInactive, MYRGBA textHighlight, MYRGBA focus, MYRGBA background)
-{
-    if (!this->primary.update(primary) ||
-        !this->secondary.update(secondary) ||
-        !this->borderActive.update(borderActive) ||
-        !this->borderInactive.update(borderInactive) ||
-        !this->textActive.update(textActive) ||
-        !this->textInactive.update(textInactive) ||
-        !this->textHighlight.update(textHighlight) ||
-        !this->focus.update(focus) ||
-        !this->background.update(background))
-        return false;
+bool UIColors::updateColors(const MYTHEMETABLE &themeTable, std::bitset<UI_THEME_COLOR_COUNT> *pChangedColors)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (pChangedColors)
+            pChangedColors->reset();
 
-    return true;
-}
-bool UIColors::updateCaptionColors(MYRGBA captionBackground, MYRGBA captionTextActive, MYRGBA captionTextInactive, MYRGBA closeButtonBackgroundOnHover, MYRGBA closeButtonBackgroundOnActive, MYRGBA maximizeButtonBackgroundOnHover, MYRGBA maximizeButtonBackgroundOnActive, MYRGBA minimizeButtonBackgroundOnHover, MYRGBA minimizeButtonBackgroundOnActive)
-{
-    if (!this->captionBackground.update(captionBackground) ||
-        !this->captionTextActive.update(captionTextActive) ||
-        !this->captionTextInactive.update(captionTextInactive) ||
-        !this->closeButtonBackgroundOnHover.update(closeButtonBackgroundOnHover) ||
-        !this->closeButtonBackgroundOnActive.update(closeButtonBackgroundOnActive) ||
-        !this->maximizeButtonBackgroundOnHover.update(maximizeButtonBackgroundOnHover) ||
-        !this->maximizeButtonBackgroundOnActive.update(maximizeButtonBackgroundOnActive) ||
-        !this->minimizeButtonBackgroundOnHover.update(minimizeButtonBackgroundOnHover) ||
-        !this->minimizeButtonBackgroundOnActive.update(minimizeButtonBackgroundOnActive))
-        return false;
+        bool is_for_loop_failed = false;
+        for (size_t i = 0; i < UI_THEME_COLOR_COUNT; i++)
+        {
+            MyColor &color = this->*UIColors::themeColorFields[i];
+            MYRGBA rgba = themeTable.getColor(static_cast<MyThemeColor>(i));
+            if (color.getPackedRGBA() == MyColor::pack(rgba))
+                continue;
 
-    return true;
+            if (!color.update(rgba))
+            {
+                is_for_loop_failed = true;
+                break;
+            }
+            if (pChangedColors)
+                pChangedColors->set(i);
+        }
+        if (is_for_loop_failed)
+        {
+            error_message = "Failed to update the colors.";
+            break;
+        }
+
+        this->pThemeTable = &themeTable;
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'UIColors' | FUNC: 'updateColors()']", MyLogType::Error);
+
+    return are_all_operation_success;
 }
-bool UIColors::updateStandardButtonColors(MYRGBA standardButtonDefault, MYRGBA standardButtonHover, MYRGBA standardButtonActive, MYRGBA standardButtonBorderDefault, MYRGBA standardButtonBorderHover, MYRGBA standardButtonBorderActive)
+const MYTHEMETABLE *UIColors::getThemeTable()
 {
-    if (!this->standardButtonDefault.update(standardButtonDefault) ||
-        !this->standardButtonHover.update(standardButtonHover) ||
-        !this->standardButtonActive.update(standardButtonActive) ||
-        !this->standardButtonBorderDefault.update(standardButtonBorderDefault) ||
-        !this->standardButtonBorderHover.update(standardButtonBorderHover) ||
-        !this->standardButtonBorderActive.update(standardButtonBorderActive))
-        return false;
-
-    return true;
+    return this->pThemeTable;
 }
-bool UIColors::updateRadioButtonColors(MYRGBA radioButtonPrimaryDefault, MYRGBA radioButtonPrimaryHover, MYRGBA radioButtonPrimaryActive, MYRGBA radioButtonSecondaryDefault, MYRGBA radioButtonSecondaryHover, MYRGBA radioButtonSecondaryActive, MYRGBA radioButtonBorderDefault, MYRGBA radioButtonBorderHover, MYRGBA radioButtonBorderActive, MYRGBA selectedRadioButtonPrimaryDefault, MYRGBA selectedRadioButtonPrimaryHover, MYRGBA selectedRadioButtonPrimaryActive, MYRGBA selectedRadioButtonSecondaryDefault, MYRGBA selectedRadioButtonSecondaryHover, MYRGBA selectedRadioButtonSecondaryActive, MYRGBA selectedRadioButtonBorderDefault, MYRGBA selectedRadioButtonBorderHover, MYRGBA selectedRadioButtonBorderActive)
-{
-    if (!this->radioButtonPrimaryDefault.update(radioButtonPrimaryDefault) ||
-        !this->radioButtonPrimaryHover.update(radioButtonPrimaryHover) ||
-        !this->radioButtonPrimaryActive.update(radioButtonPrimaryActive) ||
-        !this->radioButtonSecondaryDefault.update(radioButtonSecondaryDefault) ||
-        !this->radioButtonSecondaryHover.update(radioButtonSecondaryHover) ||
-        !this->radioButtonSecondaryActive.update(radioButtonSecondaryActive) ||
-        !this->radioButtonBorderDefault.update(radioButtonBorderDefault) ||
-        !this->radioButtonBorderHover.update(radioButtonBorderHover) ||
-        !this->radioButtonBorderActive.update(radioButtonBorderActive) ||
-        !this->selectedRadioButtonPrimaryDefault.update(selectedRadioButtonPrimaryDefault) ||
-        !this->selectedRadioButtonPrimaryHover.update(selectedRadioButtonPrimaryHover) ||
-        !this->selectedRadioButtonPrimaryActive.update(selectedRadioButtonPrimaryActive) ||
-        !this->selectedRadioButtonSecondaryDefault.update(selectedRadioButtonSecondaryDefault) ||
-        !this->selectedRadioButtonSecondaryHover.update(selectedRadioButtonSecondaryHover) ||
-        !this->selectedRadioButtonSecondaryActive.update(selectedRadioButtonSecondaryActive) ||
-        !this->selectedRadioButtonBorderDefault.update(selectedRadioButtonBorderDefault) ||
-        !this->selectedRadioButtonBorderHover.update(selectedRadioButtonBorderHover) ||
-        !this->selectedRadioButtonBorderActive.update(selectedRadioButtonBorderActive))
-        return false;
+const MYTHEMETABLE *UIColors::getBuiltInThemeTable(MyTheme theme)
+{
+    size_t index = static_cast<size_t>(theme);
+    if (index >= UI_THEME_COUNT)
+        return nullptr;
 
-    return true;
+    return &UI_BUILTIN_THEME_TABLES[index];
 }
-bool UIColors::updateEditboxColors(MYRGBA editbox, MYRGBA editboxBorderDefault, MYRGBA editboxBorderSelected)
+bool UIColors::findThemeColor(const std::string &colorName, MyThemeColor &color)
 {
-    if (!this->editbox.update(editbox) ||
-        !this->editboxBorderDefault.update(editboxBorderDefault) ||
-        !this->editboxBorderSelected.update(editboxBorderSelected))
-        return false;
+    for (size_t i = 0; i < UI_THEME_COLOR_COUNT; i++)
+    {
+        if (!lstrcmpiA(colorName.c_str(), UIColors::themeColorNames[i]))
+        {
+            color = static_cast<MyThemeColor>(i);
+            return true;
+        }
+    }
 
-    return true;
+    return false;
 }
-bool UIColors::updateDDLComboboxColors(MYRGBA ddlComboboxDefault, MYRGBA ddlComboboxActive, MYRGBA ddlComboboxBorder, MYRGBA ddlComboboxItemBackground, MYRGBA ddlComboboxSelectedItemBackground, MYRGBA ddlComboboxDropdownlistBorder, MYRGBA ddlComboboxItemTextDefault, MYRGBA ddlComboboxItemTextSelected)
+bool UIColors::findThemeColor(const MyColor *pColor, MyThemeColor &color)
 {
-    if (!this->ddlComboboxDefault.update(ddlComboboxDefault) ||
-        !this->ddlComboboxActive.update(ddlComboboxActive) ||
-        !this->ddlComboboxBorder.update(ddlComboboxBorder) ||
-        !this->ddlComboboxItemBackground.update(ddlComboboxItemBackground) ||
-        !this->ddlComboboxSelectedItemBackground.update(ddlComboboxSelectedItemBackground) ||
-        !this->ddlComboboxDropdownlistBorder.update(ddlComboboxDropdownlistBorder) ||
-        !this->ddlComboboxItemTextDefault.update(ddlComboboxItemTextDefault) ||
-        !this->ddlComboboxItemTextSelected.update(ddlComboboxItemTextSelected))
+    if (!pColor)
         return false;
 
-    return true;
+    for (size_t i = 0; i < UI_THEME_COLOR_COUNT; i++)
+    {
+        if (&(this->*UIColors::themeColorFields[i]) == pColor)
+        {
+            color = static_cast<MyThemeColor>(i);
+            return true;
+        }
+    }
+
+    return false;
 }
-bool UIColors::updateScrollbarColors(MYRGBA scrollbarBackground, MYRGBA scrollbarThumbDefault, MYRGBA scrollbarThumbHover, MYRGBA scrollbarThumbDragging)
+std::bitset<UI_THEME_COLOR_COUNT> UIColors::getDependentColors(MyWindowType windowType)
 {
-    if (!this->scrollbarBackground.update(scrollbarBackground) ||
-        !this->scrollbarThumbDefault.update(scrollbarThumbDefault) ||
-        !this->scrollbarThumbHover.update(scrollbarThumbHover) ||
-        !this->scrollbarThumbDragging.update(scrollbarThumbDragging))
-        return false;
+    std::bitset<UI_THEME_COLOR_COUNT> colors;
+    auto add_colors = [&colors](std::initializer_list<MyThemeColor> colorList)
+    {
+        for (auto color : colorList)
+            colors.set(static_cast<size_t>(color));
+    };
 
-    return true;
+    switch (windowType)
+    {
+    case MyWindowType::StandardButton:
+    {
+        add_colors({MyThemeColor::Background, MyThemeColor::Focus, MyThemeColor::TextActive, MyThemeColor::TextHighlight,
+                    MyThemeColor::StandardButtonDefault, MyThemeColor::StandardButtonHover, MyThemeColor::StandardButtonActive,
+                    MyThemeColor::StandardButtonBorderDefault, MyThemeColor::StandardButtonBorderHover, MyThemeColor::StandardButtonBorderActive});
+        break;
+    }
+    case MyWindowType::ImageButton:
+    {
+        add_colors({MyThemeColor::Focus});
+        break;
+    }
+    case MyWindowType::RadioButton:
+    {
+        add_colors({MyThemeColor::Background, MyThemeColor::Focus, MyThemeColor::TextActive, MyThemeColor::TextHighlight});
+        for (size_t i = static_cast<size_t>(MyThemeColor::RadioButtonPrimaryDefault); i <= static_cast<size_t>(MyThemeColor::SelectedRadioButtonBorderActive); i++)
+            colors.set(i);
+        break;
+    }
+    case MyWindowType::Editbox:
+    {
+        add_colors({MyThemeColor::Background, MyThemeColor::TextActive,
+                    MyThemeColor::Editbox, MyThemeColor::EditboxBorderDefault, MyThemeColor::EditboxBorderSelected});
+        break;
+    }
+    case MyWindowType::DDLCombobox:
+    {
+        add_colors({MyThemeColor::Background, MyThemeColor::Focus, MyThemeColor::TextActive, MyThemeColor::TextInactive, MyThemeColor::TextHighlight});
+        for (size_t i = static_cast<size_t>(MyThemeColor::DDLComboboxDefault); i <= static_cast<size_t>(MyThemeColor::DDLComboboxItemTextSelected); i++)
+            colors.set(i);
+        break;
+    }
+    case MyWindowType::VerticalScrollbar:
+    {
+        add_colors({MyThemeColor::ScrollbarBackground, MyThemeColor::ScrollbarThumbDefault, MyThemeColor::ScrollbarThumbHover, MyThemeColor::ScrollbarThumbDragging});
+        break;
+    }
+    case MyWindowType::StandardText:
+    {
+        add_colors({MyThemeColor::Background, MyThemeColor::TextActive});
+        break;
+    }
+    default:
+        break;
+    }
+
+    return colors;
 }
 
 // [UIFonts] class implementations:
@@ -137,6 +501,7 @@ UIFonts::UIFonts()
         g_pApp->logger.writeLog("The UI font instance already exists.", "[CLASS: 'UIFonts' | FUNC: 'Constructor']", MyLogType::Error);
         throw std::runtime_error("The UI font instance already exists.");
     }
+    MY_STARTUP_PHASE(g_pApp->startupTracer, "Font registration");
 
     if (!this->addMemoryFontResource(this->hFontResourceUbuntu, IDR_FONT_UBUNTU))
     {
@@ -239,6 +604,7 @@ UIImages::UIImages()
 }
 UIImages::~UIImages()
 {
+    this->waitForPrefetch();
     UIImages::instanceExists = false;
 }
 bool UIImages::updateNonClientImages(MyTheme theme)
@@ -301,6 +667,122 @@ bool UIImages::updateNonClientImages(MyTheme theme)
 
     return are_all_operation_success;
 }
+bool UIImages::prefetchImages(MyTheme theme)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (this->pPrefetchCleanupGroup)
+        {
+            error_message = "The prefetch work is already submitted.";
+            break;
+        }
+
+        if (!this->updateNonClientImages(theme))
+        {
+            error_message = "Failed to update the non-client images.";
+            break;
+        }
+
+        // The images visible at startup, the hover and active states are decoded on first use.
+        MyWICBitmap *p_visible_images[] = {this->pWicBitmapMinimizeImageDefault,
+                                           this->pWicBitmapMaximizeImageDefault,
+                                           this->pWicBitmapCloseImageDefault,
+                                           this->pWicBitmapDDLComboboxArrow,
+                                           &this->wicBitmapAEDefault,
+                                           &this->wicBitmapPSDefault,
+                                           &this->wicBitmapAIDefault,
+                                           &this->wicBitmapMEDefault};
+
+        this->pPrefetchCleanupGroup = CreateThreadpoolCleanupGroup();
+        if (!this->pPrefetchCleanupGroup)
+        {
+            error_message = "Failed to create the thread pool cleanup group.";
+            break;
+        }
+        InitializeThreadpoolEnvironment(&this->prefetchEnvironment);
+        SetThreadpoolCallbackCleanupGroup(&this->prefetchEnvironment, this->pPrefetchCleanupGroup, nullptr);
+
+        // The images that fail to submit are decoded on first use instead.
+        QueryPerformanceCounter(&UIImages::prefetchStartTime);
+        UINT total_submitted_images = 0;
+        for (MyWICBitmap *p_image : p_visible_images)
+        {
+            if (p_image->isDecoded())
+                continue;
+
+            UIImages::totalPendingPrefetches.fetch_add(1, std::memory_order_relaxed);
+            if (!TrySubmitThreadpoolCallback(UIImages::prefetchCallback, p_image, &this->prefetchEnvironment))
+            {
+                UIImages::totalPendingPrefetches.fetch_sub(1, std::memory_order_relaxed);
+                continue;
+            }
+            total_submitted_images++;
+        }
+        MY_LOG(g_pApp->logger, MyLogType::Debug, "Image prefetch submitted:", "'{} image(s)'", total_submitted_images);
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'UIImages' | FUNC: 'prefetchImages()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+void UIImages::waitForPrefetch()
+{
+    if (!this->pPrefetchCleanupGroup)
+        return;
+
+    CloseThreadpoolCleanupGroupMembers(this->pPrefetchCleanupGroup, FALSE, nullptr);
+    CloseThreadpoolCleanupGroup(this->pPrefetchCleanupGroup);
+    DestroyThreadpoolEnvironment(&this->prefetchEnvironment);
+    this->pPrefetchCleanupGroup = nullptr;
+}
+UINT UIImages::addToSnapshot(MyStartupSnapshot &snapshot)
+{
+    this->waitForPrefetch();
+
+    MyWICBitmap *p_images[] = {&this->wicBitmapCrossGrey, &this->wicBitmapCrossWhite, &this->wicBitmapCrossBlack,
+                               &this->wicBitmapSquareGrey, &this->wicBitmapSquareWhite, &this->wicBitmapSquareBlack,
+                               &this->wicBitmapMinusGrey, &this->wicBitmapMinusWhite, &this->wicBitmapMinusBlack,
+                               &this->wicBitmapTriangleArrowLight, &this->wicBitmapTriangleArrowDark, &this->wicBitmapTriangleArrowMonokai,
+                               &this->wicBitmapAEDefault, &this->wicBitmapAEHover, &this->wicBitmapAEActive,
+                               &this->wicBitmapPSDefault, &this->wicBitmapPSHover, &this->wicBitmapPSActive,
+                               &this->wicBitmapAIDefault, &this->wicBitmapAIHover, &this->wicBitmapAIActive,
+                               &this->wicBitmapMEDefault, &this->wicBitmapMEHover, &this->wicBitmapMEActive};
+
+    UINT total_added_images = 0;
+    for (MyWICBitmap *p_image : p_images)
+    {
+        std::string pixels;
+        if (!p_image->copyPixels(pixels))
+            continue;
+
+        snapshot.addEntry(p_image->getSnapshotKey(), std::move(pixels));
+        total_added_images++;
+    }
+
+    return total_added_images;
+}
+void CALLBACK UIImages::prefetchCallback(PTP_CALLBACK_INSTANCE pInstance, PVOID pContext)
+{
+    // The WIC objects are free-threaded, the worker only has to join the multithreaded apartment.
+    HRESULT hr = CoInitializeEx(NULL, COINIT_MULTITHREADED);
+    static_cast<MyWICBitmap *>(pContext)->decode();
+    if (SUCCEEDED(hr))
+        CoUninitialize();
+
+    if (UIImages::totalPendingPrefetches.fetch_sub(1, std::memory_order_acq_rel) == 1)
+    {
+        LARGE_INTEGER frequency, prefetch_end;
+        QueryPerformanceFrequency(&frequency);
+        QueryPerformanceCounter(&prefetch_end);
+        DOUBLE latency = static_cast<DOUBLE>(prefetch_end.QuadPart - UIImages::prefetchStartTime.QuadPart) * 1000.0 / static_cast<DOUBLE>(frequency.QuadPart);
+        MY_LOG(g_pApp->logger, MyLogType::Debug, "Image prefetch completed:", "'{} ms, {} image(s) decoded so far'", latency, MyWICBitmap::getTotalDecodes());
+    }
+}
 
 // [UIMiscs] class implementations:
 
@@ -364,458 +846,683 @@ UIMiscs::~UIMiscs()
     UIMiscs::instanceExists = false;
 }
 
-// [UIManager] class implementations:
+// [MyThemePack] class implementations:
 
-UIManager::UIManager(MyGraphicEngine *pGraphic, HWND &hAppWindow)
-    : pGraphic(pGraphic), hAppWindow(hAppWindow)
+MyThemePack::MyThemePack() {}
+MyThemePack::~MyThemePack()
 {
-    if (!UIManager::instanceExists)
-        UIManager::instanceExists = true;
-    else
+    this->unload();
+}
+bool MyThemePack::load(const std::wstring &filePath)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
     {
-        g_pApp->logger.writeLog("The UI manager instance already exists.", "[CLASS: 'UIManager' | FUNC: 'Constructor']", MyLogType::Error);
-        throw std::runtime_error("The UI manager instance already exists.");
+        this->unload();
+
+        this->hFile = CreateFileW(filePath.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, nullptr);
+        if (this->hFile == INVALID_HANDLE_VALUE)
+        {
+            error_message = "Failed to open the theme pack file.";
+            break;
+        }
+
+        LARGE_INTEGER file_size;
+        if (!GetFileSizeEx(this->hFile, &file_size))
+        {
+            error_message = "Failed to retrieve the theme pack file size.";
+            break;
+        }
+        if (file_size.QuadPart < static_cast<LONGLONG>(sizeof(MYTHEMEPACKHEADER)))
+        {
+            error_message = "The theme pack file is too small.";
+            break;
+        }
+
+        this->hFileMapping = CreateFileMappingW(this->hFile, nullptr, PAGE_READONLY, 0, 0, nullptr);
+        if (!this->hFileMapping)
+        {
+            error_message = "Failed to create the theme pack file mapping object.";
+            break;
+        }
+
+        this->pView = static_cast<const BYTE *>(MapViewOfFile(this->hFileMapping, FILE_MAP_READ, 0, 0, 0));
+        if (!this->pView)
+        {
+            error_message = "Failed to map the theme pack file.";
+            break;
+        }
+
+        const MYTHEMEPACKHEADER *p_header = reinterpret_cast<const MYTHEMEPACKHEADER *>(this->pView);
+        if (p_header->signature != UI_THEMEPACK_SIGNATURE)
+        {
+            error_message = "The file is not a theme pack file.";
+            break;
+        }
+        if (p_header->version != UI_THEMEPACK_VERSION || p_header->colorCount != UI_THEME_COLOR_COUNT)
+        {
+            error_message = "The theme pack file version is not supported.";
+            break;
+        }
+        if (file_size.QuadPart != static_cast<LONGLONG>(sizeof(MYTHEMEPACKHEADER) + p_header->themeCount * sizeof(MYTHEMETABLE)))
+        {
+            error_message = "The theme pack file size doesn't match its header.";
+            break;
+        }
+        this->themeCount = p_header->themeCount;
+
+        are_all_operation_success = true;
     }
 
-    if (!pGraphic->isInitialized())
+    if (!are_all_operation_success)
     {
-        g_pApp->logger.writeLog("The graphic engine is not initialized.", "[CLASS: 'UIManager' | FUNC: 'UIManager()']", MyLogType::Error);
-        throw std::runtime_error("The graphic engine is not initialized.");
+        this->unload();
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyThemePack' | FUNC: 'load()']", MyLogType::Error);
     }
+
+    return are_all_operation_success;
 }
-UIManager::~UIManager() noexcept(false)
+void MyThemePack::unload()
 {
-    if (!this->pGraphic->isInitialized())
+    if (this->pView)
     {
-        g_pApp->logger.writeLog("The graphic engine is not initialized.", "[CLASS: 'UIManager' | FUNC: 'UIManager()']", MyLogType::Error);
-        throw std::runtime_error("The graphic engine is not initialized.");
+        UnmapViewOfFile(this->pView);
+        this->pView = nullptr;
+    }
+    if (this->hFileMapping)
+    {
+        CloseHandle(this->hFileMapping);
+        this->hFileMapping = nullptr;
+    }
+    if (this->hFile != INVALID_HANDLE_VALUE)
+    {
+        CloseHandle(this->hFile);
+        this->hFile = INVALID_HANDLE_VALUE;
     }
+    this->themeCount = 0;
+}
+bool MyThemePack::isLoaded()
+{
+    return this->pView != nullptr;
+}
+const MYTHEMETABLE *MyThemePack::getThemeTable(MyTheme theme)
+{
+    DWORD index = static_cast<DWORD>(theme);
+    if (!this->pView || index >= this->themeCount)
+        return nullptr;
 
-    UIManager::instanceExists = false;
+    return reinterpret_cast<const MYTHEMETABLE *>(this->pView + sizeof(MYTHEMEPACKHEADER)) + index;
 }
-bool UIManager::updateUITheme(MyTheme theme)
+bool MyThemePack::write(const std::wstring &filePath, const MYTHEMETABLE *pThemeTables, DWORD themeCount)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
     while (!are_all_operation_success)
     {
-        bool is_switch_success = false;
-        switch (theme)
+        if (!pThemeTables || !themeCount)
         {
-        case MyTheme::Light:
+            error_message = "Invalid parameter(s).";
+            break;
+        }
+
+        std::ofstream pack_file(filePath.c_str(), std::ios::binary | std::ios::trunc);
+        if (!pack_file.is_open())
         {
-            if (!this->colors.updateMainColors(MYRGBA(255, 255, 255),  // Primary color.
-                                               MYRGBA(255, 255, 255),  // Secondary color.
-                                               MYRGBA(64, 64, 64),     // Border active color.
-                                               MYRGBA(192, 192, 192),  // Border inactive color.
-                                               MYRGBA(0, 0, 0),        // Text active color.
-                                               MYRGBA(153, 153, 153),  // Text inactive color.
-                                               MYRGBA(0, 0, 0),        // Text highlight color.
-                                               MYRGBA(0, 162, 237),    // Focus color.
-                                               MYRGBA(240, 240, 240))) // Background color.
-            {
-                error_message = "Failed to update the main colors.";
-                break;
-            }
+            error_message = "Failed to create the theme pack file.";
+            break;
+        }
 
-            if (!this->colors.updateCaptionColors(MYRGBA(220, 220, 220),  // Caption background color.
-                                                  MYRGBA(0, 0, 0),        // Caption text active color.
-                                                  MYRGBA(153, 153, 153),  // Caption text inactive color.
-                                                  MYRGBA(255, 89, 89),    // Caption close button hover background color.
-                                                  MYRGBA(255, 89, 89),    // Caption close button down background color.
-                                                  MYRGBA(205, 206, 206),  // Caption maximize button hover background color.
-                                                  MYRGBA(205, 206, 206),  // Caption maximize button down background color.
-                                                  MYRGBA(205, 206, 206),  // Caption minimize button hover background color.
-                                                  MYRGBA(205, 206, 206))) // Caption minimize button down background color.
-            {
-                error_message = "Failed to update the caption colors.";
-                break;
-            }
+        MYTHEMEPACKHEADER header;
+        header.signature = UI_THEMEPACK_SIGNATURE;
+        header.version = UI_THEMEPACK_VERSION;
+        header.colorCount = static_cast<WORD>(UI_THEME_COLOR_COUNT);
+        header.themeCount = themeCount;
+        pack_file.write(reinterpret_cast<const char *>(&header), sizeof(header));
+        pack_file.write(reinterpret_cast<const char *>(pThemeTables), themeCount * sizeof(MYTHEMETABLE));
+        pack_file.close();
+        if (pack_file.fail())
+        {
+            error_message = "Failed to write the theme pack file.";
+            break;
+        }
 
-            if (!this->colors.updateStandardButtonColors(MYRGBA(225, 225, 225), // Standard button default color.
-                                                         MYRGBA(229, 241, 251), // Standard button hover color.
-                                                         MYRGBA(204, 228, 247), // Standard button down color.
-                                                         MYRGBA(172, 172, 172), // Standard button border default color.
-                                                         MYRGBA(0, 120, 215),   // Standard button border hover color.
-                                                         MYRGBA(0, 84, 153)))   // Standard button border down color.
-            {
-                error_message = "Failed to update the standard button colors.";
-                break;
-            }
+        are_all_operation_success = true;
+    }
 
-            if (!this->colors.updateRadioButtonColors(MYRGBA(255, 255, 255), // Radio button primary color.
-                                                      MYRGBA(255, 255, 255), // Radio button hover state primary color.
-                                                      MYRGBA(204, 228, 247), // Radio button down state primary color.
-                                                      MYRGBA(255, 255, 255), // Radio button secondary color.
-                                                      MYRGBA(255, 255, 255), // Radio button hover state secondary color.
-                                                      MYRGBA(204, 228, 247), // Radio button down state secondary color.
-                                                      MYRGBA(51, 51, 51),    // Radio button border color.
-                                                      MYRGBA(0, 120, 215),   // Radio button hover state border color.
-                                                      MYRGBA(0, 84, 153),    // Radio button down state border color.
-                                                      MYRGBA(51, 51, 51),    // Selected radio button primary color.
-                                                      MYRGBA(0, 120, 215),   // Selected radio button hover state primary color.
-                                                      MYRGBA(0, 84, 153),    // Selected radio button down state primary color.
-                                                      MYRGBA(255, 255, 255), // Selected radio button secondary color.
-                                                      MYRGBA(255, 255, 255), // Selected radio button hover state secondary color.
-                                                      MYRGBA(204, 228, 247), // Selected radio button down state secondary color.
-                                                      MYRGBA(51, 51, 51),    // Selected radio button border color.
-                                                      MYRGBA(0, 120, 215),   // Selected radio button hover state border color.
-                                                      MYRGBA(0, 84, 153)))   // Selected radio button down state border color.
-            {
-                error_message = "Failed to update the radio button colors.";
-                break;
-            }
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyThemePack' | FUNC: 'write()']", MyLogType::Error);
 
-            if (!this->colors.updateEditboxColors(MYRGBA(255, 255, 255), // Editbox color.
-                                                  MYRGBA(122, 122, 122), // Editbox border default color.
-                                                  MYRGBA(0, 120, 215)))  // Editbox border selected color.
-            {
-                error_message = "Failed to update the editbox colors.";
-                break;
-            }
+    return are_all_operation_success;
+}
 
-            if (!this->colors.updateDDLComboboxColors(MYRGBA(225, 225, 225),  // DDL combobox default color.
-                                                      MYRGBA(229, 241, 251),  // DDL combobox active color.
-                                                      MYRGBA(172, 172, 172),  // DDL combobox border color.
-                                                      MYRGBA(255, 255, 255),  // DDL combobox default item background color.
-                                                      MYRGBA(0, 120, 215),    // DDL combobox selected item background color.
-                                                      MYRGBA(0, 120, 215),    // DDL combobox drop-down list window border color.
-                                                      MYRGBA(0, 0, 0),        // DDL combobox default item text color.
-                                                      MYRGBA(255, 255, 255))) // DDL combobox selected item text color.
-            {
-                error_message = "Failed to update the drop-down list combobox colors.";
-                break;
-            }
+// [MyPerformanceHud] class implementations:
+
+MyPerformanceHud::MyPerformanceHud()
+{
+    LARGE_INTEGER frequency;
+    if (QueryPerformanceFrequency(&frequency) && frequency.QuadPart > 0)
+        this->counterFrequency = frequency.QuadPart;
+}
+void MyPerformanceHud::setEnabled(bool isEnabled)
+{
+    if (isEnabled == this->isRecording)
+        return;
+
+    if (isEnabled)
+    {
+        this->totalPaints = 0;
+        this->totalPaintedPixels = 0;
+        this->totalPaintTime = 0;
+        this->maximumPaintTime = 0;
+        this->totalAnimationTicks = 0;
+        this->totalHudTime = 0;
+        this->lastSampleTime = MyProfiler::getTime();
+        this->lastTotalTextLayouts = g_pApp->pGraphic->d2d1Engine().getTotalTextLayouts();
+        this->lastSample = {};
+        this->totalSamples = 0;
+    }
+    else
+    {
+        this->pTextFormat.reset();
+        this->pSolidColorBrush.reset();
+        this->pRenderTarget.reset();
+    }
+
+    this->isRecording = isEnabled;
+}
+void MyPerformanceHud::recordPaint(const RECT &paintRect, LONGLONG startTime)
+{
+    LONGLONG paint_time = MyProfiler::getTime() - startTime;
+    this->totalPaints++;
+    this->totalPaintTime += paint_time;
+    if (paint_time > this->maximumPaintTime)
+        this->maximumPaintTime = paint_time;
+    if (paintRect.right > paintRect.left && paintRect.bottom > paintRect.top)
+        this->totalPaintedPixels += static_cast<UINT64>(paintRect.right - paintRect.left) * static_cast<UINT64>(paintRect.bottom - paintRect.top);
+}
+void MyPerformanceHud::sample()
+{
+    if (!this->isRecording)
+        return;
+
+    LONGLONG current_time = MyProfiler::getTime();
+    DOUBLE elapsed_seconds = static_cast<DOUBLE>(current_time - this->lastSampleTime) / static_cast<DOUBLE>(this->counterFrequency);
+    if (elapsed_seconds <= 0.0)
+        return;
+    DOUBLE ticks_per_millisecond = static_cast<DOUBLE>(this->counterFrequency) / 1000.0;
+    UINT64 total_text_layouts = g_pApp->pGraphic->d2d1Engine().getTotalTextLayouts();
+
+    MYPERFORMANCEHUDSAMPLE &sample = this->lastSample;
+    sample.paintsPerSecond = static_cast<DOUBLE>(this->totalPaints) / elapsed_seconds;
+    sample.averagePaintTime = (this->totalPaints ? static_cast<DOUBLE>(this->totalPaintTime) / static_cast<DOUBLE>(this->totalPaints) / ticks_per_millisecond : 0.0);
+    sample.maximumPaintTime = static_cast<DOUBLE>(this->maximumPaintTime) / ticks_per_millisecond;
+    sample.pixelsPerSecond = static_cast<DOUBLE>(this->totalPaintedPixels) / elapsed_seconds;
+    sample.animationTicksPerSecond = static_cast<DOUBLE>(this->totalAnimationTicks) / elapsed_seconds;
+    sample.textLayoutsPerSecond = static_cast<DOUBLE>(total_text_layouts - this->lastTotalTextLayouts) / elapsed_seconds;
+    sample.logQueueDepth = g_pApp->logger.getQueueDepth();
+    sample.liveRenderTargets = Deleter::getResourceCounter(MyResourceType::RenderTarget).liveResources;
+    sample.liveSolidColorBrushes = Deleter::getResourceCounter(MyResourceType::SolidColorBrush).liveResources;
+    sample.liveBitmaps = Deleter::getResourceCounter(MyResourceType::Bitmap).liveResources;
+    sample.liveTextFormats = Deleter::getResourceCounter(MyResourceType::TextFormat).liveResources;
+    this->averagePaintTimes[this->totalSamples % MyPerformanceHud::sparklineLength] = static_cast<FLOAT>(sample.averagePaintTime);
+    this->totalSamples++;
+
+    // The HUD cost includes the time spent in this function.
+    LONGLONG end_time = MyProfiler::getTime();
+    this->totalHudTime += end_time - current_time;
+    sample.hudTimePerSecond = static_cast<DOUBLE>(this->totalHudTime) / ticks_per_millisecond * 1000.0 / elapsed_seconds;
+
+    this->totalPaints = 0;
+    this->totalPaintedPixels = 0;
+    this->totalPaintTime = 0;
+    this->maximumPaintTime = 0;
+    this->totalAnimationTicks = 0;
+    this->totalHudTime = 0;
+    this->lastSampleTime = end_time;
+    this->lastTotalTextLayouts = total_text_layouts;
+}
+bool MyPerformanceHud::draw(HDC hdc, const RECT &rect)
+{
+    LONGLONG start_time = MyProfiler::getTime();
+
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        if (!this->isRecording)
+        {
+            error_message = "The performance HUD is disabled.";
+            break;
+        }
 
-            if (!this->colors.updateScrollbarColors(MYRGBA(230, 230, 230),  // Scrollbar background color.
-                                                    MYRGBA(194, 195, 201),  // Scrollbar thumb default color.
-                                                    MYRGBA(174, 175, 180),  // Scrollbar thumb hover color.
-                                                    MYRGBA(155, 156, 160))) // Scrollbar thumb down color.
+        USHORT paint_attempts = 1;
+        bool is_drawn = false;
+        while (!is_drawn)
+        {
+            if (!this->pRenderTarget && !this->createDeviceResources())
             {
-                error_message = "Failed to update the scrollbar colors.";
+                error_message = "Failed to create the device resources.";
                 break;
             }
 
-            if (!this->images.updateNonClientImages(theme))
+            auto &p_rendertarget = *this->pRenderTarget;
+            auto &p_brush = *this->pSolidColorBrush;
+            HRESULT hr = p_rendertarget->BindDC(hdc, &rect);
+            if (FAILED(hr))
             {
-                error_message = "Failed to update the non-client images.";
+                error_message = "Failed to bind the render target to the HUD device context.";
                 break;
             }
 
-            if (this->miscs.pMinimizeButton)
+            const MYPERFORMANCEHUDSAMPLE &sample = this->lastSample;
+            WCHAR text[512];
+            swprintf(text, sizeof(text) / sizeof(WCHAR),
+                     L"Frame   %6.2f ms avg %6.2f ms max\n"
+                     L"Paints  %6.1f /s  %8.2f Mpx/s\n"
+                     L"Anim    %6.1f ticks/s\n"
+                     L"Layouts %6.1f /s (uncached)\n"
+                     L"D2D     RT %llu Brush %llu Bmp %llu Fmt %llu\n"
+                     L"Log     %llu queued\n"
+                     L"HUD     %6.1f us/s",
+                     sample.averagePaintTime, sample.maximumPaintTime,
+                     sample.paintsPerSecond, sample.pixelsPerSecond / 1000000.0,
+                     sample.animationTicksPerSecond,
+                     sample.textLayoutsPerSecond,
+                     sample.liveRenderTargets, sample.liveSolidColorBrushes, sample.liveBitmaps, sample.liveTextFormats,
+                     static_cast<unsigned long long>(sample.logQueueDepth),
+                     sample.hudTimePerSecond);
+
+            FLOAT width = static_cast<FLOAT>(rect.right - rect.left);
+            FLOAT height = static_cast<FLOAT>(rect.bottom - rect.top);
+            D2D1_RECT_F d2d1_rect_text = D2D1::RectF(6.0f, 4.0f, width - 6.0f, height - 44.0f);
+            D2D1_RECT_F d2d1_rect_sparkline = D2D1::RectF(6.0f, height - 40.0f, width - 6.0f, height - 6.0f);
+
+            p_rendertarget->BeginDraw();
+
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMinimizeButton->hWnd());
-                if (p_subclass)
+                // Draw the background and the statistics.
+                p_rendertarget->Clear(D2D1::ColorF(0x101010));
+                p_brush->SetColor(D2D1::ColorF(0xE0E0E0));
+                p_rendertarget->DrawText(text, static_cast<UINT32>(wcslen(text)), *this->pTextFormat, d2d1_rect_text, p_brush);
+
+                // Draw the sparkline of the average frame paint times, scaled to twice the frame time budget.
+                FLOAT scale_maximum = MyPerformanceHud::frameTimeBudget * 2.0f;
+                FLOAT sparkline_height = d2d1_rect_sparkline.bottom - d2d1_rect_sparkline.top;
+                FLOAT step = (d2d1_rect_sparkline.right - d2d1_rect_sparkline.left) / static_cast<FLOAT>(MyPerformanceHud::sparklineLength - 1);
+                FLOAT budget_y = d2d1_rect_sparkline.bottom - sparkline_height * (MyPerformanceHud::frameTimeBudget / scale_maximum);
+                p_brush->SetColor(D2D1::ColorF(0x606060));
+                p_rendertarget->DrawRectangle(d2d1_rect_sparkline, p_brush);
+                p_brush->SetColor(D2D1::ColorF(0xC04040));
+                p_rendertarget->DrawLine(D2D1::Point2F(d2d1_rect_sparkline.left, budget_y), D2D1::Point2F(d2d1_rect_sparkline.right, budget_y), p_brush);
+
+                size_t total_points = std::min(this->totalSamples, MyPerformanceHud::sparklineLength);
+                size_t first_sample = this->totalSamples - total_points;
+                p_brush->SetColor(D2D1::ColorF(0x40C080));
+                for (size_t i = 1; i < total_points; i++)
                 {
-                    p_subclass->imageConfig.pImageDefault = this->images.pWicBitmapMinimizeImageDefault;
-                    p_subclass->imageConfig.pImageHover = this->images.pWicBitmapMinimizeImageHover;
-                    p_subclass->imageConfig.pImageActive = this->images.pWicBitmapMinimizeImageActive;
+                    FLOAT previous_time = std::min(this->averagePaintTimes[(first_sample + i - 1) % MyPerformanceHud::sparklineLength], scale_maximum);
+                    FLOAT current_time = std::min(this->averagePaintTimes[(first_sample + i) % MyPerformanceHud::sparklineLength], scale_maximum);
+                    FLOAT x = d2d1_rect_sparkline.right - step * static_cast<FLOAT>(total_points - 1 - i);
+                    p_rendertarget->DrawLine(D2D1::Point2F(x - step, d2d1_rect_sparkline.bottom - sparkline_height * (previous_time / scale_maximum)),
+                                             D2D1::Point2F(x, d2d1_rect_sparkline.bottom - sparkline_height * (current_time / scale_maximum)), p_brush);
                 }
             }
-            if (this->miscs.pMaximizeButton)
+
+            hr = p_rendertarget->EndDraw();
+            if (hr == static_cast<long int>(D2DERR_RECREATE_TARGET))
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMaximizeButton->hWnd());
-                if (p_subclass)
+                this->pRenderTarget.reset();
+                if (paint_attempts > 10)
                 {
-                    p_subclass->imageConfig.pImageDefault = this->images.pWicBitmapMaximizeImageDefault;
-                    p_subclass->imageConfig.pImageHover = this->images.pWicBitmapMaximizeImageHover;
-                    p_subclass->imageConfig.pImageActive = this->images.pWicBitmapMaximizeImageActive;
+                    error_message = "Failed to create the device resources after 10 attempts.";
+                    break;
                 }
+                paint_attempts++;
+                continue;
             }
-            if (this->miscs.pCloseButton)
+            else if (FAILED(hr))
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pCloseButton->hWnd());
-                if (p_subclass)
-                {
-                    p_subclass->imageConfig.pImageDefault = this->images.pWicBitmapCloseImageDefault;
-                    p_subclass->imageConfig.pImageHover = this->images.pWicBitmapCloseImageHover;
-                    p_subclass->imageConfig.pImageActive = this->images.pWicBitmapCloseImageActive;
-                }
+                error_message = "Failed to end drawing.";
+                break;
             }
 
-            is_switch_success = true;
+            is_drawn = true;
+        }
+        if (!is_drawn)
+            break;
+
+        are_all_operation_success = true;
+    }
+
+    this->totalHudTime += MyProfiler::getTime() - start_time;
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyPerformanceHud' | FUNC: 'draw()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool MyPerformanceHud::createDeviceResources()
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        this->pTextFormat.reset();
+        this->pSolidColorBrush.reset();
+        this->pRenderTarget.reset(new ID2D1DCRenderTarget *(nullptr));
+        if (!g_pApp->pGraphic->d2d1Engine().createDCRenderTarget(*this->pRenderTarget))
+        {
+            this->pRenderTarget.reset();
+            error_message = "Failed to create the HUD render target.";
             break;
         }
-        case MyTheme::Dark:
+
+        this->pSolidColorBrush.reset(new ID2D1SolidColorBrush *(nullptr));
+        HRESULT hr = (*this->pRenderTarget)->CreateSolidColorBrush(D2D1::ColorF(0xE0E0E0), Deleter::track(this->pSolidColorBrush));
+        if (FAILED(hr))
         {
-            if (!this->colors.updateMainColors(MYRGBA(0, 0, 0),       // Primary color.
-                                               MYRGBA(32, 32, 32),    // Secondary color.
-                                               MYRGBA(48, 48, 48),    // Border active color.
-                                               MYRGBA(57, 57, 57),    // Border inactive color.
-                                               MYRGBA(216, 222, 233), // Text active color.
-                                               MYRGBA(162, 162, 162), // Text inactive color.
-                                               MYRGBA(216, 222, 233), // Text highlight color.
-                                               MYRGBA(0, 162, 237),   // Focus color.
-                                               MYRGBA(32, 32, 32)))   // Background color.
-            {
-                error_message = "Failed to update the main colors.";
-                break;
-            }
+            this->pRenderTarget.reset();
+            error_message = "Failed to create the HUD brush.";
+            break;
+        }
 
-            if (!this->colors.updateCaptionColors(MYRGBA(0, 0, 0),       // Caption background color.
-                                                  MYRGBA(216, 222, 233), // Caption text active color.
-                                                  MYRGBA(162, 162, 162), // Caption text inactive color.
-                                                  MYRGBA(232, 17, 35),   // Caption close button hover background color.
-                                                  MYRGBA(232, 17, 35),   // Caption close button down background color.
-                                                  MYRGBA(57, 57, 57),    // Caption maximize button hover background color.
-                                                  MYRGBA(57, 57, 57),    // Caption maximize button down background color.
-                                                  MYRGBA(57, 57, 57),    // Caption minimize button hover background color.
-                                                  MYRGBA(57, 57, 57)))   // Caption minimize button down background color.
-            {
-                error_message = "Failed to update the caption colors.";
-                break;
-            }
+        this->pTextFormat.reset(new IDWriteTextFormat *(nullptr));
+        if (!g_pApp->pGraphic->d2d1Engine().createTextFormat(*this->pTextFormat, L"Consolas", 12.0f))
+        {
+            this->pRenderTarget.reset();
+            error_message = "Failed to create the HUD text format.";
+            break;
+        }
 
-            if (!this->colors.updateStandardButtonColors(MYRGBA(51, 51, 51),     // Standard button default color.
-                                                         MYRGBA(69, 69, 69),     // Standard button hover color.
-                                                         MYRGBA(102, 102, 102),  // Standard button down color.
-                                                         MYRGBA(155, 155, 155),  // Standard button border default color.
-                                                         MYRGBA(155, 155, 155),  // Standard button border hover color.
-                                                         MYRGBA(155, 155, 155))) // Standard button border down color.
-            {
-                error_message = "Failed to update the standard button colors.";
-                break;
-            }
+        are_all_operation_success = true;
+    }
 
-            if (!this->colors.updateRadioButtonColors(MYRGBA(51, 51, 51),     // Radio button primary color.
-                                                      MYRGBA(69, 69, 69),     // Radio button hover state primary color.
-                                                      MYRGBA(87, 87, 87),     // Radio button down state primary color.
-                                                      MYRGBA(51, 51, 51),     // Radio button secondary color.
-                                                      MYRGBA(69, 69, 69),     // Radio button hover state secondary color.
-                                                      MYRGBA(87, 87, 87),     // Radio button down state secondary color.
-                                                      MYRGBA(155, 155, 155),  // Radio button border color.
-                                                      MYRGBA(155, 155, 155),  // Radio button hover state border color.
-                                                      MYRGBA(155, 155, 155),  // Radio button down state border color.
-                                                      MYRGBA(207, 207, 207),  // Selected radio button primary color.
-                                                      MYRGBA(225, 225, 225),  // Selected radio button hover state primary color.
-                                                      MYRGBA(250, 250, 250),  // Selected radio button down state primary color.
-                                                      MYRGBA(51, 51, 51),     // Selected radio button secondary color.
-                                                      MYRGBA(51, 51, 51),     // Selected radio button hover state secondary color.
-                                                      MYRGBA(51, 51, 51),     // Selected radio button down state secondary color.
-                                                      MYRGBA(155, 155, 155),  // Selected radio button border color.
-                                                      MYRGBA(155, 155, 155),  // Selected radio button hover state border color.
-                                                      MYRGBA(155, 155, 155))) // Selected radio button down state border color.
-            {
-                error_message = "Failed to update the radio button colors.";
-                break;
-            }
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyPerformanceHud' | FUNC: 'createDeviceResources()']", MyLogType::Error);
 
-            if (!this->colors.updateEditboxColors(MYRGBA(48, 48, 48),     // Editbox color.
-                                                  MYRGBA(79, 79, 79),     // Editbox border default color.
-                                                  MYRGBA(100, 100, 100))) // Editbox border selected color.
-            {
-                error_message = "Failed to update the editbox colors.";
-                break;
-            }
+    return are_all_operation_success;
+}
 
-            if (!this->colors.updateDDLComboboxColors(MYRGBA(51, 51, 51),     // DDL combobox default color.
-                                                      MYRGBA(69, 69, 69),     // DDL combobox active color.
-                                                      MYRGBA(155, 155, 155),  // DDL combobox border color.
-                                                      MYRGBA(32, 32, 32),     // DDL combobox default item background color.
-                                                      MYRGBA(44, 44, 44),     // DDL combobox selected item background color.
-                                                      MYRGBA(44, 44, 44),     // DDL combobox drop-down list window border color.
-                                                      MYRGBA(162, 162, 162),  // DDL combobox default item text color.
-                                                      MYRGBA(255, 255, 255))) // DDL combobox selected item text color.
-            {
-                error_message = "Failed to update the drop-down list combobox colors.";
-                break;
-            }
+// [UIManager] class implementations:
 
-            if (!this->colors.updateScrollbarColors(MYRGBA(46, 46, 46),     // Scrollbar background color.
-                                                    MYRGBA(77, 77, 77),     // Scrollbar thumb default color.
-                                                    MYRGBA(94, 94, 94),     // Scrollbar thumb hover color.
-                                                    MYRGBA(112, 112, 112))) // Scrollbar thumb down color.
-            {
-                error_message = "Failed to update the scrollbar colors.";
-                break;
-            }
+UIManager::UIManager(MyGraphicEngine *pGraphic, HWND &hAppWindow)
+    : pGraphic(pGraphic), hAppWindow(hAppWindow)
+{
+    if (!UIManager::instanceExists)
+        UIManager::instanceExists = true;
+    else
+    {
+        g_pApp->logger.writeLog("The UI manager instance already exists.", "[CLASS: 'UIManager' | FUNC: 'Constructor']", MyLogType::Error);
+        throw std::runtime_error("The UI manager instance already exists.");
+    }
 
-            if (!this->images.updateNonClientImages(theme))
-            {
-                error_message = "Failed to update the non-client images.";
-                break;
-            }
+    if (!pGraphic->isInitialized())
+    {
+        g_pApp->logger.writeLog("The graphic engine is not initialized.", "[CLASS: 'UIManager' | FUNC: 'UIManager()']", MyLogType::Error);
+        throw std::runtime_error("The graphic engine is not initialized.");
+    }
+}
+UIManager::~UIManager() noexcept(false)
+{
+    if (!this->pGraphic->isInitialized())
+    {
+        g_pApp->logger.writeLog("The graphic engine is not initialized.", "[CLASS: 'UIManager' | FUNC: 'UIManager()']", MyLogType::Error);
+        throw std::runtime_error("The graphic engine is not initialized.");
+    }
 
-            if (this->miscs.pMinimizeButton)
+    UIManager::instanceExists = false;
+}
+bool UIManager::updateUITheme(MyTheme theme, std::bitset<UI_THEME_COLOR_COUNT> *pChangedColors)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        const MYTHEMETABLE *p_theme_table = this->resolveThemeTable(theme);
+        if (!p_theme_table)
+        {
+            error_message = "Unknown theme.";
+            break;
+        }
+
+        if (!this->colors.updateColors(*p_theme_table, pChangedColors))
+        {
+            error_message = "Failed to update the colors.";
+            break;
+        }
+
+        if (!this->images.updateNonClientImages(theme))
+        {
+            error_message = "Failed to update the non-client images.";
+            break;
+        }
+
+        if (this->miscs.pMinimizeButton)
+        {
+            auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMinimizeButton->hWnd());
+            if (p_subclass)
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMinimizeButton->hWnd());
-                if (p_subclass)
-                {
-                    p_subclass->imageConfig.pImageDefault = &this->images.wicBitmapMinusGrey;
-                    p_subclass->imageConfig.pImageHover = &this->images.wicBitmapMinusWhite;
-                    p_subclass->imageConfig.pImageActive = &this->images.wicBitmapMinusWhite;
-                }
+                p_subclass->imageConfig.pImageDefault = this->images.pWicBitmapMinimizeImageDefault;
+                p_subclass->imageConfig.pImageHover = this->images.pWicBitmapMinimizeImageHover;
+                p_subclass->imageConfig.pImageActive = this->images.pWicBitmapMinimizeImageActive;
             }
-            if (this->miscs.pMaximizeButton)
+        }
+        if (this->miscs.pMaximizeButton)
+        {
+            auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMaximizeButton->hWnd());
+            if (p_subclass)
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMaximizeButton->hWnd());
-                if (p_subclass)
-                {
-                    p_subclass->imageConfig.pImageDefault = &this->images.wicBitmapSquareGrey;
-                    p_subclass->imageConfig.pImageHover = &this->images.wicBitmapSquareWhite;
-                    p_subclass->imageConfig.pImageActive = &this->images.wicBitmapSquareWhite;
-                }
+                p_subclass->imageConfig.pImageDefault = this->images.pWicBitmapMaximizeImageDefault;
+                p_subclass->imageConfig.pImageHover = this->images.pWicBitmapMaximizeImageHover;
+                p_subclass->imageConfig.pImageActive = this->images.pWicBitmapMaximizeImageActive;
             }
-            if (this->miscs.pCloseButton)
+        }
+        if (this->miscs.pCloseButton)
+        {
+            auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pCloseButton->hWnd());
+            if (p_subclass)
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pCloseButton->hWnd());
-                if (p_subclass)
-                {
-                    p_subclass->imageConfig.pImageDefault = &this->images.wicBitmapCrossGrey;
-                    p_subclass->imageConfig.pImageHover = &this->images.wicBitmapCrossWhite;
-                    p_subclass->imageConfig.pImageActive = &this->images.wicBitmapCrossWhite;
-                }
+                p_subclass->imageConfig.pImageDefault = this->images.pWicBitmapCloseImageDefault;
+                p_subclass->imageConfig.pImageHover = this->images.pWicBitmapCloseImageHover;
+                p_subclass->imageConfig.pImageActive = this->images.pWicBitmapCloseImageActive;
             }
+        }
+
+        are_all_operation_success = true;
+    }
 
-            is_switch_success = true;
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'UIManager' | FUNC: 'updateUITheme()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
+bool UIManager::beginThemeTransition(MyTheme theme)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        const MYTHEMETABLE *p_current_theme_table = this->colors.getThemeTable();
+        if (!p_current_theme_table)
+        {
+            error_message = "The UI colors are not initialized yet.";
             break;
         }
-        case MyTheme::Monokai:
+
+        // Copy the current table before resolving the target, the current table may be the overridden table (rewritten by the resolve)
+        // or the frame table of an in-progress transition.
+        this->transitionFromTable = *p_current_theme_table;
+        const MYTHEMETABLE *p_theme_table = this->resolveThemeTable(theme);
+        if (!p_theme_table)
         {
-            if (!this->colors.updateMainColors(MYRGBA(34, 31, 34),    // Primary color.
-                                               MYRGBA(45, 42, 46),    // Secondary color.
-                                               MYRGBA(25, 24, 26),    // Border active color.
-                                               MYRGBA(49, 47, 51),    // Border inactive color.
-                                               MYRGBA(231, 230, 229), // Text active color.
-                                               MYRGBA(82, 76, 83),    // Text inactive color.
-                                               MYRGBA(231, 230, 229), // Text highlight color.
-                                               MYRGBA(169, 220, 118), // Focus color.
-                                               MYRGBA(45, 42, 46)))   // Background color.
-            {
-                error_message = "Failed to update the main colors.";
-                break;
-            }
+            error_message = "Unknown theme.";
+            break;
+        }
+        this->transitionToTable = *p_theme_table;
 
-            if (!this->colors.updateCaptionColors(MYRGBA(34, 31, 34),    // Caption background color.
-                                                  MYRGBA(147, 146, 147), // Caption text active color.
-                                                  MYRGBA(91, 89, 92),    // Caption text inactive color.
-                                                  MYRGBA(232, 17, 35),   // Caption close button hover background color.
-                                                  MYRGBA(152, 22, 34),   // Caption close button down background color.
-                                                  MYRGBA(63, 61, 63),    // Caption maximize button hover background color.
-                                                  MYRGBA(91, 89, 91),    // Caption maximize button down background color.
-                                                  MYRGBA(63, 61, 63),    // Caption minimize button hover background color.
-                                                  MYRGBA(91, 89, 91)))   // Caption minimize button down background color.
-            {
-                error_message = "Failed to update the caption colors.";
-                break;
-            }
+        are_all_operation_success = true;
+    }
 
-            if (!this->colors.updateStandardButtonColors(MYRGBA(64, 62, 65),     // Standard button default color.
-                                                         MYRGBA(91, 89, 92),     // Standard button hover color.
-                                                         MYRGBA(101, 99, 102),   // Standard button down color.
-                                                         MYRGBA(114, 112, 114),  // Standard button border default color.
-                                                         MYRGBA(114, 112, 114),  // Standard button border hover color.
-                                                         MYRGBA(114, 112, 114))) // Standard button border down color.
-            {
-                error_message = "Failed to update the standard button colors.";
-                break;
-            }
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'UIManager' | FUNC: 'beginThemeTransition()']", MyLogType::Error);
 
-            if (!this->colors.updateRadioButtonColors(MYRGBA(64, 62, 65),     // Radio button primary color.
-                                                      MYRGBA(91, 89, 92),     // Radio button hover state primary color.
-                                                      MYRGBA(101, 99, 102),   // Radio button down state primary color.
-                                                      MYRGBA(64, 62, 65),     // Radio button secondary color.
-                                                      MYRGBA(91, 89, 92),     // Radio button hover state secondary color.
-                                                      MYRGBA(101, 99, 102),   // Radio button down state secondary color.
-                                                      MYRGBA(114, 112, 114),  // Radio button border color.
-                                                      MYRGBA(114, 112, 114),  // Radio button hover state border color.
-                                                      MYRGBA(114, 112, 114),  // Radio button down state border color.
-                                                      MYRGBA(231, 230, 229),  // Selected radio button primary color.
-                                                      MYRGBA(242, 241, 240),  // Selected radio button hover state primary color.
-                                                      MYRGBA(255, 255, 255),  // Selected radio button down state primary color.
-                                                      MYRGBA(64, 62, 65),     // Selected radio button secondary color.
-                                                      MYRGBA(64, 62, 65),     // Selected radio button hover state secondary color.
-                                                      MYRGBA(64, 62, 65),     // Selected radio button down state secondary color.
-                                                      MYRGBA(114, 112, 114),  // Selected radio button border color.
-                                                      MYRGBA(114, 112, 114),  // Selected radio button hover state border color.
-                                                      MYRGBA(114, 112, 114))) // Selected radio button down state border color.
-            {
-                error_message = "Failed to update the radio button colors.";
-                break;
-            }
+    return are_all_operation_success;
+}
+bool UIManager::stepThemeTransition(UINT weight, std::bitset<UI_THEME_COLOR_COUNT> *pChangedColors)
+{
+    MYTHEMETABLE::blend(this->transitionFromTable, this->transitionToTable, (weight > 256 ? 256 : weight), this->transitionFrameTable);
+    if (!this->colors.updateColors(this->transitionFrameTable, pChangedColors))
+    {
+        g_pApp->logger.writeLog("Failed to update the colors.", "[CLASS: 'UIManager' | FUNC: 'stepThemeTransition()']", MyLogType::Error);
+        return false;
+    }
 
-            if (!this->colors.updateEditboxColors(MYRGBA(64, 62, 65),     // Editbox color.
-                                                  MYRGBA(64, 62, 65),     // Editbox border default color.
-                                                  MYRGBA(114, 112, 114))) // Editbox border selected color.
+    return true;
+}
+bool UIManager::loadThemeOverrides(const std::wstring &filePath)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        for (size_t i = 0; i < UI_THEME_COUNT; i++)
+            this->themeOverrideMasks[i].reset();
+
+        std::ifstream theme_file(filePath.c_str());
+        if (!theme_file.is_open())
+        {
+            // The theme file is optional, no overrides.
+            if (!std::filesystem::exists(filePath))
             {
-                error_message = "Failed to update the editbox colors.";
+                are_all_operation_success = true;
                 break;
             }
 
-            if (!this->colors.updateDDLComboboxColors(MYRGBA(64, 62, 65),     // DDL combobox default color.
-                                                      MYRGBA(91, 89, 92),     // DDL combobox active color.
-                                                      MYRGBA(64, 62, 65),     // DDL combobox border color.
-                                                      MYRGBA(64, 62, 65),     // DDL combobox default item background color.
-                                                      MYRGBA(74, 72, 75),     // DDL combobox selected item background color.
-                                                      MYRGBA(114, 112, 114),  // DDL combobox drop-down list window border color.
-                                                      MYRGBA(237, 237, 235),  // DDL combobox default item text color.
-                                                      MYRGBA(225, 216, 102))) // DDL combobox selected item text color.
+            error_message = "Failed to open the theme file.";
+            break;
+        }
+
+        // Index of the theme the following colors apply to, UI_THEME_COUNT means all themes.
+        // The colors of an unknown section are skipped until the next section.
+        size_t theme_index = UI_THEME_COUNT;
+        bool is_section_skipped = false;
+        std::string line;
+        size_t line_number = 0;
+        while (std::getline(theme_file, line))
+        {
+            line_number++;
+            line.erase(0, line.find_first_not_of(" \t\r"));
+            line.erase(line.find_last_not_of(" \t\r") + 1);
+            if (line.empty() || line[0] == '#')
+                continue; // Ignore lines starting with '#' or empty lines.
+
+            // Section header, the whole theme name between the brackets. (Case-insensitive)
+            if (line[0] == '[')
             {
-                error_message = "Failed to update the drop-down list combobox colors.";
-                break;
+                std::string section_name = (line.size() >= 2 && line.back() == ']' ? line.substr(1, line.size() - 2) : "");
+                section_name.erase(0, section_name.find_first_not_of(" \t"));
+                section_name.erase(section_name.find_last_not_of(" \t") + 1);
+
+                is_section_skipped = false;
+                if (!lstrcmpiA(section_name.c_str(), "Light"))
+                    theme_index = static_cast<size_t>(MyTheme::Light);
+                else if (!lstrcmpiA(section_name.c_str(), "Dark"))
+                    theme_index = static_cast<size_t>(MyTheme::Dark);
+                else if (!lstrcmpiA(section_name.c_str(), "Monokai"))
+                    theme_index = static_cast<size_t>(MyTheme::Monokai);
+                else
+                {
+                    is_section_skipped = true;
+                    g_pApp->logger.writeLog("Unknown theme section at line " + std::to_string(line_number) + ":", "'" + line + "'", MyLogType::Warn);
+                }
+                continue;
             }
+            if (is_section_skipped)
+                continue;
 
-            if (!this->colors.updateScrollbarColors(MYRGBA(40, 37, 41),  // Scrollbar background color.
-                                                    MYRGBA(59, 56, 60),  // Scrollbar thumb default color.
-                                                    MYRGBA(78, 75, 79),  // Scrollbar thumb hover color.
-                                                    MYRGBA(98, 95, 98))) // Scrollbar thumb down color.
+            auto delimiter_pos = line.find('=');
+            if (delimiter_pos == std::string::npos)
             {
-                error_message = "Failed to update the scrollbar colors.";
-                break;
+                g_pApp->logger.writeLog("Invalid theme file entry at line " + std::to_string(line_number) + ":", "'" + line + "'", MyLogType::Warn);
+                continue;
             }
+            std::string name = line.substr(0, delimiter_pos);
+            name.erase(name.find_last_not_of(" \t") + 1);
 
-            if (!this->images.updateNonClientImages(theme))
+            MyThemeColor color;
+            if (!UIColors::findThemeColor(name, color))
             {
-                error_message = "Failed to update the non-client images.";
-                break;
+                g_pApp->logger.writeLog("Unknown theme color name at line " + std::to_string(line_number) + ":", "'" + name + "'", MyLogType::Warn);
+                continue;
             }
 
-            if (this->miscs.pMinimizeButton)
+            // Parse the channel values. (<Red>, <Green>, <Blue>[, <Alpha>])
+            BYTE channels[4] = {0, 0, 0, 255};
+            size_t total_channels = 0;
+            bool is_value_valid = true;
+            std::string value = line.substr(delimiter_pos + 1);
+            size_t position = 0;
+            while (position <= value.size())
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMinimizeButton->hWnd());
-                if (p_subclass)
+                size_t next_position = value.find(',', position);
+                if (next_position == std::string::npos)
+                    next_position = value.size();
+
+                // Only the surrounding whitespaces are trimmed, values with any other non-digit character are rejected. (e.g. "-5", "2a5")
+                std::string channel = value.substr(position, next_position - position);
+                channel.erase(0, channel.find_first_not_of(" \t"));
+                channel.erase(channel.find_last_not_of(" \t") + 1);
+                if (total_channels >= 4 || channel.empty() || channel.size() > 3 ||
+                    !std::all_of(channel.begin(), channel.end(), [](char character)
+                                 { return MyCharClass::IsDigit(static_cast<unsigned char>(character)); }) ||
+                    std::stoi(channel) > 255)
                 {
-                    p_subclass->imageConfig.pImageDefault = &this->images.wicBitmapMinusGrey;
-                    p_subclass->imageConfig.pImageHover = &this->images.wicBitmapMinusWhite;
-                    p_subclass->imageConfig.pImageActive = &this->images.wicBitmapMinusWhite;
+                    is_value_valid = false;
+                    break;
                 }
+                channels[total_channels++] = static_cast<BYTE>(std::stoi(channel));
+                position = next_position + 1;
             }
-            if (this->miscs.pMaximizeButton)
+            if (!is_value_valid || total_channels < 3)
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pMaximizeButton->hWnd());
-                if (p_subclass)
-                {
-                    p_subclass->imageConfig.pImageDefault = &this->images.wicBitmapSquareGrey;
-                    p_subclass->imageConfig.pImageHover = &this->images.wicBitmapSquareWhite;
-                    p_subclass->imageConfig.pImageActive = &this->images.wicBitmapSquareWhite;
-                }
+                g_pApp->logger.writeLog("Invalid theme color value at line " + std::to_string(line_number) + ":", "'" + line + "'", MyLogType::Warn);
+                continue;
             }
-            if (this->miscs.pCloseButton)
+
+            size_t color_index = static_cast<size_t>(color);
+            for (size_t i = 0; i < UI_THEME_COUNT; i++)
             {
-                auto p_subclass = MyImageButtonSubclass::getSubclassPointer(this->miscs.pCloseButton->hWnd());
-                if (p_subclass)
-                {
-                    p_subclass->imageConfig.pImageDefault = &this->images.wicBitmapCrossGrey;
-                    p_subclass->imageConfig.pImageHover = &this->images.wicBitmapCrossWhite;
-                    p_subclass->imageConfig.pImageActive = &this->images.wicBitmapCrossWhite;
-                }
+                if (theme_index != UI_THEME_COUNT && theme_index != i)
+                    continue;
+
+                this->themeOverrideTables[i].red[color_index] = channels[0];
+                this->themeOverrideTables[i].green[color_index] = channels[1];
+                this->themeOverrideTables[i].blue[color_index] = channels[2];
+                this->themeOverrideTables[i].alpha[color_index] = channels[3];
+                this->themeOverrideMasks[i].set(color_index);
             }
-
-            is_switch_success = true;
-            break;
         }
-        }
-        if (!is_switch_success)
-            break;
+        theme_file.close();
 
         are_all_operation_success = true;
     }
 
     if (!are_all_operation_success)
-        g_pApp->logger.writeLog(error_message, "[CLASS: 'UIManager' | FUNC: 'updateUITheme()']", MyLogType::Error);
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'UIManager' | FUNC: 'loadThemeOverrides()']", MyLogType::Error);
 
     return are_all_operation_success;
 }
+std::bitset<UI_THEME_COLOR_COUNT> UIManager::getDependentColors()
+{
+    std::bitset<UI_THEME_COLOR_COUNT> colors;
+    colors.set(static_cast<size_t>(MyThemeColor::CaptionBackground));
+    colors.set(static_cast<size_t>(MyThemeColor::Background));
+    colors.set(static_cast<size_t>(MyThemeColor::BorderActive));
+    colors.set(static_cast<size_t>(MyThemeColor::BorderInactive));
+
+    return colors;
+}
 bool UIManager::createDeviceResources()
 {
     bool are_all_operation_success = false;
@@ -862,16 +1569,16 @@ bool UIManager::createDeviceResources()
         this->pSolidColorBrushBorderInactive.reset(new ID2D1SolidColorBrush *(nullptr));
 
         error_message = "Failed to create the device resources.";
-        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.captionBackground.getD2D1Color(), &*this->pSolidColorBrushCaptionBackground);
+        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.captionBackground.getD2D1Color(), Deleter::track(this->pSolidColorBrushCaptionBackground));
         if (FAILED(hr))
             break;
-        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.background.getD2D1Color(), &*this->pSolidColorBrushBackground);
+        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.background.getD2D1Color(), Deleter::track(this->pSolidColorBrushBackground));
         if (FAILED(hr))
             break;
-        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.borderActive.getD2D1Color(), &*this->pSolidColorBrushBorderActive);
+        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.borderActive.getD2D1Color(), Deleter::track(this->pSolidColorBrushBorderActive));
         if (FAILED(hr))
             break;
-        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.borderInactive.getD2D1Color(), &*this->pSolidColorBrushBorderInactive);
+        hr = (*this->pRenderTarget)->CreateSolidColorBrush(this->colors.borderInactive.getD2D1Color(), Deleter::track(this->pSolidColorBrushBorderInactive));
         if (FAILED(hr))
             break;
         error_message = "";
@@ -889,4 +1596,49 @@ bool UIManager::createDeviceResources()
         g_pApp->logger.writeLog(error_message, "[CLASS: 'UIManager' | FUNC: 'createDeviceResources()']", MyLogType::Error);
 
     return are_all_operation_success;
+}
+bool UIManager::recolorDeviceResources()
+{
+    if (!this->pRenderTarget || !*this->pRenderTarget ||
+        !this->pSolidColorBrushCaptionBackground || !*this->pSolidColorBrushCaptionBackground ||
+        !this->pSolidColorBrushBackground || !*this->pSolidColorBrushBackground ||
+        !this->pSolidColorBrushBorderActive || !*this->pSolidColorBrushBorderActive ||
+        !this->pSolidColorBrushBorderInactive || !*this->pSolidColorBrushBorderInactive)
+        return this->createDeviceResources();
+
+    (*this->pSolidColorBrushCaptionBackground)->SetColor(this->colors.captionBackground.getD2D1Color());
+    (*this->pSolidColorBrushBackground)->SetColor(this->colors.background.getD2D1Color());
+    (*this->pSolidColorBrushBorderActive)->SetColor(this->colors.borderActive.getD2D1Color());
+    (*this->pSolidColorBrushBorderInactive)->SetColor(this->colors.borderInactive.getD2D1Color());
+
+    return true;
+}
+const MYTHEMETABLE *UIManager::resolveThemeTable(MyTheme theme)
+{
+    const MYTHEMETABLE *p_theme_table = this->themePack.getThemeTable(theme);
+    if (!p_theme_table)
+        p_theme_table = UIColors::getBuiltInThemeTable(theme);
+    if (!p_theme_table)
+        return nullptr;
+
+    // Apply the theme overrides on top of the theme table.
+    size_t theme_index = static_cast<size_t>(theme);
+    if (this->themeOverrideMasks[theme_index].any())
+    {
+        this->overriddenThemeTable = *p_theme_table;
+        const MYTHEMETABLE &override_table = this->themeOverrideTables[theme_index];
+        for (size_t i = 0; i < UI_THEME_COLOR_COUNT; i++)
+        {
+            if (!this->themeOverrideMasks[theme_index].test(i))
+                continue;
+
+            this->overriddenThemeTable.red[i] = override_table.red[i];
+            this->overriddenThemeTable.green[i] = override_table.green[i];
+            this->overriddenThemeTable.blue[i] = override_table.blue[i];
+            this->overriddenThemeTable.alpha[i] = override_table.alpha[i];
+        }
+        p_theme_table = &this->overriddenThemeTable;
+    }
+
+    return p_theme_table;
 }
\ No newline at end of file
@@ -6,6 +6,169 @@
 #include "../Headers/standard_includes.h" // Include standard libraries.
 #include "../Headers/my_includes.h"       // Include my user-defined type headers.
 
+/******************************************
+ * Word search helpers (`ContainsWord()`) *
+ *****************************************/
+
+/**
+ * @brief Fold an ASCII upper case letter to lower case, the other characters are unchanged.
+ */
+template <typename Char>
+static inline Char FoldAsciiCase(Char character)
+{
+    return ((character >= 'A' && character <= 'Z') ? static_cast<Char>(character + ('a' - 'A')) : character);
+}
+
+/**
+ * @brief Compare two characters case-insensitively.
+ * @note Folds the ASCII letters, like `std::tolower()` in the "C" locale.
+ */
+static inline bool IsEqualIgnoreCase(CHAR first, CHAR second)
+{
+    return (first == second || FoldAsciiCase(first) == FoldAsciiCase(second));
+}
+
+/**
+ * @brief Compare two wide characters case-insensitively.
+ * @note The non-ASCII characters are compared with the Unicode ordinal case mapping. (`CompareStringOrdinal()`)
+ */
+static inline bool IsEqualIgnoreCase(WCHAR first, WCHAR second)
+{
+    if (first == second)
+        return true;
+    if (first < 0x80 && second < 0x80)
+        return (FoldAsciiCase(first) == FoldAsciiCase(second));
+
+    return (CompareStringOrdinal(&first, 1, &second, 1, TRUE) == CSTR_EQUAL);
+}
+
+/**
+ * @brief Check if a character is a letter, a word boundary is any other character.
+ */
+static inline bool IsAlphaCharacter(CHAR character)
+{
+    return MyCharClass::IsAlpha(static_cast<UCHAR>(character));
+}
+static inline bool IsAlphaCharacter(WCHAR character)
+{
+    return (iswalpha(character) != 0);
+}
+
+/**
+ * @brief Check if a string range is surrounded by word boundaries.
+ */
+template <typename Char>
+static inline bool IsBoundedAt(const std::basic_string<Char> &str, size_t position, size_t length)
+{
+    return ((position == 0 || !IsAlphaCharacter(str[position - 1])) &&
+            (position + length == str.size() || !IsAlphaCharacter(str[position + length])));
+}
+
+/**
+ * @brief Check if a word is found at a string position. (Case-insensitive)
+ */
+template <typename Char>
+static bool IsWordAt(const std::basic_string<Char> &str, size_t position, const std::basic_string<Char> &word, bool checkBoundaries)
+{
+    for (size_t i = 0; i < word.size(); i++)
+    {
+        if (!IsEqualIgnoreCase(str[position + i], word[i]))
+            return false;
+    }
+
+    return (!checkBoundaries || IsBoundedAt(str, position, word.size()));
+}
+
+#ifdef SIMD_SSE2
+/**
+ * @brief Fold the ASCII upper case letters of 16 characters to lower case.
+ */
+static inline __m128i FoldAsciiCase8(__m128i characters)
+{
+    __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi8(characters, _mm_set1_epi8('A' - 1)), _mm_cmplt_epi8(characters, _mm_set1_epi8('Z' + 1)));
+    return _mm_or_si128(characters, _mm_and_si128(is_upper, _mm_set1_epi8(0x20)));
+}
+
+/**
+ * @brief Fold the ASCII upper case letters of 8 wide characters to lower case.
+ */
+static inline __m128i FoldAsciiCase16(__m128i characters)
+{
+    __m128i is_upper = _mm_and_si128(_mm_cmpgt_epi16(characters, _mm_set1_epi16('A' - 1)), _mm_cmplt_epi16(characters, _mm_set1_epi16('Z' + 1)));
+    return _mm_or_si128(characters, _mm_and_si128(is_upper, _mm_set1_epi16(0x20)));
+}
+
+/**
+ * @brief Search the word candidates of a string, 16 positions at a time. (Case-insensitive)
+ * @note A position is a candidate when the first and the last characters of the word match there, only the candidates are compared in full.
+ * @param position Reference to the first position to search, updated to the first position left for the scalar search. [OUT]
+ * @return Returns true if the word is found, false otherwise.
+ */
+static bool ScanWordCandidates(const std::string &str, const std::string &word, bool checkBoundaries, size_t &position)
+{
+    const CHAR *p_str = str.data();
+    size_t last_offset = word.size() - 1;
+    __m128i first_character = _mm_set1_epi8(FoldAsciiCase(word.front()));
+    __m128i last_character = _mm_set1_epi8(FoldAsciiCase(word.back()));
+    for (; position + 16 + last_offset <= str.size(); position += 16)
+    {
+        __m128i first_block = FoldAsciiCase8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_str + position)));
+        __m128i last_block = FoldAsciiCase8(_mm_loadu_si128(reinterpret_cast<const __m128i *>(p_str + position + last_offset)));
+
+        UINT candidates = static_cast<UINT>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(first_block, first_character), _mm_cmpeq_epi8(last_block, last_character))));
+        for (size_t i = 0; candidates; i++, candidates >>= 1)
+        {
+            if ((candidates & 1) && IsWordAt(str, position + i, word, checkBoundaries))
+                return true;
+        }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Search the word candidates of a wide string, 8 positions at a time. (Case-insensitive)
+ * @note The non-ASCII characters are candidates too, they may fold to the word characters.
+ *       Words starting or ending with a non-ASCII character are left to the scalar search.
+ * @param position Reference to the first position to search, updated to the first position left for the scalar search. [OUT]
+ * @return Returns true if the word is found, false otherwise.
+ */
+static bool ScanWordCandidates(const std::wstring &str, const std::wstring &word, bool checkBoundaries, size_t &position)
+{
+    if constexpr (sizeof(WCHAR) != 2)
+        return false;
+    if (word.front() >= 0x80 || word.back() >= 0x80)
+        return false;
+
+    const WCHAR *p_str = str.data();
+    size_t last_offset = word.size() - 1;
+    __m128i first_character = _mm_set1_epi16(static_cast<SHORT>(FoldAsciiCase(word.front())));
+    __m128i last_character = _mm_set1_epi16(static_cast<SHORT>(FoldAsciiCase(word.back())));
+    __m128i ascii_maximum = _mm_set1_epi16(0x7F);
+    for (; position + 8 + last_offset <= str.size(); position += 8)
+    {
+        __m128i first_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_str + position));
+        __m128i last_block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(p_str + position + last_offset));
+
+        // Signed comparison, the characters above 0x7FFF are negative.
+        __m128i first_non_ascii = _mm_or_si128(_mm_cmpgt_epi16(first_block, ascii_maximum), _mm_cmplt_epi16(first_block, _mm_setzero_si128()));
+        __m128i last_non_ascii = _mm_or_si128(_mm_cmpgt_epi16(last_block, ascii_maximum), _mm_cmplt_epi16(last_block, _mm_setzero_si128()));
+        __m128i first_match = _mm_or_si128(_mm_cmpeq_epi16(FoldAsciiCase16(first_block), first_character), first_non_ascii);
+        __m128i last_match = _mm_or_si128(_mm_cmpeq_epi16(FoldAsciiCase16(last_block), last_character), last_non_ascii);
+
+        // Two mask bits per character.
+        UINT candidates = static_cast<UINT>(_mm_movemask_epi8(_mm_and_si128(first_match, last_match)));
+        for (size_t i = 0; candidates; i++, candidates >>= 2)
+        {
+            if ((candidates & 1) && IsWordAt(str, position + i, word, checkBoundaries))
+                return true;
+        }
+    }
+
+    return false;
+}
+#endif
+
 /*******************************************
  * Global helper functions implementations *
  *******************************************/
@@ -396,206 +559,94 @@ bool MyUtility::RemoveWindowClassStyle(HWND hWnd, LONG style)
 }
 bool MyUtility::ContainsWord(const std::string &str, const std::string &word, bool caseSensitive, bool checkBoundaries)
 {
-    if (checkBoundaries)
+    if (word.size() > str.size())
+        return false;
+
+    // The standard search is allocation-free and already vectorized. (memchr/memcmp)
+    if (caseSensitive)
     {
-        // Check if the word is found in the string.
-        size_t found = str.find(word);
-        if (found != std::string::npos)
+        for (size_t found = str.find(word); found != std::string::npos; found = str.find(word, found + 1))
         {
-            // Check if the word is surrounded by word boundaries.
-            if ((found == 0 || !isalpha(str[found - 1])) &&
-                (found + word.length() == str.length() || !isalpha(str[found + word.length()])))
-            {
+            if (!checkBoundaries || IsBoundedAt(str, found, word.size()))
                 return true;
-            }
-        }
-
-        if (!caseSensitive)
-        {
-            // Convert the search string to lowercase.
-            std::string str_lowercase = "";
-            for (auto ch : str)
-            {
-                auto ch_lower = std::tolower(ch);
-                str_lowercase += ch_lower;
-            }
-            // Convert the search word to lowercase.
-            std::string word_lowercase = "";
-            for (auto ch : word)
-            {
-                auto ch_lower = std::tolower(ch);
-                word_lowercase += ch_lower;
-            }
-            // Check if lowercase word is found in the lowercase string.
-            found = str_lowercase.find(word_lowercase);
-            if (found != std::string::npos)
-            {
-                // Check if the lowercase word is surrounded by word boundaries.
-                if ((found == 0 || !isalpha(str_lowercase[found - 1])) &&
-                    (found + word_lowercase.length() == str_lowercase.length() || !isalpha(str_lowercase[found + word_lowercase.length()])))
-                {
-                    return true;
-                }
-            }
         }
 
         return false;
     }
-    else
+
+    size_t position = 0;
+#ifdef SIMD_SSE2
+    if (!word.empty() && ScanWordCandidates(str, word, checkBoundaries, position))
+        return true;
+#endif
+    for (; position + word.size() <= str.size(); position++)
     {
-        // Check if the word is found in the string.
-        if (str.find(word) != std::string::npos)
+        if (IsWordAt(str, position, word, checkBoundaries))
             return true;
-
-        if (!caseSensitive)
-        {
-            // Convert the search string to lowercase.
-            std::string str_lowercase = "";
-            for (auto ch : str)
-            {
-                auto ch_lower = std::tolower(ch);
-                str_lowercase += ch_lower;
-            }
-            // Convert the search word to lowercase.
-            std::string word_lowercase = "";
-            for (auto ch : word)
-            {
-                auto ch_lower = std::tolower(ch);
-                word_lowercase += ch_lower;
-            }
-            // Check if lowercase word is found in the lowercase string.
-            if (str_lowercase.find(word_lowercase) != std::string::npos)
-                return true;
-        }
-
-        return false;
     }
+
+    return false;
 }
 bool MyUtility::ContainsWord(const std::wstring &str, const std::wstring &word, bool caseSensitive, bool checkBoundaries)
 {
-    if (checkBoundaries)
-    {
-        // Check if the word is found in the string.
-        size_t found = str.find(word);
-        if (found != std::wstring::npos)
-        {
-            // Check if the word is surrounded by word boundaries.
-            if ((found == 0 || !iswalpha(str[found - 1])) &&
-                (found + word.length() == str.length() || !iswalpha(str[found + word.length()])))
-            {
-                return true;
-            }
-        }
-
-        if (!caseSensitive)
-        {
-            // Convert the search string to lowercase.
-            std::wstring str_lowercase = L"";
-            for (auto ch : str)
-            {
-                auto ch_lower = std::towlower(ch);
-                str_lowercase += ch_lower;
-            }
-            // Convert the search word to lowercase.
-            std::wstring word_lowercase = L"";
-            for (auto ch : word)
-            {
-                auto ch_lower = std::towlower(ch);
-                word_lowercase += ch_lower;
-            }
-            // Check if lowercase word is found in the lowercase string.
-            found = str_lowercase.find(word_lowercase);
-            if (found != std::wstring::npos)
-            {
-                // Check if the lowercase word is surrounded by word boundaries.
-                if ((found == 0 || !iswalpha(str_lowercase[found - 1])) &&
-                    (found + word_lowercase.length() == str_lowercase.length() || !iswalpha(str_lowercase[found + word_lowercase.length()])))
-                {
-                    return true;
-                }
-            }
-        }
-
+    if (word.size() > str.size())
         return false;
-    }
-    else
-    {
-        // Check if the word is found in the string.
-        if (str.find(word) != std::wstring::npos)
-            return true;
 
-        if (!caseSensitive)
+    // The standard search is allocation-free and already vectorized. (memchr/memcmp)
+    if (caseSensitive)
+    {
+        for (size_t found = str.find(word); found != std::wstring::npos; found = str.find(word, found + 1))
         {
-            // Convert the search string to lowercase.
-            std::wstring str_lowercase = L"";
-            for (auto ch : str)
-            {
-                auto ch_lower = std::towlower(ch);
-                str_lowercase += ch_lower;
-            }
-            // Convert the search word to lowercase.
-            std::wstring word_lowercase = L"";
-            for (auto ch : word)
-            {
-                auto ch_lower = std::towlower(ch);
-                word_lowercase += ch_lower;
-            }
-            // Check if lowercase word is found in the lowercase string.
-            if (str_lowercase.find(word_lowercase) != std::wstring::npos)
+            if (!checkBoundaries || IsBoundedAt(str, found, word.size()))
                 return true;
         }
 
         return false;
     }
-}
-bool MyUtility::ContainsDigit(const std::string &str)
-{
-    for (const auto &ch : str)
+
+    size_t position = 0;
+#ifdef SIMD_SSE2
+    if (!word.empty() && ScanWordCandidates(str, word, checkBoundaries, position))
+        return true;
+#endif
+    for (; position + word.size() <= str.size(); position++)
     {
-        if (isdigit(ch))
+        if (IsWordAt(str, position, word, checkBoundaries))
             return true;
     }
 
     return false;
 }
+bool MyUtility::ContainsDigit(const std::string &str)
+{
+    return MyUtility::ContainsCharacter(str, MyCharClass::Digit);
+}
 bool MyUtility::ContainsDigit(const std::wstring &str)
 {
-    for (const auto &ch : str)
-    {
-        if (iswdigit(ch))
-            return true;
-    }
-
-    return false;
+    return MyUtility::ContainsCharacter(str, MyCharClass::Digit);
 }
 std::wstring MyUtility::ConvertStringToWideString(const std::string &str)
 {
-    int text_length = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, NULL, 0);
-    std::unique_ptr<wchar_t[]> p_text_buffer(new wchar_t[text_length]);
-    MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, p_text_buffer.get(), text_length);
-    std::wstring wide_string(p_text_buffer.get());
+    // Transcode into the destination string, sized for the worst case and then shrunk in place.
+    std::wstring wide_string(str.size(), L'\0');
+    wide_string.resize(MyUtility::TranscodeUtf8ToUtf16(str.data(), str.size(), wide_string.data()));
 
     return wide_string;
 }
 std::string MyUtility::ConvertWideStringToString(const std::wstring &wstr)
 {
-    int text_length = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, NULL, 0, NULL, NULL);
-    std::unique_ptr<char[]> p_text_buffer(new char[text_length]);
-    WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, p_text_buffer.get(), text_length, NULL, NULL);
-    std::string string(p_text_buffer.get());
+    std::string string(wstr.size() * 3, '\0');
+    string.resize(MyUtility::TranscodeUtf16ToUtf8(wstr.data(), wstr.size(), string.data()));
+
     return string;
 }
 std::string MyUtility::RemoveNonDigitFromString(const std::string &str)
 {
-    std::string ret = std::regex_replace(str, std::regex("\\D"), "");
-
-    return ret;
+    return MyUtility::FilterCharacters(str, MyCharClass::Digit);
 }
 std::wstring MyUtility::RemoveNonDigitFromString(const std::wstring &str)
 {
-    std::wstring ret = std::regex_replace(str, std::wregex(L"\\D"), L"");
-
-    return ret;
+    return MyUtility::FilterCharacters(str, MyCharClass::Digit);
 }
 bool MyUtility::OpenFileDialog(std::vector<std::wstring> &paths, bool selectFolder, bool multiSelect)
 {
@@ -770,418 +821,89 @@ KeyToggle::operator bool()
     return false;
 }
 
-// [MyLogger] class implementations:
+// [MyFileWatcher] class implementations:
 
-MyLogger::MyLogger()
-{
-    std::wstring command_line = GetCommandLineW();
-    if (command_line.size() <= 2)
-        throw std::runtime_error("Unexpected command line string.");
-
-    command_line.erase(0, 1);
-    command_line.pop_back();
-    this->path = command_line;
-}
-MyLogger::MyLogger(std::wstring path)
-    : path(path)
+MyFileWatcher::MyFileWatcher() {}
+MyFileWatcher::~MyFileWatcher()
 {
-    if (path.size() <= 2)
-        throw std::runtime_error("Invalid path string.");
+    this->unwatch();
 }
-int MyLogger::getLogLevel()
+bool MyFileWatcher::watch(const std::wstring &filePath)
 {
-    return this->logLevel;
-}
-bool MyLogger::setPath(std::wstring path)
-{
-    if (path.empty())
-    {
-        std::wstring command_line = GetCommandLineW();
-        if (command_line.size() <= 2)
-            throw std::runtime_error("Unexpected command line string.");
-
-        command_line.erase(0, 1);
-        command_line.pop_back();
-        this->path = command_line;
-    }
-    else
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
     {
-        if (path.size() <= 2)
-            return false;
-
-        this->path = path;
-    }
-
-    return true;
-}
-bool MyLogger::setLogLevel(int logLevel)
-{
-    this->logLevel = logLevel;
-    return true;
-}
-bool MyLogger::setLogFileName(std::wstring logFileName)
-{
-    if (logFileName.empty())
-        return false;
-
-    this->logFileName = logFileName;
+        this->unwatch();
 
-    return true;
-}
-bool MyLogger::writeLog(std::string description, std::string extraDescription, MyLogType logType)
-{
-    {
-        int log_level = 0;
-        switch (logType)
+        std::filesystem::path path(filePath);
+        if (!path.has_parent_path())
         {
-        case MyLogType::Info:
-        case MyLogType::Warn:
-        case MyLogType::Error:
-            log_level = 1;
+            error_message = "Invalid file path.";
             break;
-        case MyLogType::Debug:
-            log_level = 2;
-        }
-
-        if (this->logLevel < log_level)
-            return true;
-    }
-
-    std::ofstream file;
-    file.open((this->path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->logFileName.c_str()).c_str(), std::ios_base::app);
-    if (!file.is_open())
-        return false;
-
-    std::string log_type = "";
-    switch (logType)
-    {
-    case MyLogType::Info:
-        log_type.append("(INFO)");
-        break;
-    case MyLogType::Warn:
-        log_type.append("(WARN)");
-        break;
-    case MyLogType::Error:
-        log_type.append("(ERROR)");
-        break;
-    case MyLogType::Debug:
-        log_type.append("(DEBUG)");
-        break;
-    }
-
-    file << "[" << this->getCurrentDateTimeString() << "] " << log_type << " " << description << (!extraDescription.empty() ? (" " + extraDescription) : "") << "\n";
-
-    file.close();
-    return true;
-}
-bool MyLogger::writeLog(std::string description, bool includeTime)
-{
-    std::ofstream file;
-    file.open((this->path.parent_path().c_str() + static_cast<std::wstring>(L"\\") + this->logFileName.c_str()).c_str(), std::ios_base::app);
-    if (!file.is_open())
-        return false;
-
-    if (includeTime)
-        file << "[" << this->getCurrentDateTimeString() << "] ";
-
-    file << description << "\n";
-
-    file.close();
-    return true;
-}
-std::string MyLogger::getCurrentDateTimeString()
-{
-    time_t now = time(0);
-    tm time_struct;
-    CHAR text_buffer[80];
-    if (localtime_s(&time_struct, &now))
-        return "";
-
-    strftime(text_buffer, 79, "%Y-%m-%d.%X", &time_struct);
-
-    return text_buffer;
-}
-
-/***********************************
- * Deleter structs implementations *
- ***********************************/
-
-// Deleter base struct:
-
-Deleter::Deleter()
-{
-    this->logger.setLogLevel(2);
-}
-
-// WinAPI deleters:
-
-void HWNDDeleter::operator()(HWND *variable) const
-{
-    if (variable)
-    {
-        if (*variable)
-        {
-            if (!DestroyWindow(*variable))
-            {
-                Deleter::logger.writeLog("Deleter failed.", "[DELETER: 'HWNDDeleter']", MyLogType::Error);
-                throw std::runtime_error("'HWNDDeleter' deleter failed.");
-            }
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'HWNDDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'HWNDDeleter']", MyLogType::Info);
-        }
-
-        delete variable;
-    }
-}
-void HBRUSHDeleter::operator()(HBRUSH *variable) const
-{
-    if (variable)
-    {
-        if (*variable)
-        {
-            if (!DeleteObject(*variable))
-            {
-                Deleter::logger.writeLog("Deleter failed.", "[DELETER: 'HBRUSHDeleter']", MyLogType::Error);
-                throw std::runtime_error("'HBRUSHDeleter' deleter failed.");
-            }
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'HBRUSHDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'HBRUSHDeleter']", MyLogType::Info);
         }
 
-        delete variable;
-    }
-}
-void HFONTDeleter::operator()(HFONT *variable) const
-{
-    if (variable)
-    {
-        if (*variable)
+        this->hChangeNotification = FindFirstChangeNotificationW(path.parent_path().c_str(), FALSE, FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE);
+        if (this->hChangeNotification == INVALID_HANDLE_VALUE)
         {
-            if (!DeleteObject(*variable))
-            {
-                Deleter::logger.writeLog("Deleter failed.", "[DELETER: 'HFONTDeleter']", MyLogType::Error);
-                throw std::runtime_error("'HFONTDeleter' deleter failed.");
-            }
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'HFONTDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'HFONTDeleter']", MyLogType::Info);
+            error_message = "Failed to create the change notification object.";
+            break;
         }
 
-        delete variable;
-    }
-}
-void HRGNDeleter::operator()(HRGN *variable) const
-{
-    if (variable)
-    {
-        if (*variable)
-        {
-            if (!DeleteObject(*variable))
-            {
-                Deleter::logger.writeLog("Deleter failed.", "[DELETER: 'HRGNDeleter']", MyLogType::Error);
-                throw std::runtime_error("'HRGNDeleter' deleter failed.");
-            }
+        this->filePath = filePath;
+        this->getLastWriteTime(this->lastWriteTime);
 
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'HRGNDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'HRGNDeleter']", MyLogType::Info);
-        }
-
-        delete variable;
+        are_all_operation_success = true;
     }
-}
-
-// WAM deleters:
-
-void IUIAnimationStoryboardDeleter::operator()(IUIAnimationStoryboard **variable) const
-{
-    if (variable)
-    {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
 
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'IUIAnimationStoryboardDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'IUIAnimationStoryboardDeleter']", MyLogType::Info);
-        }
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyFileWatcher' | FUNC: 'watch()']", MyLogType::Error);
 
-        delete variable;
-    }
+    return are_all_operation_success;
 }
-void IUIAnimationVariableDeleter::operator()(IUIAnimationVariable **variable) const
+void MyFileWatcher::unwatch()
 {
-    if (variable)
+    if (this->hChangeNotification != INVALID_HANDLE_VALUE)
     {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'IUIAnimationVariableDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'IUIAnimationVariableDeleter']", MyLogType::Info);
-        }
-
-        delete variable;
+        FindCloseChangeNotification(this->hChangeNotification);
+        this->hChangeNotification = INVALID_HANDLE_VALUE;
     }
+    this->filePath.clear();
+    this->lastWriteTime = 0;
 }
-void IUIAnimationTransitionDeleter::operator()(IUIAnimationTransition **variable) const
+bool MyFileWatcher::hasChanged()
 {
-    if (variable)
-    {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'IUIAnimationTransitionDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'IUIAnimationTransitionDeleter']", MyLogType::Info);
-        }
-
-        delete variable;
-    }
-}
+    if (this->hChangeNotification == INVALID_HANDLE_VALUE)
+        return false;
 
-// Direct2D/DirectWrite deleters:
+    // Nothing changed in the parent directory since the last check.
+    if (WaitForSingleObject(this->hChangeNotification, 0) != WAIT_OBJECT_0)
+        return false;
 
-void IWICBitmapSourceDeleter::operator()(IWICBitmapSource **variable) const
-{
-    if (variable)
+    if (!FindNextChangeNotification(this->hChangeNotification))
     {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'IWICBitmapSourceDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'IWICBitmapSourceDeleter']", MyLogType::Info);
-        }
-
-        delete variable;
+        g_pApp->logger.writeLog("Failed to re-arm the change notification object.", "[CLASS: 'MyFileWatcher' | FUNC: 'hasChanged()']", MyLogType::Error);
+        FindCloseChangeNotification(this->hChangeNotification);
+        this->hChangeNotification = INVALID_HANDLE_VALUE;
     }
-}
-void IDWriteTextFormatDeleter::operator()(IDWriteTextFormat **variable) const
-{
-    if (variable)
-    {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
 
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'IDWriteTextFormatDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'IDWriteTextFormatDeleter']", MyLogType::Info);
-        }
+    // Something in the directory changed, check whether it was the watched file.
+    ULONGLONG last_write_time = 0;
+    this->getLastWriteTime(last_write_time);
+    if (last_write_time == this->lastWriteTime)
+        return false;
 
-        delete variable;
-    }
+    this->lastWriteTime = last_write_time;
+    return true;
 }
-void ID2D1DCRenderTargetDeleter::operator()(ID2D1DCRenderTarget **variable) const
+void MyFileWatcher::getLastWriteTime(ULONGLONG &lastWriteTime)
 {
-    if (variable)
+    WIN32_FILE_ATTRIBUTE_DATA file_attributes;
+    if (!GetFileAttributesExW(this->filePath.c_str(), GetFileExInfoStandard, &file_attributes))
     {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'ID2D1DCRenderTargetDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'ID2D1DCRenderTargetDeleter']", MyLogType::Info);
-        }
-
-        delete variable;
+        lastWriteTime = 0;
+        return;
     }
-}
-void ID2D1SolidColorBrushDeleter::operator()(ID2D1SolidColorBrush **variable) const
-{
-    if (variable)
-    {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'ID2D1SolidColorBrushDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'ID2D1SolidColorBrushDeleter']", MyLogType::Info);
-        }
 
-        delete variable;
-    }
+    lastWriteTime = (static_cast<ULONGLONG>(file_attributes.ftLastWriteTime.dwHighDateTime) << 32) | file_attributes.ftLastWriteTime.dwLowDateTime;
 }
-void ID2D1BitmapDeleter::operator()(ID2D1Bitmap **variable) const
-{
-    if (variable)
-    {
-        if (*variable)
-        {
-            (*variable)->Release();
-            *variable = nullptr;
-
-            if (debugMode)
-                Deleter::logger.writeLog("Object released.", "[DELETER: 'ID2D1BitmapDeleter']", MyLogType::Info);
-        }
-        else
-        {
-            if (debugMode)
-                Deleter::logger.writeLog("Object empty.", "[DELETER: 'ID2D1BitmapDeleter']", MyLogType::Info);
-        }
-
-        delete variable;
-    }
-}
\ No newline at end of file
@@ -392,7 +392,7 @@ void *&MyWindow::data()
 {
     return this->pData;
 }
-bool MyWindow::refresh()
+bool MyWindow::refresh(bool isColorOnly)
 {
     bool are_all_operation_success = false;
     std::string error_message = "";
@@ -414,49 +414,49 @@ bool MyWindow::refresh()
         }
         case MyWindowType::StandardButton:
         {
-            if (!static_cast<MyStandardButtonSubclass *>(this->pData)->refresh())
+            if (!static_cast<MyStandardButtonSubclass *>(this->pData)->refresh(isColorOnly))
                 break;
             is_switch_success = true;
             break;
         }
         case MyWindowType::ImageButton:
         {
-            if (!static_cast<MyImageButtonSubclass *>(this->pData)->refresh())
+            if (!static_cast<MyImageButtonSubclass *>(this->pData)->refresh(isColorOnly))
                 break;
             is_switch_success = true;
             break;
         }
         case MyWindowType::RadioButton:
         {
-            if (!static_cast<MyRadioButtonSubclass *>(this->pData)->refresh())
+            if (!static_cast<MyRadioButtonSubclass *>(this->pData)->refresh(isColorOnly))
                 break;
             is_switch_success = true;
             break;
         }
         case MyWindowType::Editbox:
         {
-            if (!static_cast<MyEditboxSubclass *>(this->pData)->refresh())
+            if (!static_cast<MyEditboxSubclass *>(this->pData)->refresh(isColorOnly))
                 break;
             is_switch_success = true;
             break;
         }
         case MyWindowType::DDLCombobox:
         {
-            if (!static_cast<MyDDLComboboxSubclass *>(this->pData)->refresh())
+            if (!static_cast<MyDDLComboboxSubclass *>(this->pData)->refresh(isColorOnly))
                 break;
             is_switch_success = true;
             break;
         }
         case MyWindowType::VerticalScrollbar:
         {
-            if (!static_cast<MyVerticalScrollbarSubclass *>(this->pData)->refresh())
+            if (!static_cast<MyVerticalScrollbarSubclass *>(this->pData)->refresh(isColorOnly))
                 break;
             is_switch_success = true;
             break;
         }
         case MyWindowType::StandardText:
         {
-            if (!static_cast<MyStandardTextSubclass *>(this->pData)->refresh())
+            if (!static_cast<MyStandardTextSubclass *>(this->pData)->refresh(isColorOnly))
                 break;
             is_switch_success = true;
             break;
@@ -478,6 +478,65 @@ bool MyWindow::refresh()
 
     return are_all_operation_success;
 }
+bool MyWindow::isColorDependent(const std::bitset<UI_THEME_COLOR_COUNT> &colors)
+{
+    if (!this->isWindowExists || !this->pData || colors.none())
+        return false;
+
+    // Colors used by the window type.
+    if ((UIColors::getDependentColors(this->windowType) & colors).any())
+        return true;
+
+    // Colors referenced by the subclass configuration structures.
+    MySubclass *p_subclass = nullptr;
+    std::vector<const MyColor *> config_colors;
+    switch (this->windowType)
+    {
+    case MyWindowType::StandardButton:
+        p_subclass = static_cast<MyStandardButtonSubclass *>(this->pData);
+        break;
+    case MyWindowType::ImageButton:
+    {
+        auto p_image_button = static_cast<MyImageButtonSubclass *>(this->pData);
+        config_colors.push_back(p_image_button->imageConfig.pColorBackgroundDefault);
+        config_colors.push_back(p_image_button->imageConfig.pColorBackgroundHover);
+        config_colors.push_back(p_image_button->imageConfig.pColorBackgroundActive);
+        p_subclass = p_image_button;
+        break;
+    }
+    case MyWindowType::RadioButton:
+        p_subclass = static_cast<MyRadioButtonSubclass *>(this->pData);
+        break;
+    case MyWindowType::Editbox:
+        p_subclass = static_cast<MyEditboxSubclass *>(this->pData);
+        break;
+    case MyWindowType::DDLCombobox:
+        p_subclass = static_cast<MyDDLComboboxSubclass *>(this->pData);
+        break;
+    case MyWindowType::VerticalScrollbar:
+        p_subclass = static_cast<MyVerticalScrollbarSubclass *>(this->pData);
+        break;
+    case MyWindowType::StandardText:
+    {
+        auto p_standard_text = static_cast<MyStandardTextSubclass *>(this->pData);
+        config_colors.push_back(p_standard_text->textConfig.pTextColor);
+        p_subclass = p_standard_text;
+        break;
+    }
+    default:
+        return false;
+    }
+    config_colors.push_back(p_subclass->config.pBackground);
+
+    for (const auto &p_color : config_colors)
+    {
+        MyThemeColor color;
+        if (g_pApp->pUIManager->colors.findThemeColor(p_color, color) && colors.test(static_cast<size_t>(color)))
+            return true;
+    }
+
+    return false;
+}
 bool MyWindow::createCustomWindow(DWORD dwExStyle, LPCWSTR lpClassName, LPCWSTR lpWindowName, DWORD dwStyle,
                                   int X, int Y, int nWidth, int nHeight, HWND hWndParent, HMENU hMenu, HINSTANCE hInstance, LPVOID lpParam)
 {
@@ -503,6 +562,7 @@ bool MyWindow::createCustomWindow(DWORD dwExStyle, LPCWSTR lpClassName, LPCWSTR
             error_message = "Failed to create the window.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         this->windowType = MyWindowType::Custom;
 
@@ -552,6 +612,7 @@ bool MyWindow::createStandardButton(MyStandardButtonWindowConfig &windowConfig)
             error_message = "Failed to create the window.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         this->pData = new MyStandardButtonSubclass();
         if (!static_cast<MyStandardButtonSubclass *>(this->pData)->setWindow(window))
@@ -610,6 +671,7 @@ bool MyWindow::createImageButton(MyImageButtonWindowConfig &windowConfig)
             error_message = "Failed to create the window.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         this->pData = new MyImageButtonSubclass();
         if (!static_cast<MyImageButtonSubclass *>(this->pData)->setWindow(window, windowConfig.pSubclassConfig))
@@ -668,6 +730,7 @@ bool MyWindow::createRadioButton(MyRadioButtonWindowConfig &windowConfig)
             error_message = "Failed to create the window.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         this->pData = new MyRadioButtonSubclass();
         if (!static_cast<MyRadioButtonSubclass *>(this->pData)->setWindow(window))
@@ -744,6 +807,7 @@ bool MyWindow::createEditbox(MyEditboxWindowConfig &windowConfig)
             error_message = "Failed to create the window.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         this->pData = new MyEditboxSubclass();
         HWND &window_static = static_cast<MyEditboxSubclass *>(this->pData)->getStaticHandleRef();
@@ -813,6 +877,7 @@ bool MyWindow::createDDLCombobox(MyDDLComboboxWindowConfig &windowConfig)
             error_message = "Failed to create the window.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         this->pData = new MyDDLComboboxSubclass();
         if (!static_cast<MyDDLComboboxSubclass *>(this->pData)->setWindow(window, windowConfig.height))
@@ -883,6 +948,7 @@ bool MyWindow::createVerticalScrollbar(MyVerticalScrollbarWindowConfig &windowCo
             error_message = "Failed to create the window. (scrollbar)";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         if (!static_cast<MyVerticalScrollbarSubclass *>(this->pData)->setWindow(window_scrollbar, windowConfig.pContainer))
         {
@@ -938,6 +1004,7 @@ bool MyWindow::createStandardText(MyStandardTextWindowConfig &windowConfig)
             error_message = "Failed to create the window.";
             break;
         }
+        Deleter::onResourceCreated(MyResourceType::Window);
 
         this->pData = new MyStandardTextSubclass();
         if (!static_cast<MyStandardTextSubclass *>(this->pData)->setWindow(window, windowConfig.pSubclassConfig))
@@ -1027,6 +1094,55 @@ bool MyContainer::refresh(bool redrawContainerWindow)
 
     return are_all_operation_success;
 }
+bool MyContainer::refreshColorDependents(const std::bitset<UI_THEME_COLOR_COUNT> &colors, UINT &totalRefreshedWindows, bool isColorOnly)
+{
+    bool are_all_operation_success = false;
+    std::string error_message = "";
+    while (!are_all_operation_success)
+    {
+        totalRefreshedWindows = 0;
+
+        {
+            bool is_for_loop_failed = false;
+            for (auto &[key, p_window] : this->mWindows)
+            {
+                if (!p_window->isColorDependent(colors))
+                    continue;
+
+                if (!p_window->refresh(isColorOnly))
+                {
+                    is_for_loop_failed = true;
+                    break;
+                }
+                InvalidateRect(p_window->hWnd(), NULL, FALSE);
+                totalRefreshedWindows++;
+            }
+            if (is_for_loop_failed)
+            {
+                error_message = "Failed to refresh the container window.";
+                break;
+            }
+        }
+
+        if (this->isVerticalScrollbarWindowExists && this->verticalScrollbar()->isColorDependent(colors))
+        {
+            if (!this->verticalScrollbar()->refresh(isColorOnly))
+            {
+                error_message = "Failed to refresh the vertical scrollbar window.";
+                break;
+            }
+            InvalidateRect(this->verticalScrollbar()->hWnd(), NULL, FALSE);
+            totalRefreshedWindows++;
+        }
+
+        are_all_operation_success = true;
+    }
+
+    if (!are_all_operation_success)
+        g_pApp->logger.writeLog(error_message, "[CLASS: 'MyContainer' | FUNC: 'refreshColorDependents()']", MyLogType::Error);
+
+    return are_all_operation_success;
+}
 bool MyContainer::updateContainerDimensions(INT posX, INT posY, INT width, INT height, bool hideScrollbar, bool resetScrollPosition)
 {
     bool are_all_operation_success = false;
@@ -1286,6 +1402,7 @@ bool MyContainer::scrollContainer(INT scrollAmount, bool scrollAlternative)
                 error_message = "Failed to create the redraw region.";
                 break;
             }
+            Deleter::onResourceCreated(MyResourceType::Region);
 
             ScrollWindowEx(this->container()->hWnd(), 0, scrollAmount, nullptr, nullptr, *pRegion, nullptr, SW_SCROLLCHILDREN);
             RedrawWindow(this->container()->hWnd(), 0, *pRegion, RDW_INVALIDATE | RDW_UPDATENOW | RDW_ALLCHILDREN);
@@ -0,0 +1,150 @@
+/**
+ * @file benchmark_compare.cpp
+ * @brief Compares benchmark results with a stored baseline. (See core_benchmark.cpp)
+ * @note Portable, build with: g++ -std=c++17 -O2 Tools/benchmark_compare.cpp -o benchmark_compare
+ *       Usage: benchmark_compare <baseline file> <results file> [threshold percent]
+ * @note A benchmark regresses when its median is slower than the baseline median by more than the threshold (default 10%),
+ *       and the difference is larger than `NOISE_FACTOR` times the sum of the median absolute deviations.
+ *       Returns 0 if no benchmark regressed, 2 if any benchmark regressed, 1 on errors.
+ */
+
+#include <cstdio>   // C style input/output.
+#include <cstdlib>  // String to number conversions.
+#include <cstring>  // C string and memory functions.
+#include <string>   // String handling.
+#include <map>      // Associative containers.
+#include <fstream>  // File input/output.
+#include <iostream> // Standard streams.
+
+/****************************
+ * Compare tool definitions *
+ ****************************/
+
+static const double DEFAULT_THRESHOLD = 10.0; // Default regression threshold. (Percent)
+static const double NOISE_FACTOR = 3.0;       // Differences within this many median absolute deviations are noise.
+
+/**
+ * @brief A benchmark result read from a results file.
+ */
+struct BENCHMARKRESULT
+{
+    double medianTime = 0.0;    // Median iteration time. (Nanoseconds)
+    double deviationTime = 0.0; // Median absolute deviation of the iteration time. (Nanoseconds)
+};
+
+/**
+ * @brief Read a number field of a result line.
+ * @param line Specifies the result line.
+ * @param field Specifies the quoted field name. (e.g. "\"median_ns\"")
+ * @param value Reference to the variable that receives the value. [OUT]
+ * @return Returns true if the field is found, false otherwise.
+ */
+static bool ReadNumberField(const std::string &line, const char *field, double &value)
+{
+    size_t position = line.find(field);
+    if (position == std::string::npos)
+        return false;
+    position = line.find(':', position + strlen(field));
+    if (position == std::string::npos)
+        return false;
+
+    char *p_end = nullptr;
+    value = strtod(line.c_str() + position + 1, &p_end);
+    return (p_end != line.c_str() + position + 1);
+}
+
+/**
+ * @brief Read the results of a results file, written one result per line by the benchmarks.
+ * @param filePath Specifies the results file path.
+ * @param results Reference to the map that receives the results, indexed by benchmark name. [OUT]
+ * @return Returns true if the file is read successfully, false otherwise.
+ */
+static bool ReadResults(const char *filePath, std::map<std::string, BENCHMARKRESULT> &results)
+{
+    std::ifstream file(filePath, std::ios_base::binary);
+    if (!file.is_open())
+        return false;
+
+    std::string line = "";
+    while (std::getline(file, line))
+    {
+        size_t name_position = line.find("\"name\": \"");
+        if (name_position == std::string::npos)
+            continue;
+        name_position += strlen("\"name\": \"");
+        size_t name_end = line.find('"', name_position);
+        if (name_end == std::string::npos)
+            return false;
+
+        BENCHMARKRESULT result;
+        if (!ReadNumberField(line, "\"median_ns\"", result.medianTime) || !ReadNumberField(line, "\"mad_ns\"", result.deviationTime))
+            return false;
+        results[line.substr(name_position, name_end - name_position)] = result;
+    }
+
+    return !results.empty();
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 3)
+    {
+        std::cerr << "Usage: benchmark_compare <baseline file> <results file> [threshold percent]\n";
+        return 1;
+    }
+    double threshold = (argc >= 4 ? strtod(argv[3], nullptr) : DEFAULT_THRESHOLD);
+    if (threshold <= 0.0)
+    {
+        std::cerr << "Invalid threshold.\n";
+        return 1;
+    }
+
+    std::map<std::string, BENCHMARKRESULT> baseline_results, current_results;
+    if (!ReadResults(argv[1], baseline_results))
+    {
+        std::cerr << "Failed to read the baseline file.\n";
+        return 1;
+    }
+    if (!ReadResults(argv[2], current_results))
+    {
+        std::cerr << "Failed to read the results file.\n";
+        return 1;
+    }
+
+    size_t total_regressions = 0, total_improvements = 0;
+    printf("%-52s %12s %12s %9s  %s\n", "Benchmark", "Baseline ns", "Current ns", "Change", "Status");
+    for (const auto &[name, current] : current_results)
+    {
+        auto it = baseline_results.find(name);
+        if (it == baseline_results.end())
+        {
+            printf("%-52s %12s %12.2f %9s  %s\n", name.c_str(), "-", current.medianTime, "-", "New");
+            continue;
+        }
+
+        const BENCHMARKRESULT &baseline = it->second;
+        double change = (baseline.medianTime > 0.0 ? (current.medianTime - baseline.medianTime) * 100.0 / baseline.medianTime : 0.0);
+        double difference = (current.medianTime > baseline.medianTime ? current.medianTime - baseline.medianTime : baseline.medianTime - current.medianTime);
+        bool is_significant = (difference > NOISE_FACTOR * (baseline.deviationTime + current.deviationTime));
+        const char *status = "Ok";
+        if (is_significant && change > threshold)
+        {
+            status = "Regressed";
+            total_regressions++;
+        }
+        else if (is_significant && change < -threshold)
+        {
+            status = "Improved";
+            total_improvements++;
+        }
+        printf("%-52s %12.2f %12.2f %+8.1f%%  %s\n", name.c_str(), baseline.medianTime, current.medianTime, change, status);
+    }
+    for (const auto &[name, baseline] : baseline_results)
+    {
+        if (!current_results.count(name))
+            printf("%-52s %12.2f %12s %9s  %s\n", name.c_str(), baseline.medianTime, "-", "-", "Missing");
+    }
+
+    printf("%zu regressed, %zu improved. (Threshold: %.1f%%)\n", total_regressions, total_improvements, threshold);
+    return (total_regressions ? 2 : 0);
+}
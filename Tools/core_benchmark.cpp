@@ -0,0 +1,214 @@
+/**
+ * @file core_benchmark.cpp
+ * @brief Headless benchmark of the portable UI cores. (Text kernels, UTF transcoders, configuration store, theme tables)
+ * @note Portable, build with: g++ -std=c++17 -O2 Sources/text.cpp Sources/config.cpp Sources/theme.cpp Tools/core_benchmark.cpp -o core_benchmark
+ *       Usage: core_benchmark [output file] [name filter]
+ * @note The Win32-bound cores (logger, profiler, layout, scrolling, animation manager) are measured in the application by the profiler.
+ * @note Each benchmark is calibrated to `MINIMUM_SAMPLE_TIME` per sample, warmed up, then sampled `SAMPLE_COUNT` times.
+ *       The median and the median absolute deviation (MAD) are reported, they are not skewed by the scheduler outliers.
+ *       The results are written in JSON, one result per line, compare them with a baseline using the benchmark compare tool.
+ */
+
+#include "../Headers/portable_includes.h" // Include the portable types.
+#include "../Headers/marco.h"             // Include the global marcos.
+#include "../Headers/text.h"              // Include the portable text helpers.
+#include "../Headers/config.h"            // Include the portable configuration types.
+#include "../Headers/theme.h"             // Include the portable theme types.
+#include "../Headers/config_schema.h"     // Include the configuration file schema.
+#include <algorithm>                      // Sorting algorithms. (Sample median)
+#include <chrono>                         // Steady clock.
+#include <cstdio>                         // C style input/output.
+
+/*************************
+ * Benchmark definitions *
+ *************************/
+
+static const UINT SAMPLE_COUNT = 21;                        // Number of measured samples per benchmark.
+static const UINT WARMUP_SAMPLE_COUNT = 3;                  // Number of discarded samples per benchmark.
+static const DOUBLE MINIMUM_SAMPLE_TIME = 2000000.0;        // Minimum time of a sample, the iterations are calibrated to reach it. (Nanoseconds)
+static const UINT64 MAXIMUM_SAMPLE_ITERATIONS = 1ULL << 30; // Maximum number of iterations of a sample.
+static const size_t LONG_TEXT_LENGTH = 64 * 1024;           // Length of the long texts. (Characters)
+static volatile size_t g_totalResults = 0;                  // Sink of the benchmark results.
+
+/**
+ * @brief Result of a benchmark.
+ */
+struct BENCHMARKRESULT
+{
+    std::string name;     // Benchmark name. (Group/Function/Workload)
+    UINT64 iterations;    // Iterations per sample.
+    DOUBLE medianTime;    // Median iteration time. (Nanoseconds)
+    DOUBLE deviationTime; // Median absolute deviation of the iteration time. (Nanoseconds)
+    DOUBLE minimumTime;   // Fastest sample iteration time. (Nanoseconds)
+    DOUBLE maximumTime;   // Slowest sample iteration time. (Nanoseconds)
+};
+
+/**
+ * @brief Runs the benchmarks and collects their results.
+ */
+class BenchmarkRunner
+{
+public:
+    BenchmarkRunner(const char *nameFilter) : nameFilter(nameFilter ? nameFilter : "") {}
+
+    /**
+     * @brief Run a benchmark, if its name matches the name filter.
+     * @param name Specifies the benchmark name.
+     * @param function Specifies the benchmark iteration, called with the iteration index.
+     */
+    template <typename Function>
+    void run(const char *name, Function function)
+    {
+        if (!this->nameFilter.empty() && !strstr(name, this->nameFilter.c_str()))
+            return;
+
+        // Calibrate the iterations, doubled until a sample takes at least `MINIMUM_SAMPLE_TIME`.
+        UINT64 iterations = 1;
+        while (iterations < MAXIMUM_SAMPLE_ITERATIONS && this->measureSample(iterations, function) * static_cast<DOUBLE>(iterations) < MINIMUM_SAMPLE_TIME)
+            iterations *= 2;
+
+        for (UINT i = 0; i < WARMUP_SAMPLE_COUNT; i++)
+            this->measureSample(iterations, function);
+        std::vector<DOUBLE> samples(SAMPLE_COUNT);
+        for (UINT i = 0; i < SAMPLE_COUNT; i++)
+            samples[i] = this->measureSample(iterations, function);
+
+        std::vector<DOUBLE> sorted_samples = samples;
+        std::sort(sorted_samples.begin(), sorted_samples.end());
+        DOUBLE median_time = sorted_samples[SAMPLE_COUNT / 2];
+        std::vector<DOUBLE> deviations(SAMPLE_COUNT);
+        for (UINT i = 0; i < SAMPLE_COUNT; i++)
+            deviations[i] = (samples[i] > median_time ? samples[i] - median_time : median_time - samples[i]);
+        std::sort(deviations.begin(), deviations.end());
+
+        BENCHMARKRESULT result = {name, iterations, median_time, deviations[SAMPLE_COUNT / 2], sorted_samples.front(), sorted_samples.back()};
+        printf("%-52s %12.2f %10.2f %12.2f %12llu\n", result.name.c_str(), result.medianTime, result.deviationTime, result.minimumTime, static_cast<unsigned long long>(result.iterations));
+        this->results.push_back(result);
+    }
+
+    /**
+     * @brief Write the results in JSON, one result per line.
+     * @param filePath Specifies the output file path.
+     * @return Returns true if the results are written successfully, false otherwise.
+     */
+    bool writeResults(const char *filePath)
+    {
+        FILE *p_file = fopen(filePath, "wb");
+        if (!p_file)
+            return false;
+
+        fprintf(p_file, "{\n\"benchmark\": \"core_benchmark\",\n\"samples\": %u,\n\"results\": [\n", SAMPLE_COUNT);
+        for (size_t i = 0; i < this->results.size(); i++)
+        {
+            const BENCHMARKRESULT &result = this->results[i];
+            fprintf(p_file, "{\"name\": \"%s\", \"iterations\": %llu, \"median_ns\": %.3f, \"mad_ns\": %.3f, \"min_ns\": %.3f, \"max_ns\": %.3f}%s\n",
+                    result.name.c_str(), static_cast<unsigned long long>(result.iterations), result.medianTime, result.deviationTime, result.minimumTime, result.maximumTime, (i + 1 < this->results.size() ? "," : ""));
+        }
+        fprintf(p_file, "]\n}\n");
+
+        return (fclose(p_file) == 0);
+    }
+
+private:
+    /**
+     * @brief Measure the average iteration time of a sample.
+     * @return Returns the average iteration time. (Nanoseconds)
+     */
+    template <typename Function>
+    DOUBLE measureSample(UINT64 iterations, Function &function)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (UINT64 i = 0; i < iterations; i++)
+            function(i);
+        auto end = std::chrono::steady_clock::now();
+
+        return std::chrono::duration<DOUBLE, std::nano>(end - start).count() / static_cast<DOUBLE>(iterations);
+    }
+
+private:
+    std::string nameFilter;               // Only the benchmarks whose name contains the filter are run.
+    std::vector<BENCHMARKRESULT> results; // Results of the benchmarks run.
+};
+
+/******************
+ * Benchmark main *
+ ******************/
+
+int main(int argc, char *argv[])
+{
+    BenchmarkRunner runner(argc >= 3 ? argv[2] : nullptr);
+    printf("%-52s %12s %10s %12s %12s\n", "Benchmark", "Median ns", "MAD ns", "Min ns", "Iterations");
+
+    // Strings, the configuration values and the window texts.
+    const std::string short_values[] = {" 255", "128 ", " 64", "0"};
+    std::string long_text = "", long_mixed_text = "";
+    for (size_t i = 0; long_text.size() < LONG_TEXT_LENGTH; i++)
+        long_text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit " + std::to_string(i) + ". ";
+    while (long_mixed_text.size() < LONG_TEXT_LENGTH)
+        long_mixed_text += "Lorem ipsum dolor sit amet, Tiếng Việt, 中文, Ελληνικά, emoji \xF0\x9F\x98\x80. ";
+    std::vector<char16_t> utf16_buffer(long_mixed_text.size());
+    const size_t utf16_length = MyUtility::TranscodeUtf8ToUtf16(long_mixed_text.data(), long_mixed_text.size(), utf16_buffer.data());
+    std::vector<char> utf8_buffer(utf16_length * 3);
+    if (MyUtility::TranscodeUtf16ToUtf8(utf16_buffer.data(), utf16_length, utf8_buffer.data()) != long_mixed_text.size())
+        return 1;
+    runner.run("String/TranscodeUtf8ToUtf16/Long", [&](UINT64)
+               { g_totalResults += MyUtility::TranscodeUtf8ToUtf16(long_mixed_text.data(), long_mixed_text.size(), utf16_buffer.data()); });
+    runner.run("String/TranscodeUtf16ToUtf8/Long", [&](UINT64)
+               { g_totalResults += MyUtility::TranscodeUtf16ToUtf8(utf16_buffer.data(), utf16_length, utf8_buffer.data()); });
+    runner.run("String/FilterCharacters/Short", [&](UINT64 i)
+               { g_totalResults += MyUtility::FilterCharacters(short_values[i & 3], MyCharClass::Digit).size(); });
+    runner.run("String/FilterCharacters/Long", [&](UINT64)
+               { g_totalResults += MyUtility::FilterCharacters(long_text, MyCharClass::Digit).size(); });
+    runner.run("String/CountCharacters/Long", [&](UINT64)
+               { g_totalResults += MyUtility::CountCharacters(long_text, MyCharClass::Alpha); });
+    runner.run("String/ContainsCharacter/Long", [&](UINT64)
+               { g_totalResults += MyUtility::ContainsCharacter(long_mixed_text, MyCharClass::Digit); });
+
+    // Configuration, a full configuration file with comments and blank lines.
+    MyConfigStore config(APP_CONFIG_SCHEMA);
+    const std::string config_text =
+        "# Application configuration.\r\n"
+        "Theme = Dark\r\n"
+        "Debug = 2\r\n"
+        "\r\n"
+        "# Logging.\r\n"
+        "LogFormat = Binary\r\n"
+        "LogSegmentSize = 4096\r\n"
+        "LogSegmentCount = 8\r\n"
+        "Profiler = Off\r\n"
+        "AllocationTracker = Off\r\n"
+        "PerformanceHud = Off\r\n"
+        "InputRecording = Off\r\n"
+        "StartupSnapshot = Off\r\n"
+        "StartupTrace = Off\r\n";
+    runner.run("Config/Parse", [&](UINT64)
+               { g_totalResults += config.parse(config_text.data(), config_text.size()); });
+    runner.run("Config/Serialize", [&](UINT64)
+               { g_totalResults += config.serialize().size(); });
+    runner.run("Config/SetValue", [&](UINT64 i)
+               { g_totalResults += config.setValue(MyConfigKey::LogSegmentCount, static_cast<INT>(1 + (i & 15))); });
+
+    // Theme tables, the theme transition frames. (Synthetic tables, the built-in tables are part of the UI sources)
+    MYTHEMETABLE from_table = {}, to_table = {}, blended_table = {};
+    for (size_t i = 0; i < UI_THEME_COLOR_COUNT; i++)
+    {
+        from_table.red[i] = static_cast<BYTE>(i * 3), from_table.green[i] = static_cast<BYTE>(i * 5), from_table.blue[i] = static_cast<BYTE>(i * 7), from_table.alpha[i] = 255;
+        to_table.red[i] = static_cast<BYTE>(255 - i), to_table.green[i] = static_cast<BYTE>(i * 11), to_table.blue[i] = static_cast<BYTE>(i * 13), to_table.alpha[i] = 255;
+    }
+    runner.run("Theme/Blend", [&](UINT64 i)
+               {
+                   MYTHEMETABLE::blend(from_table, to_table, static_cast<UINT>(i & 255), blended_table);
+                   g_totalResults += blended_table.red[i % UI_THEME_COLOR_COUNT]; });
+    runner.run("Theme/TransitionFrame", [&](UINT64 i)
+               {
+                   MYTHEMETABLE::blend(from_table, to_table, MYTHEMETABLE::getTransitionWeight(static_cast<DOUBLE>(i & 1023) / 1023.0), blended_table);
+                   g_totalResults += blended_table.green[i % UI_THEME_COLOR_COUNT]; });
+
+    if (argc >= 2 && !runner.writeResults(argv[1]))
+    {
+        printf("Failed to write the results.\n");
+        return 1;
+    }
+
+    return 0;
+}
@@ -0,0 +1,195 @@
+/**
+ * @file input_replay.cpp
+ * @brief Headless replay of the input recording files. (See `MyInputRecorder`)
+ * @note Replays the records against the same virtual clock as the application and prints the frame schedule,
+ *       the records dispatched by every replay frame, then the message totals. The output only depends on the recording,
+ *       diff it to check that two sessions replay the same input before comparing their profiler traces.
+ * @note Portable, build with: g++ -std=c++17 -O2 Tools/input_replay.cpp -o input_replay
+ *       Usage: input_replay <input recording file> [frame time (microseconds)]
+ */
+
+#include <cstdint>  // Fixed width integer types.
+#include <cstdio>   // C style input/output.
+#include <cstdlib>  // String to number conversions.
+#include <cstring>  // C string and memory functions.
+#include <string>   // String handling.
+#include <vector>   // Sequence containers.
+#include <map>      // Associative containers.
+#include <iterator> // Stream iterators.
+#include <fstream>  // File input/output.
+#include <iostream> // Standard streams.
+
+#include "../Headers/marco.h" // Input recording file format constants.
+
+/***********************
+ * Replay declarations *
+ ***********************/
+
+/**
+ * @brief Input recording file header, mirrors `MYINPUTRECORDINGHEADER`.
+ */
+struct INPUTRECORDINGHEADER
+{
+    uint32_t signature;    // File signature. (INPUT_RECORDING_SIGNATURE)
+    uint32_t version;      // File format version. (INPUT_RECORDING_VERSION)
+    int32_t windowX;       // Application window x-coordinate at the recording start.
+    int32_t windowY;       // Application window y-coordinate at the recording start.
+    uint32_t windowWidth;  // Application window width at the recording start.
+    uint32_t windowHeight; // Application window height at the recording start.
+};
+
+/**
+ * @brief A recorded input message, mirrors `MYINPUTRECORD`.
+ */
+struct INPUTRECORD
+{
+    uint64_t time;            // Time since the recording start. (Microseconds)
+    uint32_t controlId;       // Control ID of the target window.
+    uint32_t parentControlId; // Control ID of the target window parent, 0 for the application window.
+    uint32_t message;         // Window message.
+    uint32_t flags;           // Record flags. (INPUT_RECORD_*)
+    uint64_t wParam;          // The first message parameter.
+    int64_t lParam;           // The second message parameter.
+};
+
+static_assert(sizeof(INPUTRECORDINGHEADER) == 24 && sizeof(INPUTRECORD) == 40, "The input recording structures must match the file format.");
+
+/**
+ * @brief Get the name of a recorded window message. (See `MyInputRecorder::isInputMessage()`)
+ * @param message Specifies the window message.
+ * @return Returns the message name, or nullptr if the message is not an input message.
+ */
+static const char *GetMessageName(uint32_t message)
+{
+    switch (message)
+    {
+    case 0x0005:
+        return "WM_SIZE";
+    case 0x0100:
+        return "WM_KEYDOWN";
+    case 0x0101:
+        return "WM_KEYUP";
+    case 0x0102:
+        return "WM_CHAR";
+    case 0x0200:
+        return "WM_MOUSEMOVE";
+    case 0x0201:
+        return "WM_LBUTTONDOWN";
+    case 0x0202:
+        return "WM_LBUTTONUP";
+    case 0x0203:
+        return "WM_LBUTTONDBLCLK";
+    case 0x0204:
+        return "WM_RBUTTONDOWN";
+    case 0x0205:
+        return "WM_RBUTTONUP";
+    case 0x0207:
+        return "WM_MBUTTONDOWN";
+    case 0x0208:
+        return "WM_MBUTTONUP";
+    case 0x020A:
+        return "WM_MOUSEWHEEL";
+    case 0x02A1:
+        return "WM_MOUSEHOVER";
+    case 0x02A3:
+        return "WM_MOUSELEAVE";
+    default:
+        return nullptr;
+    }
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: input_replay <input recording file> [frame time (microseconds)]\n";
+        return 1;
+    }
+    uint64_t frame_time = (argc >= 3 ? strtoull(argv[2], nullptr, 10) : INPUT_REPLAY_FRAME_TIME);
+    if (!frame_time)
+    {
+        std::cerr << "Invalid frame time.\n";
+        return 1;
+    }
+
+    std::string buffer = "";
+    {
+        std::ifstream file(argv[1], std::ios_base::binary);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open the input recording file.\n";
+            return 1;
+        }
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    // Little-endian hosts only, like the writer.
+    INPUTRECORDINGHEADER header = {};
+    if (buffer.size() < sizeof(header) || (buffer.size() - sizeof(header)) % sizeof(INPUTRECORD))
+    {
+        std::cerr << "The input recording file size is invalid.\n";
+        return 1;
+    }
+    memcpy(&header, buffer.data(), sizeof(header));
+    if (header.signature != INPUT_RECORDING_SIGNATURE || header.version != INPUT_RECORDING_VERSION)
+    {
+        std::cerr << "The file is not a supported input recording file.\n";
+        return 1;
+    }
+    std::vector<INPUTRECORD> records((buffer.size() - sizeof(header)) / sizeof(INPUTRECORD));
+    if (!records.empty())
+        memcpy(records.data(), buffer.data() + sizeof(header), records.size() * sizeof(INPUTRECORD));
+
+    printf("Window: %dx%d at (%d, %d), %zu record(s), frame time: %llu us\n",
+           header.windowWidth, header.windowHeight, header.windowX, header.windowY, records.size(), static_cast<unsigned long long>(frame_time));
+
+    // Advance the virtual clock one frame at a time and dispatch the records due by then, like `MyInputRecorder::advanceReplay()`.
+    std::map<std::string, size_t> message_totals;
+    uint64_t replay_time = 0, total_frames = 0, total_input_frames = 0, busiest_frame = 0;
+    size_t replay_position = 0, busiest_frame_records = 0;
+    while (replay_position < records.size())
+    {
+        replay_time += frame_time;
+        total_frames++;
+
+        size_t frame_records = 0;
+        while (replay_position < records.size() && records[replay_position].time <= replay_time)
+        {
+            const INPUTRECORD &record = records[replay_position++];
+            const char *message_name = GetMessageName(record.message);
+            char unknown_name[16];
+            if (!message_name)
+            {
+                snprintf(unknown_name, sizeof(unknown_name), "0x%04X", record.message);
+                message_name = unknown_name;
+            }
+
+            if (!frame_records)
+                printf("Frame %llu (%.3f ms)\n", static_cast<unsigned long long>(total_frames), static_cast<double>(replay_time) / 1000.0);
+            if (record.flags & INPUT_RECORD_APPLICATION_WINDOW)
+                printf("  %-16s -> application window, wParam: 0x%llX, lParam: 0x%llX\n", message_name,
+                       static_cast<unsigned long long>(record.wParam), static_cast<unsigned long long>(record.lParam));
+            else
+                printf("  %-16s -> control %u (parent %u), wParam: 0x%llX, lParam: 0x%llX\n", message_name, record.controlId, record.parentControlId,
+                       static_cast<unsigned long long>(record.wParam), static_cast<unsigned long long>(record.lParam));
+
+            message_totals[message_name]++;
+            frame_records++;
+        }
+
+        if (frame_records)
+            total_input_frames++;
+        if (frame_records > busiest_frame_records)
+        {
+            busiest_frame_records = frame_records;
+            busiest_frame = total_frames;
+        }
+    }
+
+    printf("%llu frame(s), %llu with input, busiest frame: %llu (%zu record(s))\n", static_cast<unsigned long long>(total_frames),
+           static_cast<unsigned long long>(total_input_frames), static_cast<unsigned long long>(busiest_frame), busiest_frame_records);
+    for (const auto &[name, total] : message_totals)
+        printf("  %-16s %zu\n", name.c_str(), total);
+
+    return 0;
+}
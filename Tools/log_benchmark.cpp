@@ -0,0 +1,100 @@
+/**
+ * @file log_benchmark.cpp
+ * @brief Benchmark of the log call overhead. (See `MY_LOG()`)
+ * @note Built from the application sources with a console entry point, see the 'mingw64-tools' build task.
+ *       The records are written next to the executable. (log_benchmark.log, log.bin)
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+#include <cstdio>                         // C style input/output.
+
+/*************************
+ * Benchmark definitions *
+ *************************/
+
+static const UINT64 DISABLED_CALL_ITERATIONS = 10000000; // Iterations of the disabled log call benchmarks.
+static const UINT64 ENABLED_CALL_ITERATIONS = 200000;    // Iterations of the enabled log call benchmarks.
+
+/**
+ * @brief Measure the average time of a benchmark iteration.
+ * @param iterations Specifies the number of iterations.
+ * @param function Specifies the benchmark iteration, called with the iteration index.
+ * @return Returns the average iteration time. (Nanoseconds)
+ */
+template <typename Function>
+static DOUBLE MeasureNanoseconds(UINT64 iterations, Function function)
+{
+    LARGE_INTEGER frequency, start, end;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&start);
+    for (UINT64 i = 0; i < iterations; i++)
+    {
+        function(i);
+        std::atomic_signal_fence(std::memory_order_seq_cst); // Compiler barrier, keep the log level check inside the loop.
+    }
+    QueryPerformanceCounter(&end);
+
+    return static_cast<DOUBLE>(end.QuadPart - start.QuadPart) * 1000000000.0 / static_cast<DOUBLE>(frequency.QuadPart) / static_cast<DOUBLE>(iterations);
+}
+
+// Debug log call compiled out by the compile-time log level.
+#undef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 1
+static DOUBLE MeasureCompiledOutLogCall(MyLogger &logger)
+{
+    return MeasureNanoseconds(DISABLED_CALL_ITERATIONS, [&](UINT64 i)
+                              { MY_LOG(logger, MyLogType::Debug, "Current desktop resolution:", "'{}x{}'", 1920 + (i & 1), 1080); });
+}
+#undef LOG_COMPILE_LEVEL
+#define LOG_COMPILE_LEVEL 2
+
+/******************
+ * Benchmark main *
+ ******************/
+
+int main()
+{
+    WCHAR module_path[MAX_PATH];
+    if (!GetModuleFileNameW(nullptr, module_path, MAX_PATH))
+        return 1;
+
+    MyLogger logger(module_path);
+    logger.setLogFileName(L"log_benchmark.log");
+
+    // Disabled debug records. (Log level 1)
+    logger.setLogLevel(1);
+    DOUBLE baseline_time = MeasureNanoseconds(DISABLED_CALL_ITERATIONS, [&](UINT64)
+                                              {});
+    DOUBLE disabled_write_log_time = MeasureNanoseconds(DISABLED_CALL_ITERATIONS, [&](UINT64 i)
+                                                        { logger.writeLog("Current desktop resolution:", ("'" + std::to_string(1920 + (i & 1)) + "x" + std::to_string(1080) + "'").c_str(), MyLogType::Debug); });
+    DOUBLE disabled_my_log_time = MeasureNanoseconds(DISABLED_CALL_ITERATIONS, [&](UINT64 i)
+                                                     { MY_LOG(logger, MyLogType::Debug, "Current desktop resolution:", "'{}x{}'", 1920 + (i & 1), 1080); });
+    DOUBLE compiled_out_my_log_time = MeasureCompiledOutLogCall(logger);
+
+    // Enabled debug records, producer side cost. (Asynchronous mode)
+    logger.setLogLevel(2);
+    if (!logger.startAsync())
+        return 1;
+    DOUBLE enabled_text_write_log_time = MeasureNanoseconds(ENABLED_CALL_ITERATIONS, [&](UINT64 i)
+                                                            { logger.writeLog("Current desktop resolution:", ("'" + std::to_string(1920 + (i & 1)) + "x" + std::to_string(1080) + "'").c_str(), MyLogType::Debug); });
+    DOUBLE enabled_text_my_log_time = MeasureNanoseconds(ENABLED_CALL_ITERATIONS, [&](UINT64 i)
+                                                         { MY_LOG(logger, MyLogType::Debug, "Current desktop resolution:", "'{}x{}'", 1920 + (i & 1), 1080); });
+    if (!logger.setLogFormat(MyLogFormat::Binary))
+        return 1;
+    DOUBLE enabled_binary_my_log_time = MeasureNanoseconds(ENABLED_CALL_ITERATIONS, [&](UINT64 i)
+                                                           { MY_LOG(logger, MyLogType::Debug, "Current desktop resolution:", "'{}x{}'", 1920 + (i & 1), 1080); });
+    logger.stopAsync();
+
+    printf("%-56s %10s\n", "Log call", "ns/call");
+    printf("%-56s %10.2f\n", "Baseline (empty loop)", baseline_time);
+    printf("%-56s %10.2f\n", "Disabled writeLog() with std::string arguments", disabled_write_log_time);
+    printf("%-56s %10.2f\n", "Disabled MY_LOG() (runtime log level)", disabled_my_log_time);
+    printf("%-56s %10.2f\n", "Compiled out MY_LOG() (LOG_COMPILE_LEVEL=1)", compiled_out_my_log_time);
+    printf("%-56s %10.2f\n", "Enabled writeLog(), text format (asynchronous)", enabled_text_write_log_time);
+    printf("%-56s %10.2f\n", "Enabled MY_LOG(), text format (asynchronous)", enabled_text_my_log_time);
+    printf("%-56s %10.2f\n", "Enabled MY_LOG(), binary format (asynchronous)", enabled_binary_my_log_time);
+    printf("Dropped records: %llu, blocked records: %llu\n", logger.getTotalDroppedRecords(), logger.getTotalBlockedRecords());
+
+    return 0;
+}
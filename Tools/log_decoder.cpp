@@ -0,0 +1,346 @@
+/**
+ * @file log_decoder.cpp
+ * @brief Offline decoder of the binary log files. (See `MyLogFormat::Binary`)
+ * @note Renders the binary records in the text log format, the file format is described in marco.h.
+ * @note Portable, build with: g++ -std=c++17 -O2 Tools/log_decoder.cpp -o log_decoder
+ *       Usage: log_decoder <binary log file> [output file]
+ * @note Every rotated log segment (log.bin, log.1.bin, ...) starts a new session and decodes on its own.
+ */
+
+#include <cstdint>  // Fixed width integer types.
+#include <cstdio>   // C style input/output.
+#include <cstring>  // C string and memory functions.
+#include <ctime>    // Time conversions.
+#include <string>   // String handling.
+#include <vector>   // Sequence containers.
+#include <iterator> // Stream iterators.
+#include <fstream>  // File input/output.
+#include <iostream> // Standard streams.
+
+#include "../Headers/marco.h" // Binary log file format constants.
+
+/************************
+ * Decoder declarations *
+ ************************/
+
+/**
+ * @brief A call site definition read from the binary log file.
+ */
+struct LOGCALLSITE
+{
+    bool isDefined = false;       // Indicate whether the call site is defined in the current session.
+    uint8_t logType = 0;          // Record log type. (`MyLogType`)
+    uint8_t flags = 0;            // Call site flags. (LOG_BINARY_CALLSITE_*)
+    std::string description;      // Record description.
+    std::string extraDescription; // Record extra description.
+};
+
+/**
+ * @brief State of the binary log session being decoded.
+ */
+struct LOGSESSION
+{
+    int64_t counterFrequency = 1;       // Performance counter frequency.
+    int64_t baseTime = 0;               // Time at the session start. (Unix time)
+    int32_t timeBias = 0;               // Local time offset from UTC at the session start. (Seconds)
+    std::vector<LOGCALLSITE> callSites; // Call sites, indexed by call site ID.
+};
+
+/**
+ * @brief Sequential reader of the binary log file bytes.
+ */
+class LogReader
+{
+public:
+    LogReader(const std::string &buffer) : buffer(buffer) {}
+
+    bool isEnd() const { return this->offset >= this->buffer.size(); }
+    size_t getOffset() const { return this->offset; }
+    bool readByte(uint8_t &value)
+    {
+        if (this->offset >= this->buffer.size())
+            return false;
+        value = static_cast<uint8_t>(this->buffer[this->offset++]);
+        return true;
+    }
+    bool readFixed(void *pValue, size_t size)
+    {
+        if (this->buffer.size() - this->offset < size)
+            return false;
+        memcpy(pValue, this->buffer.data() + this->offset, size); // Little-endian hosts only, like the writer.
+        this->offset += size;
+        return true;
+    }
+    bool readVarint(uint64_t &value)
+    {
+        value = 0;
+        for (unsigned shift = 0; shift < 64; shift += 7)
+        {
+            uint8_t byte = 0;
+            if (!this->readByte(byte))
+                return false;
+            value |= static_cast<uint64_t>(byte & 0x7F) << shift;
+            if (!(byte & 0x80))
+                return true;
+        }
+        return false;
+    }
+    bool readString(std::string &value)
+    {
+        uint64_t length = 0;
+        if (!this->readVarint(length) || length > this->buffer.size() - this->offset)
+            return false;
+        value.assign(this->buffer, this->offset, static_cast<size_t>(length));
+        this->offset += static_cast<size_t>(length);
+        return true;
+    }
+
+private:
+    const std::string &buffer;
+    size_t offset = 0;
+};
+
+/***************************
+ * Decoder implementations *
+ ***************************/
+
+/**
+ * @brief Format a time in the text log format.
+ * @param session Specifies the session.
+ * @param ticks Specifies the performance counter ticks since the session start.
+ * @return Returns the formatted time.
+ */
+static std::string FormatTime(const LOGSESSION &session, uint64_t ticks)
+{
+    // Local time, with the UTC offset of the machine that wrote the log.
+    time_t time = static_cast<time_t>(session.baseTime + static_cast<int64_t>(ticks / static_cast<uint64_t>(session.counterFrequency)) + session.timeBias);
+    tm time_struct;
+#ifdef _WIN32
+    if (gmtime_s(&time_struct, &time))
+        return "";
+#else
+    if (!gmtime_r(&time, &time_struct))
+        return "";
+#endif
+    char text_buffer[80];
+    strftime(text_buffer, 79, "%Y-%m-%d.%H:%M:%S", &time_struct);
+
+    return text_buffer;
+}
+
+/**
+ * @brief Decode an event argument and append its text.
+ * @param reader Specifies the reader.
+ * @param text Reference to the string that the argument text is appended to. [OUT]
+ * @return Returns true if the argument is decoded successfully, false otherwise.
+ */
+static bool DecodeArgument(LogReader &reader, std::string &text)
+{
+    uint8_t type = 0;
+    uint64_t value = 0;
+    if (!reader.readByte(type))
+        return false;
+
+    switch (type)
+    {
+    case LOG_BINARY_ARGUMENT_SIGNED:
+        if (!reader.readVarint(value))
+            return false;
+        text += std::to_string(static_cast<int64_t>((value >> 1) ^ (0 - (value & 1))));
+        return true;
+    case LOG_BINARY_ARGUMENT_UNSIGNED:
+        if (!reader.readVarint(value))
+            return false;
+        text += std::to_string(value);
+        return true;
+    case LOG_BINARY_ARGUMENT_FLOAT:
+    {
+        double float_value = 0.0;
+        char text_buffer[32];
+        if (!reader.readFixed(&float_value, sizeof(float_value)))
+            return false;
+        snprintf(text_buffer, sizeof(text_buffer), "%g", float_value);
+        text += text_buffer;
+        return true;
+    }
+    case LOG_BINARY_ARGUMENT_STRING:
+    {
+        std::string string_value = "";
+        if (!reader.readString(string_value))
+            return false;
+        text += string_value;
+        return true;
+    }
+    }
+
+    return false;
+}
+
+/**
+ * @brief Decode an event record and append its text line.
+ * @note Matches `MyLogger::formatStructuredRecord()` and `MyLogger::formatRecord()`.
+ * @param reader Specifies the reader, positioned after the record kind.
+ * @param session Specifies the session.
+ * @param line Reference to the string that the line is appended to. [OUT]
+ * @return Returns true if the record is decoded successfully, false otherwise.
+ */
+static bool DecodeEvent(LogReader &reader, const LOGSESSION &session, std::string &line)
+{
+    static const char *log_type_names[] = {"(INFO)", "(WARN)", "(ERROR)", "(DEBUG)"};
+
+    uint64_t call_site_id = 0, ticks = 0;
+    uint8_t total_arguments = 0;
+    if (!reader.readVarint(call_site_id) || !reader.readVarint(ticks) || !reader.readByte(total_arguments))
+        return false;
+    if (call_site_id >= session.callSites.size() || !session.callSites[call_site_id].isDefined)
+        return false;
+    const LOGCALLSITE &call_site = session.callSites[call_site_id];
+
+    std::string text = "";
+    uint8_t total_decoded_arguments = 0;
+    const std::string *descriptions[] = {&call_site.description, &call_site.extraDescription};
+    for (size_t i = 0; i < 2; i++)
+    {
+        const std::string &description = *descriptions[i];
+        if (description.empty())
+            continue;
+        if (i)
+            text += " ";
+
+        size_t position = 0;
+        while (true)
+        {
+            size_t placeholder_position = (total_decoded_arguments < total_arguments ? description.find("{}", position) : std::string::npos);
+            if (placeholder_position == std::string::npos)
+            {
+                text.append(description, position, std::string::npos);
+                break;
+            }
+            text.append(description, position, placeholder_position - position);
+            if (!DecodeArgument(reader, text))
+                return false;
+            total_decoded_arguments++;
+            position = placeholder_position + 2;
+        }
+    }
+    for (; total_decoded_arguments < total_arguments; total_decoded_arguments++)
+    {
+        text += " ";
+        if (!DecodeArgument(reader, text))
+            return false;
+    }
+
+    if (call_site.flags & LOG_BINARY_CALLSITE_CUSTOM)
+    {
+        if (call_site.flags & LOG_BINARY_CALLSITE_INCLUDETIME)
+            line += "[" + FormatTime(session, ticks) + "] ";
+    }
+    else
+    {
+        line += "[" + FormatTime(session, ticks) + "] ";
+        line += (call_site.logType < 4 ? log_type_names[call_site.logType] : "(UNKNOWN)");
+        line += " ";
+    }
+    line += text;
+    line += "\n";
+
+    return true;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc < 2)
+    {
+        std::cerr << "Usage: log_decoder <binary log file> [output file]\n";
+        return 1;
+    }
+
+    std::string buffer = "";
+    {
+        std::ifstream file(argv[1], std::ios_base::binary);
+        if (!file.is_open())
+        {
+            std::cerr << "Failed to open the binary log file.\n";
+            return 1;
+        }
+        buffer.assign(std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>());
+    }
+
+    std::ofstream output_file;
+    if (argc >= 3)
+    {
+        output_file.open(argv[2], std::ios_base::binary);
+        if (!output_file.is_open())
+        {
+            std::cerr << "Failed to open the output file.\n";
+            return 1;
+        }
+    }
+    std::ostream &output = (argc >= 3 ? static_cast<std::ostream &>(output_file) : std::cout);
+
+    LogReader reader(buffer);
+    LOGSESSION session;
+    bool is_session_started = false;
+    bool is_decoded = true;
+    size_t total_records = 0;
+    std::string lines = "";
+    while (!reader.isEnd())
+    {
+        size_t record_offset = reader.getOffset();
+        uint8_t kind = 0;
+        reader.readByte(kind);
+        if (!kind)
+            break; // Zero-filled tail of a preallocated log segment. (Crash)
+        if (kind == LOG_BINARY_RECORD_SESSION)
+        {
+            uint32_t signature = 0;
+            uint8_t version = 0;
+            LOGSESSION new_session;
+            if (!reader.readFixed(&signature, sizeof(signature)) || signature != LOG_BINARY_SIGNATURE || !reader.readByte(version) || version != LOG_BINARY_VERSION ||
+                !reader.readFixed(&new_session.counterFrequency, sizeof(new_session.counterFrequency)) || new_session.counterFrequency <= 0 ||
+                !reader.readFixed(&new_session.baseTime, sizeof(new_session.baseTime)) || !reader.readFixed(&new_session.timeBias, sizeof(new_session.timeBias)))
+                is_decoded = false;
+            session = new_session;
+            is_session_started = true;
+        }
+        else if (kind == LOG_BINARY_RECORD_CALLSITE && is_session_started)
+        {
+            uint64_t call_site_id = 0;
+            LOGCALLSITE call_site;
+            if (!reader.readVarint(call_site_id) || call_site_id >= UINT16_MAX || !reader.readByte(call_site.logType) || !reader.readByte(call_site.flags) ||
+                !reader.readString(call_site.description) || !reader.readString(call_site.extraDescription))
+                is_decoded = false;
+            else
+            {
+                call_site.isDefined = true;
+                if (session.callSites.size() <= call_site_id)
+                    session.callSites.resize(static_cast<size_t>(call_site_id) + 1);
+                session.callSites[call_site_id] = call_site;
+            }
+        }
+        else if (kind == LOG_BINARY_RECORD_EVENT && is_session_started)
+        {
+            if (!DecodeEvent(reader, session, lines))
+                is_decoded = false;
+            else
+                total_records++;
+        }
+        else
+            is_decoded = false;
+
+        if (!is_decoded)
+        {
+            std::cerr << "Malformed or truncated record at offset " << record_offset << ", stopped decoding.\n";
+            break;
+        }
+        if (lines.size() >= 64 * 1024)
+        {
+            output << lines;
+            lines.clear();
+        }
+    }
+    output << lines;
+
+    std::cerr << "Decoded " << total_records << " records.\n";
+    return (is_decoded ? 0 : 1);
+}
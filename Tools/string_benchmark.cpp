@@ -0,0 +1,227 @@
+/**
+ * @file string_benchmark.cpp
+ * @brief Benchmark of the string utilities. (See `MyUtility::ContainsWord()`, `MyUtility::ConvertStringToWideString()`)
+ * @note Built from the application sources with a console entry point, see the 'mingw64-tools' build task.
+ * @note The previous implementations are kept here as the baselines, and their results are checked against the current ones.
+ * @note The character class kernels are benchmarked by the portable text benchmark. (See text_benchmark.cpp)
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+#include <cstdio>                         // C style input/output.
+
+/*************************
+ * Benchmark definitions *
+ *************************/
+
+static const UINT64 SHORT_KEY_ITERATIONS = 2000000;   // Iterations of the short key benchmarks.
+static const UINT64 LONG_HAYSTACK_ITERATIONS = 2000;  // Iterations of the long haystack benchmarks.
+static const size_t LONG_HAYSTACK_LENGTH = 64 * 1024; // Length of the long haystack. (Characters)
+static const UINT64 SHORT_TEXT_ITERATIONS = 2000000;  // Iterations of the short text conversion benchmarks.
+static const UINT64 LONG_TEXT_ITERATIONS = 5000;      // Iterations of the long text conversion benchmarks.
+static volatile size_t g_totalMatches = 0;            // Sink of the benchmark results.
+
+/**
+ * @brief Measure the average time of a benchmark iteration.
+ * @param iterations Specifies the number of iterations.
+ * @param function Specifies the benchmark iteration, called with the iteration index.
+ * @return Returns the average iteration time. (Nanoseconds)
+ */
+template <typename Function>
+static DOUBLE MeasureNanoseconds(UINT64 iterations, Function function)
+{
+    LARGE_INTEGER frequency, start, end;
+    QueryPerformanceFrequency(&frequency);
+    QueryPerformanceCounter(&start);
+    for (UINT64 i = 0; i < iterations; i++)
+        function(i);
+    QueryPerformanceCounter(&end);
+
+    return static_cast<DOUBLE>(end.QuadPart - start.QuadPart) * 1000000000.0 / static_cast<DOUBLE>(frequency.QuadPart) / static_cast<DOUBLE>(iterations);
+}
+
+/**
+ * @brief The previous `MyUtility::ContainsWord()` implementation. (Lower case copies on every call)
+ */
+template <typename String>
+static bool LegacyContainsWord(const String &str, const String &word, bool caseSensitive, bool checkBoundaries)
+{
+    auto to_lower = [](const String &text)
+    {
+        String text_lowercase;
+        for (auto ch : text)
+            text_lowercase += static_cast<typename String::value_type>(sizeof(ch) == 1 ? std::tolower(ch) : std::towlower(ch));
+        return text_lowercase;
+    };
+    auto is_alpha = [](typename String::value_type ch)
+    { return (sizeof(ch) == 1 ? isalpha(ch) : iswalpha(ch)) != 0; };
+
+    size_t found = str.find(word);
+    if (found != String::npos && (!checkBoundaries || ((found == 0 || !is_alpha(str[found - 1])) && (found + word.length() == str.length() || !is_alpha(str[found + word.length()])))))
+        return true;
+    if (caseSensitive)
+        return false;
+
+    String str_lowercase = to_lower(str), word_lowercase = to_lower(word);
+    found = str_lowercase.find(word_lowercase);
+    return (found != String::npos && (!checkBoundaries || ((found == 0 || !is_alpha(str_lowercase[found - 1])) && (found + word_lowercase.length() == str_lowercase.length() || !is_alpha(str_lowercase[found + word_lowercase.length()])))));
+}
+
+/**
+ * @brief The previous `MyUtility::ConvertStringToWideString()` implementation. (Sizing call, temporary buffer and copy)
+ */
+static std::wstring LegacyConvertStringToWideString(const std::string &str)
+{
+    int text_length = MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, NULL, 0);
+    std::unique_ptr<wchar_t[]> p_text_buffer(new wchar_t[text_length]);
+    MultiByteToWideChar(CP_UTF8, 0, str.c_str(), -1, p_text_buffer.get(), text_length);
+    return std::wstring(p_text_buffer.get());
+}
+
+/**
+ * @brief The previous `MyUtility::ConvertWideStringToString()` implementation. (Sizing call, temporary buffer and copy)
+ */
+static std::string LegacyConvertWideStringToString(const std::wstring &wstr)
+{
+    int text_length = WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, NULL, 0, NULL, NULL);
+    std::unique_ptr<char[]> p_text_buffer(new char[text_length]);
+    WideCharToMultiByte(CP_UTF8, 0, wstr.c_str(), -1, p_text_buffer.get(), text_length, NULL, NULL);
+    return std::string(p_text_buffer.get());
+}
+
+/**
+ * @brief Print a benchmark result row.
+ */
+static void PrintResult(const char *name, DOUBLE legacyTime, DOUBLE currentTime)
+{
+    printf("%-48s %12.2f %12.2f %8.2fx\n", name, legacyTime, currentTime, legacyTime / currentTime);
+}
+
+/******************
+ * Benchmark main *
+ ******************/
+
+int main()
+{
+    // Short keys, the theme and configuration file lines.
+    const std::string short_lines[] = {"Theme=Dark", "LogFormat = Binary", "  debug = true  ; Enable the debug records.", "LogSegmentSize=1024"};
+    const std::string short_keys[] = {"dark", "Binary", "Debug", "LogSegmentCount"};
+    const std::wstring short_wide_lines[] = {L"Theme=Dark", L"LogFormat = Binary", L"  debug = true  ; Enable the debug records.", L"LogSegmentSize=1024"};
+    const std::wstring short_wide_keys[] = {L"dark", L"Binary", L"Debug", L"LogSegmentCount"};
+
+    // Long haystack, the word is at the end.
+    std::string long_haystack = "";
+    for (size_t i = 0; long_haystack.size() < LONG_HAYSTACK_LENGTH; i++)
+        long_haystack += "Lorem ipsum dolor sit amet, consectetur adipiscing elit " + std::to_string(i) + ". ";
+    long_haystack += "Monokai";
+    const std::string long_key = "MONOKAI";
+    const std::wstring long_wide_haystack(long_haystack.begin(), long_haystack.end());
+    const std::wstring long_wide_key(long_key.begin(), long_key.end());
+
+    // Check the current implementation against the baseline.
+    for (UINT mode = 0; mode < 4; mode++)
+    {
+        bool case_sensitive = (mode & 1), check_boundaries = (mode & 2);
+        for (size_t i = 0; i < 4; i++)
+        {
+            if (MyUtility::ContainsWord(short_lines[i], short_keys[i], case_sensitive, check_boundaries) != LegacyContainsWord(short_lines[i], short_keys[i], case_sensitive, check_boundaries) ||
+                MyUtility::ContainsWord(short_wide_lines[i], short_wide_keys[i], case_sensitive, check_boundaries) != LegacyContainsWord(short_wide_lines[i], short_wide_keys[i], case_sensitive, check_boundaries))
+            {
+                printf("Result mismatch. (Line: '%s', key: '%s', mode: %u)\n", short_lines[i].c_str(), short_keys[i].c_str(), mode);
+                return 1;
+            }
+        }
+        if (MyUtility::ContainsWord(long_haystack, long_key, case_sensitive, check_boundaries) != LegacyContainsWord(long_haystack, long_key, case_sensitive, check_boundaries))
+        {
+            printf("Result mismatch. (Long haystack, mode: %u)\n", mode);
+            return 1;
+        }
+    }
+
+    printf("%-48s %12s %12s %9s\n", "ContainsWord()", "Legacy ns", "Current ns", "Speedup");
+    PrintResult("Short keys, case-insensitive",
+                MeasureNanoseconds(SHORT_KEY_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += LegacyContainsWord(short_lines[i & 3], short_keys[i & 3], false, false); }),
+                MeasureNanoseconds(SHORT_KEY_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += MyUtility::ContainsWord(short_lines[i & 3], short_keys[i & 3], false, false); }));
+    PrintResult("Short keys, case-insensitive, word boundaries",
+                MeasureNanoseconds(SHORT_KEY_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += LegacyContainsWord(short_lines[i & 3], short_keys[i & 3], false, true); }),
+                MeasureNanoseconds(SHORT_KEY_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += MyUtility::ContainsWord(short_lines[i & 3], short_keys[i & 3], false, true); }));
+    PrintResult("Short wide keys, case-insensitive",
+                MeasureNanoseconds(SHORT_KEY_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += LegacyContainsWord(short_wide_lines[i & 3], short_wide_keys[i & 3], false, false); }),
+                MeasureNanoseconds(SHORT_KEY_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += MyUtility::ContainsWord(short_wide_lines[i & 3], short_wide_keys[i & 3], false, false); }));
+    PrintResult("Long haystack, case-sensitive",
+                MeasureNanoseconds(LONG_HAYSTACK_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyContainsWord(long_haystack, long_key, true, false); }),
+                MeasureNanoseconds(LONG_HAYSTACK_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ContainsWord(long_haystack, long_key, true, false); }));
+    PrintResult("Long haystack, case-insensitive",
+                MeasureNanoseconds(LONG_HAYSTACK_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyContainsWord(long_haystack, long_key, false, false); }),
+                MeasureNanoseconds(LONG_HAYSTACK_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ContainsWord(long_haystack, long_key, false, false); }));
+    PrintResult("Long wide haystack, case-insensitive",
+                MeasureNanoseconds(LONG_HAYSTACK_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyContainsWord(long_wide_haystack, long_wide_key, false, false); }),
+                MeasureNanoseconds(LONG_HAYSTACK_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ContainsWord(long_wide_haystack, long_wide_key, false, false); }));
+
+    // Short texts, the log records and the window texts. Long texts, ASCII and mixed scripts.
+    const std::string short_texts[] = {"Theme pack loaded:", "'C:\\Users\\Default\\Themes\\Monokai.ini'", "Phiên bản 1.0", "窗口标题"};
+    std::string long_ascii_text = long_haystack, long_mixed_text = "";
+    while (long_mixed_text.size() < LONG_HAYSTACK_LENGTH)
+        long_mixed_text += "Lorem ipsum dolor sit amet, Tiếng Việt, 中文, Ελληνικά, emoji \xF0\x9F\x98\x80. ";
+    const std::wstring short_wide_texts[] = {MyUtility::ConvertStringToWideString(short_texts[0]), MyUtility::ConvertStringToWideString(short_texts[1]),
+                                             MyUtility::ConvertStringToWideString(short_texts[2]), MyUtility::ConvertStringToWideString(short_texts[3])};
+    const std::wstring long_wide_ascii_text = MyUtility::ConvertStringToWideString(long_ascii_text);
+    const std::wstring long_wide_mixed_text = MyUtility::ConvertStringToWideString(long_mixed_text);
+
+    // Check the current implementation against the baseline.
+    for (const std::string *p_text : {&short_texts[0], &short_texts[1], &short_texts[2], &short_texts[3], &long_ascii_text, &long_mixed_text})
+    {
+        std::wstring wide_text = MyUtility::ConvertStringToWideString(*p_text);
+        if (wide_text != LegacyConvertStringToWideString(*p_text) || MyUtility::ConvertWideStringToString(wide_text) != LegacyConvertWideStringToString(wide_text))
+        {
+            printf("Result mismatch. (Text: '%.32s')\n", p_text->c_str());
+            return 1;
+        }
+    }
+
+    printf("\n%-48s %12s %12s %9s\n", "Convert*String()", "Legacy ns", "Current ns", "Speedup");
+    PrintResult("Short texts, UTF-8 to UTF-16",
+                MeasureNanoseconds(SHORT_TEXT_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += LegacyConvertStringToWideString(short_texts[i & 3]).size(); }),
+                MeasureNanoseconds(SHORT_TEXT_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += MyUtility::ConvertStringToWideString(short_texts[i & 3]).size(); }));
+    PrintResult("Short texts, UTF-16 to UTF-8",
+                MeasureNanoseconds(SHORT_TEXT_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += LegacyConvertWideStringToString(short_wide_texts[i & 3]).size(); }),
+                MeasureNanoseconds(SHORT_TEXT_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += MyUtility::ConvertWideStringToString(short_wide_texts[i & 3]).size(); }));
+    PrintResult("Long ASCII text, UTF-8 to UTF-16",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyConvertStringToWideString(long_ascii_text).size(); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ConvertStringToWideString(long_ascii_text).size(); }));
+    PrintResult("Long ASCII text, UTF-16 to UTF-8",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyConvertWideStringToString(long_wide_ascii_text).size(); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ConvertWideStringToString(long_wide_ascii_text).size(); }));
+    PrintResult("Long mixed text, UTF-8 to UTF-16",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyConvertStringToWideString(long_mixed_text).size(); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ConvertStringToWideString(long_mixed_text).size(); }));
+    PrintResult("Long mixed text, UTF-16 to UTF-8",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyConvertWideStringToString(long_wide_mixed_text).size(); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ConvertWideStringToString(long_wide_mixed_text).size(); }));
+
+    return 0;
+}
@@ -0,0 +1,158 @@
+/**
+ * @file text_benchmark.cpp
+ * @brief Benchmark of the character class kernels. (See `MyUtility::FilterCharacters()`, `MyUtility::CountCharacters()`)
+ * @note Portable, build with: g++ -std=c++17 -O2 Sources/text.cpp Tools/text_benchmark.cpp -o text_benchmark
+ * @note The previous implementations are kept here as the baselines, and their results are checked against the current ones.
+ *       Each row is the median of `SAMPLE_COUNT` samples, timed with the steady clock.
+ */
+
+#include "../Headers/portable_includes.h" // Include the portable types.
+#include "../Headers/text.h"              // Include the portable text helpers.
+#include <algorithm>                      // Sorting algorithms. (Sample median)
+#include <cctype>                         // Character classification. (Baselines)
+#include <chrono>                         // Steady clock.
+#include <cstdio>                         // C style input/output.
+#include <regex>                          // Regular expressions. (Baselines)
+#include <vector>                         // Sequence containers.
+
+/*************************
+ * Benchmark definitions *
+ *************************/
+
+static const UINT SAMPLE_COUNT = 7;                   // Number of samples per row, the median is reported.
+static const UINT64 SHORT_VALUE_ITERATIONS = 2000000; // Iterations of the short value filter benchmarks.
+static const UINT64 LONG_TEXT_ITERATIONS = 5000;      // Iterations of the long text benchmarks.
+static const size_t LONG_TEXT_LENGTH = 64 * 1024;     // Length of the long texts. (Characters)
+static volatile size_t g_totalMatches = 0;            // Sink of the benchmark results.
+
+/**
+ * @brief Measure the median time of a benchmark iteration.
+ * @param iterations Specifies the number of iterations per sample.
+ * @param function Specifies the benchmark iteration, called with the iteration index.
+ * @return Returns the median iteration time of the samples. (Nanoseconds)
+ */
+template <typename Function>
+static DOUBLE MeasureNanoseconds(UINT64 iterations, Function function)
+{
+    std::vector<DOUBLE> samples(SAMPLE_COUNT);
+    for (UINT sample = 0; sample < SAMPLE_COUNT; sample++)
+    {
+        auto start = std::chrono::steady_clock::now();
+        for (UINT64 i = 0; i < iterations; i++)
+            function(i);
+        auto end = std::chrono::steady_clock::now();
+
+        samples[sample] = std::chrono::duration<DOUBLE, std::nano>(end - start).count() / static_cast<DOUBLE>(iterations);
+    }
+    std::sort(samples.begin(), samples.end());
+
+    return samples[SAMPLE_COUNT / 2];
+}
+
+/**
+ * @brief The previous `MyUtility::RemoveNonDigitFromString()` implementation. (Regular expression)
+ */
+static std::string LegacyRemoveNonDigitFromString(const std::string &str)
+{
+    return std::regex_replace(str, std::regex("\\D"), "");
+}
+
+/**
+ * @brief The previous `MyUtility::ContainsDigit()` implementation. (Scalar scan)
+ */
+static bool LegacyContainsDigit(const std::string &str)
+{
+    for (const auto &ch : str)
+    {
+        if (isdigit(static_cast<unsigned char>(ch)))
+            return true;
+    }
+
+    return false;
+}
+
+/**
+ * @brief The previous letter count. (Scalar scan)
+ */
+static size_t LegacyCountLetters(const std::string &str)
+{
+    size_t total_letters = 0;
+    for (const auto &ch : str)
+        total_letters += (isalpha(static_cast<unsigned char>(ch)) != 0);
+
+    return total_letters;
+}
+
+/**
+ * @brief Print a benchmark result row.
+ */
+static void PrintResult(const char *name, DOUBLE legacyTime, DOUBLE currentTime)
+{
+    printf("%-48s %12.2f %12.2f %8.2fx\n", name, legacyTime, currentTime, legacyTime / currentTime);
+}
+
+/******************
+ * Benchmark main *
+ ******************/
+
+int main()
+{
+    // Short values, the theme color channels. Long texts, ASCII with digits, mixed scripts, and letters only.
+    const std::string short_values[] = {" 255", "128 ", " 64", "0"};
+    std::string long_ascii_text = "", long_mixed_text = "", long_letter_text = "";
+    for (size_t i = 0; long_ascii_text.size() < LONG_TEXT_LENGTH; i++)
+        long_ascii_text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit " + std::to_string(i) + ". ";
+    while (long_mixed_text.size() < LONG_TEXT_LENGTH)
+        long_mixed_text += "Lorem ipsum dolor sit amet 42, Tiếng Việt, 中文, Ελληνικά, emoji \xF0\x9F\x98\x80. ";
+    while (long_letter_text.size() < LONG_TEXT_LENGTH)
+        long_letter_text += "Lorem ipsum dolor sit amet, consectetur adipiscing elit. ";
+
+    // Check the current implementation against the baseline.
+    for (const std::string *p_text : std::initializer_list<const std::string *>{&short_values[0], &short_values[1], &short_values[2], &short_values[3], &long_ascii_text, &long_mixed_text, &long_letter_text})
+    {
+        if (MyUtility::FilterCharacters(*p_text, MyCharClass::Digit) != LegacyRemoveNonDigitFromString(*p_text) ||
+            MyUtility::ContainsCharacter(*p_text, MyCharClass::Digit) != LegacyContainsDigit(*p_text) ||
+            MyUtility::CountCharacters(*p_text, MyCharClass::Alpha) != LegacyCountLetters(*p_text))
+        {
+            printf("Result mismatch. (Text: '%.32s')\n", p_text->c_str());
+            return 1;
+        }
+    }
+
+#if defined(SIMD_SSE2)
+    const char *simd_path = "SSE2";
+#elif defined(SIMD_NEON)
+    const char *simd_path = "NEON";
+#else
+    const char *simd_path = "scalar";
+#endif
+    printf("Character classes, %s path, median of %u samples.\n", simd_path, SAMPLE_COUNT);
+    printf("%-48s %12s %12s %9s\n", "Benchmark", "Legacy ns", "Current ns", "Speedup");
+    PrintResult("Short values, remove the non-digits",
+                MeasureNanoseconds(SHORT_VALUE_ITERATIONS / 20, [&](UINT64 i)
+                                   { g_totalMatches += LegacyRemoveNonDigitFromString(short_values[i & 3]).size(); }),
+                MeasureNanoseconds(SHORT_VALUE_ITERATIONS, [&](UINT64 i)
+                                   { g_totalMatches += MyUtility::FilterCharacters(short_values[i & 3], MyCharClass::Digit).size(); }));
+    PrintResult("Long text, remove the non-digits",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS / 50, [&](UINT64)
+                                   { g_totalMatches += LegacyRemoveNonDigitFromString(long_ascii_text).size(); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::FilterCharacters(long_ascii_text, MyCharClass::Digit).size(); }));
+    PrintResult("Long mixed text, remove the non-digits",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS / 50, [&](UINT64)
+                                   { g_totalMatches += LegacyRemoveNonDigitFromString(long_mixed_text).size(); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::FilterCharacters(long_mixed_text, MyCharClass::Digit).size(); }));
+    PrintResult("Long text without digits, contains a digit",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyContainsDigit(long_letter_text); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::ContainsCharacter(long_letter_text, MyCharClass::Digit); }));
+    PrintResult("Long text, count the letters",
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += LegacyCountLetters(long_ascii_text); }),
+                MeasureNanoseconds(LONG_TEXT_ITERATIONS, [&](UINT64)
+                                   { g_totalMatches += MyUtility::CountCharacters(long_ascii_text, MyCharClass::Alpha); }));
+
+    return 0;
+}
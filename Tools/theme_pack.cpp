@@ -0,0 +1,46 @@
+/**
+ * @file theme_pack.cpp
+ * @brief Writes the built-in theme tables to a theme pack file. (See `MyThemePack`)
+ * @note Built from the application sources with a console entry point, see the 'mingw64-tools' build task.
+ *       Usage: theme_pack [output file] (Default: themes.pack)
+ * @note The application loads the theme pack next to its executable, the pack tables take precedence over the built-in ones.
+ *       The written pack is loaded back and compared with the built-in tables before the tool returns.
+ */
+
+#include "../Headers/standard_includes.h" // Include standard libraries.
+#include "../Headers/my_includes.h"       // Include my user-defined type headers.
+#include <cstdio>                         // C style input/output.
+
+int main(int argc, char *argv[])
+{
+    MYTHEMETABLE theme_tables[UI_THEME_COUNT];
+    for (size_t i = 0; i < UI_THEME_COUNT; i++)
+        theme_tables[i] = *UIColors::getBuiltInThemeTable(static_cast<MyTheme>(i));
+
+    std::string file_path = (argc >= 2 ? argv[1] : "themes.pack");
+    std::wstring wide_file_path = MyUtility::ConvertStringToWideString(file_path);
+    if (!MyThemePack::write(wide_file_path, theme_tables, UI_THEME_COUNT))
+    {
+        fprintf(stderr, "Failed to write the theme pack file.\n");
+        return 1;
+    }
+
+    MyThemePack theme_pack;
+    if (!theme_pack.load(wide_file_path))
+    {
+        fprintf(stderr, "Failed to load the written theme pack file.\n");
+        return 1;
+    }
+    for (size_t i = 0; i < UI_THEME_COUNT; i++)
+    {
+        const MYTHEMETABLE *p_theme_table = theme_pack.getThemeTable(static_cast<MyTheme>(i));
+        if (!p_theme_table || memcmp(p_theme_table, &theme_tables[i], sizeof(MYTHEMETABLE)) != 0)
+        {
+            fprintf(stderr, "The written theme pack file doesn't match the built-in theme tables. (Theme: %zu)\n", i);
+            return 1;
+        }
+    }
+
+    printf("Theme pack written: %s (%d theme(s), %d color(s) per theme)\n", file_path.c_str(), UI_THEME_COUNT, UI_THEME_COLOR_COUNT);
+    return 0;
+}
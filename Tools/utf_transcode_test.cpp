@@ -0,0 +1,359 @@
+/**
+ * @file utf_transcode_test.cpp
+ * @brief Differential test of the UTF transcoders. (See `MyUtility::TranscodeUtf8ToUtf16()`, `MyUtility::TranscodeUtf16ToUtf8()`)
+ * @note Portable, build with: g++ -std=c++17 -O2 Tools/utf_transcode_test.cpp -o utf_transcode_test
+ *       Usage: utf_transcode_test [random case count] [seed]
+ * @note The transcoders (SIMD ASCII blocks + scalar sequences) are checked against scalar references written from the
+ *       definitions: a UTF-8 sequence is replaced by U+FFFD up to its longest prefix that some well-formed sequence starts with
+ *       (the maximal subpart, Unicode 3.9 U+FFFD substitution), and the unpaired surrogates are replaced by U+FFFD.
+ *       The edge cases are placed at every offset of a 48 byte ASCII run, so they cross the 16 byte block boundaries.
+ *       Returns 0 if every case matches, 1 otherwise.
+ */
+
+#include "../Headers/portable_includes.h" // Include the portable types.
+#include "../Headers/text.h"              // Include the portable text helpers.
+#include <cstdio>                         // C style input/output.
+#include <algorithm>                      // Minimum and maximum.
+#include <cstdlib>                        // String to number conversions.
+#include <random>                         // Random case generation.
+#include <vector>                         // Sequence containers.
+
+/********************
+ * Test definitions *
+ ********************/
+
+static const UINT DEFAULT_RANDOM_CASES = 200000; // Default number of random cases per direction.
+static const size_t PADDING_LENGTH = 48;         // Length of the ASCII runs around the edge cases.
+
+/**
+ * @brief Encode a code point to UTF-16.
+ */
+static void AppendUtf16(std::u16string &text, char32_t codePoint)
+{
+    if (codePoint >= 0x10000)
+    {
+        text += static_cast<char16_t>(0xD800 + ((codePoint - 0x10000) >> 10));
+        text += static_cast<char16_t>(0xDC00 + ((codePoint - 0x10000) & 0x3FF));
+    }
+    else
+        text += static_cast<char16_t>(codePoint);
+}
+
+/**
+ * @brief Encode a code point to UTF-8.
+ */
+static void AppendUtf8(std::string &text, char32_t codePoint)
+{
+    if (codePoint < 0x80)
+        text += static_cast<char>(codePoint);
+    else if (codePoint < 0x800)
+    {
+        text += static_cast<char>(0xC0 | (codePoint >> 6));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else if (codePoint < 0x10000)
+    {
+        text += static_cast<char>(0xE0 | (codePoint >> 12));
+        text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+    else
+    {
+        text += static_cast<char>(0xF0 | (codePoint >> 18));
+        text += static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+        text += static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+        text += static_cast<char>(0x80 | (codePoint & 0x3F));
+    }
+}
+
+/**
+ * @brief Check if the first bytes of a sequence can be completed to a well-formed UTF-8 sequence.
+ * @note Computes the code point range reachable by completing the sequence, and intersects it with the scalar values
+ *       that need exactly the sequence length. (No overlongs, no surrogates, nothing above U+10FFFF)
+ * @param pBytes Pointer to the sequence bytes.
+ * @param totalBytes Number of bytes to check. (At least 1)
+ * @param sequenceLength Reference to the variable that receives the sequence length implied by the lead byte. [OUT]
+ * @return Returns true if the bytes start a well-formed sequence, false otherwise.
+ */
+static bool IsWellFormedPrefix(const BYTE *pBytes, size_t totalBytes, size_t &sequenceLength)
+{
+    BYTE lead_byte = pBytes[0];
+    char32_t payload = 0;
+    if ((lead_byte & 0xE0) == 0xC0)
+        sequenceLength = 2, payload = lead_byte & 0x1F;
+    else if ((lead_byte & 0xF0) == 0xE0)
+        sequenceLength = 3, payload = lead_byte & 0x0F;
+    else if ((lead_byte & 0xF8) == 0xF0)
+        sequenceLength = 4, payload = lead_byte & 0x07;
+    else
+        return false;
+    if (totalBytes > sequenceLength)
+        return false;
+
+    for (size_t i = 1; i < totalBytes; i++)
+    {
+        if ((pBytes[i] & 0xC0) != 0x80)
+            return false;
+        payload = (payload << 6) | (pBytes[i] & 0x3F);
+    }
+    size_t missing_bits = 6 * (sequenceLength - totalBytes);
+    char32_t lowest = payload << missing_bits, highest = lowest | ((char32_t(1) << missing_bits) - 1);
+
+    static const char32_t minimum_code_points[5] = {0, 0, 0x80, 0x800, 0x10000};
+    char32_t range_begin = std::max(lowest, minimum_code_points[sequenceLength]);
+    char32_t range_end = std::min<char32_t>(highest, 0x10FFFF);
+    if (range_begin > range_end)
+        return false;
+    if (sequenceLength == 3 && range_begin >= 0xD800 && range_end <= 0xDFFF)
+        return false; // Every completion is a surrogate.
+
+    return true;
+}
+
+/**
+ * @brief Reference UTF-8 to UTF-16 transcoder.
+ */
+static std::u16string ReferenceUtf8ToUtf16(const std::string &text)
+{
+    const BYTE *p_bytes = reinterpret_cast<const BYTE *>(text.data());
+    std::u16string result;
+    size_t i = 0;
+    while (i < text.size())
+    {
+        if (p_bytes[i] < 0x80)
+        {
+            result += static_cast<char16_t>(p_bytes[i++]);
+            continue;
+        }
+
+        // Extend the sequence while it stays the prefix of a well-formed sequence.
+        size_t sequence_length = 0, prefix_length = 0;
+        while (i + prefix_length < text.size() && IsWellFormedPrefix(p_bytes + i, prefix_length + 1, sequence_length))
+            prefix_length++;
+        if (!prefix_length || prefix_length < sequence_length)
+        {
+            result += static_cast<char16_t>(0xFFFD);
+            i += (prefix_length ? prefix_length : 1);
+            continue;
+        }
+
+        char32_t code_point = p_bytes[i] & (0x7F >> sequence_length);
+        for (size_t j = 1; j < sequence_length; j++)
+            code_point = (code_point << 6) | (p_bytes[i + j] & 0x3F);
+        AppendUtf16(result, code_point);
+        i += sequence_length;
+    }
+
+    return result;
+}
+
+/**
+ * @brief Reference UTF-16 to UTF-8 transcoder.
+ */
+static std::string ReferenceUtf16ToUtf8(const std::u16string &text)
+{
+    std::string result;
+    for (size_t i = 0; i < text.size(); i++)
+    {
+        char32_t unit = text[i];
+        bool is_high_surrogate = (unit >= 0xD800 && unit <= 0xDBFF);
+        bool is_next_low_surrogate = (i + 1 < text.size() && text[i + 1] >= 0xDC00 && text[i + 1] <= 0xDFFF);
+        if (is_high_surrogate && is_next_low_surrogate)
+            AppendUtf8(result, 0x10000 + ((unit - 0xD800) << 10) + (text[++i] - 0xDC00));
+        else if (unit >= 0xD800 && unit <= 0xDFFF)
+            AppendUtf8(result, 0xFFFD);
+        else
+            AppendUtf8(result, unit);
+    }
+
+    return result;
+}
+
+/**
+ * @brief Print the code units of a failed case.
+ */
+template <typename String>
+static void PrintCase(const char *label, const String &text)
+{
+    printf("  %s (%zu):", label, text.size());
+    for (size_t i = 0; i < text.size() && i < 96; i++)
+        printf(" %0*X", static_cast<int>(sizeof(text[i]) * 2), static_cast<UINT>(static_cast<std::make_unsigned_t<typename String::value_type>>(text[i])));
+    printf("%s\n", (text.size() > 96 ? " ..." : ""));
+}
+
+/**
+ * @brief Counts the checked and failed cases.
+ */
+class TranscodeChecker
+{
+public:
+    /**
+     * @brief Check the UTF-8 to UTF-16 transcoder on a case.
+     */
+    void checkUtf8(const std::string &text)
+    {
+        std::u16string expected = ReferenceUtf8ToUtf16(text);
+        std::u16string result(text.size(), u'\0');
+        result.resize(MyUtility::TranscodeUtf8ToUtf16(text.data(), text.size(), result.data()));
+        this->report(result == expected, "UTF-8 to UTF-16", text, expected, result);
+#if WCHAR_MAX == 0xFFFF
+        std::wstring wide_result(text.size(), L'\0');
+        wide_result.resize(MyUtility::TranscodeUtf8ToUtf16(text.data(), text.size(), wide_result.data()));
+        std::u16string wide_units(wide_result.begin(), wide_result.end());
+        this->report(wide_units == expected, "UTF-8 to UTF-16 (wchar_t)", text, expected, wide_units);
+#endif
+    }
+
+    /**
+     * @brief Check the UTF-16 to UTF-8 transcoder on a case.
+     */
+    void checkUtf16(const std::u16string &text)
+    {
+        std::string expected = ReferenceUtf16ToUtf8(text);
+        std::string result(text.size() * 3, '\0');
+        result.resize(MyUtility::TranscodeUtf16ToUtf8(text.data(), text.size(), result.data()));
+        this->report(result == expected, "UTF-16 to UTF-8", text, expected, result);
+#if WCHAR_MAX == 0xFFFF
+        std::wstring wide_text(text.begin(), text.end());
+        std::string wide_result(text.size() * 3, '\0');
+        wide_result.resize(MyUtility::TranscodeUtf16ToUtf8(wide_text.data(), wide_text.size(), wide_result.data()));
+        this->report(wide_result == expected, "UTF-16 to UTF-8 (wchar_t)", text, expected, wide_result);
+#endif
+    }
+
+    UINT64 totalCases = 0;    // Number of checked cases.
+    UINT64 totalFailures = 0; // Number of failed cases.
+
+private:
+    template <typename Source, typename Destination>
+    void report(bool isMatch, const char *direction, const Source &source, const Destination &expected, const Destination &result)
+    {
+        this->totalCases++;
+        if (isMatch)
+            return;
+
+        // Print the first failures only.
+        if (this->totalFailures++ < 8)
+        {
+            printf("Mismatch. (%s)\n", direction);
+            PrintCase("Source  ", source);
+            PrintCase("Expected", expected);
+            PrintCase("Result  ", result);
+        }
+    }
+};
+
+/*************
+ * Test main *
+ *************/
+
+int main(int argc, char *argv[])
+{
+    UINT total_random_cases = (argc >= 2 ? static_cast<UINT>(strtoul(argv[1], nullptr, 10)) : DEFAULT_RANDOM_CASES);
+    UINT seed = (argc >= 3 ? static_cast<UINT>(strtoul(argv[2], nullptr, 10)) : 20240501u);
+    TranscodeChecker checker;
+
+    // UTF-8 edge cases: the well-formed boundaries, the overlongs, the surrogates, the out of range and the truncated sequences.
+    const std::vector<std::string> utf8_edge_cases = {
+        "", "\x7F", "\xC2\x80", "\xDF\xBF", "\xE0\xA0\x80", "\xEF\xBF\xBF", "\xF0\x90\x80\x80", "\xF4\x8F\xBF\xBF",
+        "\x80", "\xBF", "\xC0\x80", "\xC1\xBF", "\xE0\x80\x80", "\xE0\x9F\xBF", "\xF0\x80\x80\x80", "\xF0\x8F\xBF\xBF",
+        "\xED\xA0\x80", "\xED\xBF\xBF", "\xED\x9F\xBF", "\xF4\x90\x80\x80", "\xF5\x80\x80\x80", "\xFE", "\xFF",
+        "\xC2", "\xE0\xA0", "\xE1", "\xF0\x90\x80", "\xF1\x80", "\xF4", "\xC2\x41", "\xE1\x80\x41", "\xF1\x80\x80\x41",
+        "\xE0\xA0\xC2\x80", "\xF0\x90\x80\xF0\x90\x80\x80", "\xC2\xC2\x80", "\xEF\xBB\xBF", "\xF0\x9F\x98\x80\xF0\x9F\x98\x80"};
+    // UTF-16 edge cases: the surrogate pairs, the unpaired high and low surrogates, and the boundaries of each range.
+    const std::vector<std::u16string> utf16_edge_cases = {
+        u"", u"\u007F", u"\u0080", u"\u07FF", u"\u0800", u"\uFFFF", u"\U00010000", u"\U0010FFFF", u"\U0001F600",
+        std::u16string(1, 0xD800), std::u16string(1, 0xDBFF), std::u16string(1, 0xDC00), std::u16string(1, 0xDFFF),
+        std::u16string{0xDC00, 0xD800}, std::u16string{0xD800, 0xD800, 0xDC00}, std::u16string{0xD800, u'A'}};
+
+    for (size_t offset = 0; offset <= PADDING_LENGTH; offset++)
+    {
+        std::string prefix(offset, 'a'), suffix(PADDING_LENGTH - offset, 'z');
+        std::u16string wide_prefix(offset, u'a'), wide_suffix(PADDING_LENGTH - offset, u'z');
+        for (const auto &edge_case : utf8_edge_cases)
+        {
+            checker.checkUtf8(prefix + edge_case + suffix);
+            checker.checkUtf8(prefix + edge_case);
+        }
+        for (const auto &edge_case : utf16_edge_cases)
+        {
+            checker.checkUtf16(wide_prefix + edge_case + wide_suffix);
+            checker.checkUtf16(wide_prefix + edge_case);
+        }
+    }
+
+    // Random cases: ASCII runs of every length around the block size, mixed with well-formed and random sequences.
+    std::mt19937 generator(seed);
+    auto random = [&generator](UINT bound)
+    { return static_cast<UINT>(generator() % bound); };
+    const char32_t code_point_ranges[][2] = {{0x80, 0x7FF}, {0x800, 0xD7FF}, {0xE000, 0xFFFF}, {0x10000, 0x10FFFF}};
+    for (UINT i = 0; i < total_random_cases; i++)
+    {
+        std::string text;
+        std::u16string wide_text;
+        std::string valid_text;
+        UINT total_chunks = 1 + random(8);
+        for (UINT chunk = 0; chunk < total_chunks; chunk++)
+        {
+            switch (random(4))
+            {
+            case 0: // ASCII run.
+            {
+                UINT length = random(40);
+                for (UINT j = 0; j < length; j++)
+                {
+                    char character = static_cast<char>(0x20 + random(0x5F));
+                    text += character, wide_text += static_cast<char16_t>(character), valid_text += character;
+                }
+                break;
+            }
+            case 1: // Well-formed code point.
+            {
+                const char32_t *p_range = code_point_ranges[random(4)];
+                char32_t code_point = p_range[0] + random(p_range[1] - p_range[0] + 1);
+                AppendUtf8(text, code_point), AppendUtf16(wide_text, code_point), AppendUtf8(valid_text, code_point);
+                break;
+            }
+            case 2: // Random bytes and code units.
+            {
+                UINT length = 1 + random(4);
+                for (UINT j = 0; j < length; j++)
+                    text += static_cast<char>(0x80 + random(0x80)), wide_text += static_cast<char16_t>(0xD800 + random(0x800));
+                break;
+            }
+            default: // Truncated well-formed sequence.
+            {
+                std::string sequence;
+                AppendUtf8(sequence, code_point_ranges[1 + random(3)][0] + random(0x400));
+                text += sequence.substr(0, 1 + random(static_cast<UINT>(sequence.size()) - 1));
+                wide_text += static_cast<char16_t>(random(2) ? 0xD800 + random(0x400) : 0xDC00 + random(0x400));
+                break;
+            }
+            }
+        }
+        checker.checkUtf8(text);
+        checker.checkUtf16(wide_text);
+
+        // Round trip of the well-formed text.
+        std::u16string round_trip(valid_text.size(), u'\0');
+        round_trip.resize(MyUtility::TranscodeUtf8ToUtf16(valid_text.data(), valid_text.size(), round_trip.data()));
+        checker.checkUtf16(round_trip);
+        if (ReferenceUtf16ToUtf8(round_trip) != valid_text)
+        {
+            printf("Round trip mismatch.\n");
+            PrintCase("Source", valid_text);
+            return 1;
+        }
+    }
+
+#if defined(SIMD_SSE2)
+    const char *simd_path = "SSE2";
+#elif defined(SIMD_NEON)
+    const char *simd_path = "NEON";
+#else
+    const char *simd_path = "scalar";
+#endif
+    printf("%llu case(s) checked, %llu failure(s). (Path: %s, seed: %u)\n", static_cast<unsigned long long>(checker.totalCases), static_cast<unsigned long long>(checker.totalFailures), simd_path, seed);
+
+    return (checker.totalFailures ? 1 : 0);
+}
@@ -74,7 +74,7 @@ if ($disable_msbuild_tasks -eq $true) {
 
 # Print usage texts.
 if (($args.Count -eq 0) -or ($args[0] -match "\?") -or ($args[0] -match "help")) {
-    Write-Color -text "Available tasks: ", "build clean" -color Yellow, Cyan
+    Write-Color -text "Available tasks: ", "build benchmark themepack clean" -color Yellow, Cyan
     Write-Color -text "Task options: ", "Use ", "/? ", "(Example: ./task.ps1 build /?)" -color Yellow, White, Cyan, White
     Write-Color -text "Example: ", "./task.ps1 <task name> <task option 1> <task option 2> <...>" -color Yellow, DarkGray
     exit 0
@@ -114,8 +114,10 @@ if ($task_name -match "build") {
         Write-Color "Build options:" Yellow
         Write-Color -text "mingw64-debug", ": Build the executable using Mingw64 compiler. (Debug)" -color Cyan, White
         Write-Color -text "mingw64-release", ": Build the executable using Mingw64 compiler. (Release)" -color Cyan, White
+        Write-Color -text "mingw64-profile", ": Build the executable using Mingw64 compiler. (Release, with the allocation tracker)" -color Cyan, White
         Write-Color -text "msbuild-debug", ": Build the executable using MSBuild build tool. (Debug)" -color Cyan, White
         Write-Color -text "msbuild-release", ": Build the executable using MSBuild build tool. (Release)" -color Cyan, White
+        Write-Color -text "mingw64-tools", ": Build the development tools using Mingw64 compiler. (Log decoder, benchmarks, theme pack writer, UTF transcoder test)" -color Cyan, White
         Write-Color -text "Example: ", "./task.ps1 build mingw64-release" -color Yellow, DarkGray
         exit 0
     }
@@ -228,6 +230,60 @@ if ($task_name -match "build") {
         exit 0
     }
 
+    # 'mingw64-profile'
+    elseif ($args[1] -eq "mingw64-profile") {
+        if ($disable_mingw64_tasks -eq $true) {
+            Write-Color "Mingw64 tasks are disabled." DarkGray
+            exit 0
+        }
+
+        # Create build directories.
+        if (!(Test-Path("./Build"))) {
+            Write-Color -Text "Creating '", "Build", "' folder ..." -color DarkGray, Cyan, DarkGray
+            New-Item -ItemType Directory -Path ./Build | Out-Null
+        }
+        if (!(Test-Path("./Build/Mingw64"))) {
+            Write-Color -Text "Creating '", "Mingw64", "' folder ..." -color DarkGray, Cyan, DarkGray
+            New-Item -ItemType Directory -Path ./Build/Mingw64 | Out-Null
+        }
+
+        # Clean build files.
+        if (Test-Path("./Build/Mingw64")) {
+            Remove-Item ./Build/Mingw64/* -recurse
+        }
+
+        # Build resource file.
+        Write-Color -text "Resource compiler path: ", "$($resource_compiler_path)" -color Yellow, Cyan
+        Write-Color "Building resource file ..." White
+        $rc_build_command = "$($resource_compiler_path) ./Resources/resources.rc ./Build/Mingw64/resources.o"
+        Invoke-Expression $rc_build_command
+        if (!(Test-Path("./Build/Mingw64/resources.o"))) {
+            Write-Color "Failed to build the resource file." Red
+            exit 1
+        }
+        Write-Color "Resource file built successfully.`n" Green
+        
+        # Compile the executable.
+        Write-Color -text "Compiler path: ", "$($compiler_path)" -color Yellow, Cyan
+        $compile_flags =
+        "-Wall -m64 -std=c++17 -municode -mwindows -fdiagnostics-color=always -finput-charset=utf-8 -fexec-charset=utf-8 " +
+        "-DALLOCATION_TRACKING_COMPILE_ENABLED=1 -Ofast -s Sources/*.cpp Build/Mingw64/resources.o -o Build/Mingw64/$($workspace_name).exe " +
+        "`"-Wl,-Bdynamic`" -luxtheme -lcomctl32 -ldwmapi -lwinmm -lpowrprof -ld2d1 -ldwrite -lwindowscodecs " +
+        "-lkernel32 -luser32 -lgdi32 -lwinspool -lcomdlg32 -ladvapi32 -lshell32 -lole32 -loleaut32 -luuid -lodbc32 -lodbccp32"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+        
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Mingw64/$($workspace_name).exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+        Write-Color -text "✔ Build completed. (", "$($args[1])", ")" -color Green, Cyan, Green
+        exit 0
+    }
+
     # 'msbuild-debug'
     elseif ($args[1] -eq "msbuild-debug") {
         if ($disable_msbuild_tasks -eq $true) {
@@ -296,6 +352,156 @@ if ($task_name -match "build") {
         exit 0
     }
 
+    # 'mingw64-tools'
+    elseif ($args[1] -eq "mingw64-tools") {
+        if ($disable_mingw64_tasks -eq $true) {
+            Write-Color "Mingw64 tasks are disabled." DarkGray
+            exit 0
+        }
+
+        # Create build directories.
+        if (!(Test-Path("./Build"))) {
+            Write-Color -Text "Creating '", "Build", "' folder ..." -color DarkGray, Cyan, DarkGray
+            New-Item -ItemType Directory -Path ./Build | Out-Null
+        }
+        if (!(Test-Path("./Build/Tools"))) {
+            Write-Color -Text "Creating '", "Tools", "' folder ..." -color DarkGray, Cyan, DarkGray
+            New-Item -ItemType Directory -Path ./Build/Tools | Out-Null
+        }
+
+        # Compile the log decoder. (Binary log files -> text log format)
+        Write-Color -text "Compiler path: ", "$($compiler_path)" -color Yellow, Cyan
+        $compile_flags = "-Wall -m64 -std=c++17 -fdiagnostics-color=always -O2 -s Tools/log_decoder.cpp -o Build/Tools/log_decoder.exe"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/log_decoder.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the input replay tool. (Input recording files -> replay frame schedule)
+        $compile_flags = "-Wall -m64 -std=c++17 -fdiagnostics-color=always -O2 -s Tools/input_replay.cpp -o Build/Tools/input_replay.exe"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/input_replay.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the log benchmark. (Application sources with a console entry point)
+        $compile_flags =
+        "-Wall -m64 -std=c++17 -fdiagnostics-color=always -finput-charset=utf-8 -fexec-charset=utf-8 " +
+        "-O2 -s Sources/*.cpp Tools/log_benchmark.cpp -o Build/Tools/log_benchmark.exe " +
+        "`"-Wl,-Bdynamic`" -luxtheme -lcomctl32 -ldwmapi -lwinmm -lpowrprof -ld2d1 -ldwrite -lwindowscodecs " +
+        "-lkernel32 -luser32 -lgdi32 -lwinspool -lcomdlg32 -ladvapi32 -lshell32 -lole32 -loleaut32 -luuid -lodbc32 -lodbccp32"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/log_benchmark.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the string benchmark. (Application sources with a console entry point)
+        $compile_flags =
+        "-Wall -m64 -std=c++17 -fdiagnostics-color=always -finput-charset=utf-8 -fexec-charset=utf-8 " +
+        "-O2 -s Sources/*.cpp Tools/string_benchmark.cpp -o Build/Tools/string_benchmark.exe " +
+        "`"-Wl,-Bdynamic`" -luxtheme -lcomctl32 -ldwmapi -lwinmm -lpowrprof -ld2d1 -ldwrite -lwindowscodecs " +
+        "-lkernel32 -luser32 -lgdi32 -lwinspool -lcomdlg32 -ladvapi32 -lshell32 -lole32 -loleaut32 -luuid -lodbc32 -lodbccp32"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/string_benchmark.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the theme pack writer. (Application sources with a console entry point)
+        $compile_flags =
+        "-Wall -m64 -std=c++17 -fdiagnostics-color=always -finput-charset=utf-8 -fexec-charset=utf-8 " +
+        "-O2 -s Sources/*.cpp Tools/theme_pack.cpp -o Build/Tools/theme_pack.exe " +
+        "`"-Wl,-Bdynamic`" -luxtheme -lcomctl32 -ldwmapi -lwinmm -lpowrprof -ld2d1 -ldwrite -lwindowscodecs " +
+        "-lkernel32 -luser32 -lgdi32 -lwinspool -lcomdlg32 -ladvapi32 -lshell32 -lole32 -loleaut32 -luuid -lodbc32 -lodbccp32"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/theme_pack.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the text benchmark. (Portable text helpers only)
+        $compile_flags = "-Wall -m64 -std=c++17 -fdiagnostics-color=always -finput-charset=utf-8 -fexec-charset=utf-8 -O2 -s Sources/text.cpp Tools/text_benchmark.cpp -o Build/Tools/text_benchmark.exe"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/text_benchmark.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the UTF transcoder test. (Differential test against the reference transcoders)
+        $compile_flags = "-Wall -m64 -std=c++17 -fdiagnostics-color=always -O2 -s Tools/utf_transcode_test.cpp -o Build/Tools/utf_transcode_test.exe"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/utf_transcode_test.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the core benchmark. (Portable cores only)
+        $compile_flags = "-Wall -m64 -std=c++17 -fdiagnostics-color=always -finput-charset=utf-8 -fexec-charset=utf-8 -O2 -s Sources/text.cpp Sources/config.cpp Sources/theme.cpp Tools/core_benchmark.cpp -o Build/Tools/core_benchmark.exe"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/core_benchmark.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+
+        # Compile the benchmark compare tool. (Benchmark results -> regressions against the baseline)
+        $compile_flags = "-Wall -m64 -std=c++17 -fdiagnostics-color=always -O2 -s Tools/benchmark_compare.cpp -o Build/Tools/benchmark_compare.exe"
+        Write-Color -text "Compile flags: ", "$($compile_flags)`n" -color Yellow, Cyan
+
+        Write-Color "[Build in progress, please wait...]" DarkYellow
+        $build_command = "$($compiler_path) $($compile_flags)"
+        Invoke-Expression $build_command
+
+        if (!(Test-Path("./Build/Tools/benchmark_compare.exe"))) {
+            Write-Color "✘ Build failed." Red
+            exit 1
+        }
+        Write-Color -text "✔ Build completed. (", "$($args[1])", ")" -color Green, Cyan, Green
+        exit 0
+    }
+
     # Invalid build option.
     else {
         Write-Color "Invalid build option." Red
@@ -303,6 +509,96 @@ if ($task_name -match "build") {
     }
 }
 
+# [Benchmark tasks]
+elseif ($task_name -match "benchmark") {
+    # Print benchmark options
+    if (($args.Count -eq 1) -or ($args[1] -match "\?") -or ($args[1] -match "help")) {
+        Write-Color "Benchmark options:" Yellow
+        Write-Color -text "run", ": Run the core benchmark and compare the results with the baseline. (Tools/benchmark_baseline.json)" -color Cyan, White
+        Write-Color -text "baseline", ": Run the core benchmark and store the results as the new baseline." -color Cyan, White
+        Write-Color -text "Threshold: ", "The third argument sets the regression threshold in percent. (Default: 10)" -color Yellow, White
+        Write-Color -text "Example: ", "./task.ps1 benchmark run 5" -color Yellow, DarkGray
+        exit 0
+    }
+    if (!(Test-Path("./Build/Tools/core_benchmark.exe")) -or !(Test-Path("./Build/Tools/benchmark_compare.exe"))) {
+        Write-Color -text "The benchmark tools are not built, use '", "./task.ps1 build mingw64-tools", "' first." -color Red, Cyan, Red
+        exit 1
+    }
+
+    # 'run'
+    if ($args[1] -eq "run") {
+        Write-Color "[Benchmark in progress, please wait...]" DarkYellow
+        & ./Build/Tools/core_benchmark.exe ./Build/Tools/benchmark_results.json
+        if ($LASTEXITCODE -ne 0) {
+            Write-Color "✘ Benchmark failed." Red
+            exit 1
+        }
+        if (!(Test-Path("./Tools/benchmark_baseline.json"))) {
+            Write-Color -text "No baseline found, use '", "./task.ps1 benchmark baseline", "' to store one." -color DarkGray, Cyan, DarkGray
+            exit 0
+        }
+
+        $threshold = if ($args.Count -ge 3) { $args[2] } else { "10" }
+        Write-Host
+        & ./Build/Tools/benchmark_compare.exe ./Tools/benchmark_baseline.json ./Build/Tools/benchmark_results.json $threshold
+        if ($LASTEXITCODE -eq 2) {
+            Write-Color "✘ Performance regressions detected." Red
+            exit 2
+        }
+        elseif ($LASTEXITCODE -ne 0) {
+            Write-Color "✘ Failed to compare the results with the baseline." Red
+            exit 1
+        }
+        Write-Color "✔ No performance regression." Green
+        exit 0
+    }
+
+    # 'baseline'
+    elseif ($args[1] -eq "baseline") {
+        Write-Color "[Benchmark in progress, please wait...]" DarkYellow
+        & ./Build/Tools/core_benchmark.exe ./Tools/benchmark_baseline.json
+        if ($LASTEXITCODE -ne 0) {
+            Write-Color "✘ Benchmark failed." Red
+            exit 1
+        }
+        Write-Color -text "✔ Baseline stored. (", "Tools/benchmark_baseline.json", ")" -color Green, Cyan, Green
+        exit 0
+    }
+
+    # Invalid benchmark option.
+    else {
+        Write-Color "Invalid benchmark option." Red
+        exit 1
+    }
+}
+
+# [Theme pack tasks]
+elseif ($task_name -match "themepack") {
+    # Print theme pack options
+    if (($args.Count -ge 2) -and (($args[1] -match "\?") -or ($args[1] -match "help"))) {
+        Write-Color "Theme pack options:" Yellow
+        Write-Color -text "<output directory>", ": Write the built-in theme tables to 'themes.pack' in the directory. (Default: Build/Mingw64)" -color Cyan, White
+        Write-Color -text "Example: ", "./task.ps1 themepack ./Build/MSBuild/Release" -color Yellow, DarkGray
+        exit 0
+    }
+    if (!(Test-Path("./Build/Tools/theme_pack.exe"))) {
+        Write-Color -text "The theme pack writer is not built, use '", "./task.ps1 build mingw64-tools", "' first." -color Red, Cyan, Red
+        exit 1
+    }
+
+    $output_directory = if ($args.Count -ge 2) { $args[1] } else { "./Build/Mingw64" }
+    if (!(Test-Path($output_directory))) {
+        New-Item -ItemType Directory -Path $output_directory | Out-Null
+    }
+    & ./Build/Tools/theme_pack.exe "$($output_directory)/themes.pack"
+    if ($LASTEXITCODE -ne 0) {
+        Write-Color "✘ Failed to write the theme pack." Red
+        exit 1
+    }
+    Write-Color -text "✔ Theme pack written. (", "$($output_directory)/themes.pack", ")" -color Green, Cyan, Green
+    exit 0
+}
+
 # [Other tasks]
 elseif ($task_name -match "clean") {
     # Print clean options